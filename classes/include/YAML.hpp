@@ -28,6 +28,8 @@ class ISource;      ///< Interface for input sources
 class IDestination; ///< Interface for output destinations
 class IAction;      ///< Interface for tree traversal actions
 class YAML_Impl;    ///< Internal implementation class
+class ChainedArena; ///< Growable arena (Options::arena_tree)
+class Snapshot;     ///< Immutable tree shared between threads
 struct Node;        ///< YAML node type
 #ifdef YAML_LIB_SAX_API
 class IYAMLEvents;  ///< Interface for SAX event handlers
@@ -45,8 +47,12 @@ class IYAMLEvents;  ///< Interface for SAX event handlers
  *   Custom parser (default: built-in)
  * @var std::pmr::memory_resource* Options::memory_resource
  *   Polymorphic memory resource for allocations
+ * @var bool Options::arena_tree
+ *   Parse into a ChainedArena owned by the YAML object (blocks taken from
+ *   memory_resource if set); the tree is released in bulk
  * @var bool Options::strict_booleans
- *   Enable strict YAML 1.2 boolean parsing (only 'true'/'false' valid)
+ *   Enable strict YAML 1.2 boolean parsing (only 'true'/'false' valid) in
+ *   the built-in parser of this object only
  * @var unsigned long Options::max_documents
  *   Max documents per stream (0 = unlimited)
  * @var unsigned long Options::max_parse_depth
@@ -58,6 +64,7 @@ struct Options {
   IStringify *stringifier{nullptr};
   IParser *parser{nullptr};
   std::pmr::memory_resource *memory_resource{nullptr};
+  bool arena_tree{false};
   bool strict_booleans{false};
   unsigned long max_documents{32};
   unsigned long max_parse_depth{128};
@@ -210,6 +217,25 @@ public:
   void parse(ISource &source) const;
   void parse(ISource &&source) const;
 
+  /**
+   * @brief Parse YAML from a source, replacing the node tree and reusing the
+   * memory of the previous one.
+   *
+   * With Options::arena_tree the arena is reset rather than released, so its
+   * blocks are kept for the new tree; once the arena has grown to fit the
+   * largest input, parsing similar inputs takes no more memory from its
+   * upstream. Without an owned arena this is the same as parse().
+   * @param source Input source
+   */
+  void reparse(ISource &source) const;
+  void reparse(ISource &&source) const;
+
+  /**
+   * @brief Get the arena owning the node tree.
+   * @return The YAML object's own arena (Options::arena_tree) or nullptr
+   */
+  [[nodiscard]] const ChainedArena *arena() const;
+
   /**
    * @brief Stringify the node tree to a destination (no whitespace formatting).
    * @param destination Output destination
@@ -289,12 +315,15 @@ public:
 #endif // YAML_LIB_FILE_IO
 
   /**
-   * @brief Enable or disable strict YAML 1.2 boolean parsing.
+   * @brief Enable or disable strict YAML 1.2 boolean parsing for every
+   *        built-in parser, whatever its Options::strict_booleans.
    * @param strict If true, only 'true'/'false' are valid booleans
    */
   static void setStrictBooleans(bool strict) noexcept;
 
 private:
+  // Snapshot::make(const YAML &) copies the tree between implementations
+  friend class Snapshot;
   // Internal implementation pointer
   const std::unique_ptr<YAML_Impl> implementation;
 };
@@ -28,6 +28,7 @@
 // 1. Fundamental error types and macros (needed by all interface headers)
 #include "YAML_Error.hpp"
 #include "YAML_Arena.hpp"
+#include "YAML_Allocation_Counter.hpp"  // AllocationScope tags used by Sequence/Dictionary
 // 2. Interface definitions (IStringify, IParser, ITranslator, etc.)
 //    Must come after YAML_Error.hpp so YAML_MAKE_ERROR is visible.
 #include "YAML_Interfaces.hpp"
@@ -58,6 +59,7 @@
 #include "YAML_Node_Index.hpp"     // Node::operator[]: uses isA, NRef
 // 7. Supporting infrastructure
 #include "YAML_Config.hpp"
+#include "YAML_Transcoder.hpp"  // used by StreamSource to decode UTF-16/UTF-32
 #include "YAML_Sources.hpp"
 #include "YAML_Destinations.hpp"
 // 7b. E9: Schema validation (depends on isA/NRef/operator[] defined above)
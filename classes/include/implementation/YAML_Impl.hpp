@@ -15,7 +15,7 @@ public:
   YAML_Impl &operator=(const YAML_Impl &other) = delete;
   YAML_Impl(YAML_Impl &&other) = delete;
   YAML_Impl &operator=(YAML_Impl &&other) = delete;
-  ~YAML_Impl() = default;
+  ~YAML_Impl();
   // Get YAML_Lib version
   static std::string version();
   // Get number of documents
@@ -24,6 +24,12 @@ public:
   }
   // Parse YAML into Node tree
   void parse(ISource &source);
+  // Parse YAML into Node tree, reusing the arena of the previous tree
+  void reparse(ISource &source);
+  // Replace the Node tree with a deep copy of another's
+  void copyTree(const YAML_Impl &other);
+  // Arena owning the Node tree (nullptr unless Options::arena_tree)
+  [[nodiscard]] const ChainedArena *arena() const { return treeArena.get(); }
   // Create YAML text string from Node tree
   void stringify(IDestination &destination) const;
   // Get the document
@@ -31,6 +37,7 @@ public:
     if (index >= yamlTree.size()) {
       YAML_THROW(Error, "Document does not exist.");
     }
+    arenaOnlyTree = false;
     return yamlTree[index][0];
   }
   [[nodiscard]] const Node &document(const unsigned long index) const {
@@ -61,8 +68,18 @@ public:
 #endif // YAML_LIB_FILE_IO
 
 private:
+  // Parse YAML into Node tree using memoryResource
+  void parseTree(ISource &source);
+  // Drop the Node tree (without destroying its nodes when all are in treeArena)
+  void dropTree();
   // Traverse YAML tree
   template <typename T> static void traverseNodes(T &yNode, IAction &action);
+  // Arena owning the parsed tree when Options::arena_tree is set.
+  std::unique_ptr<ChainedArena> treeArena;
+  // true while every container and string of the tree is in treeArena: set
+  // by a parse or copy, cleared once mutable access to the tree is given out
+  // (nodes allocated elsewhere may then be linked into it).
+  bool arenaOnlyTree{false};
   // Optional PMR resource used to back all node allocations during parse.
   // nullptr means: use the standard new/delete allocator (default behaviour).
   std::pmr::memory_resource *memoryResource{nullptr};
@@ -72,6 +89,9 @@ private:
   std::unique_ptr<IStringify> yamlStringify;
   // YAML tree
   std::vector<Node> yamlTree;
+  // Documents of the parse in progress; swapped with yamlTree once it
+  // succeeds so that both vectors keep their storage for the next parse.
+  std::vector<Node> parsedTree;
 };
 
 /// <summary>
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+
+namespace YAML_Lib {
+
+class ISource;
+
+/// Kind of container making a PMR allocation. Sequence, Dictionary and
+/// Node::make set it (through AllocationScope) around the calls that create
+/// containers or grow their storage so that AllocationCounter can attribute
+/// each allocation; anything else allocating through the resource is counted
+/// as strings (byte aligned) or other.
+enum class AllocationKind : uint8_t {
+  other = 0,
+  sequences,         // Array/Document Node vectors
+  dictionaryEntries, // Dictionary entry vectors
+  dictionaryIndex,   // Dictionary key index buckets and nodes
+  strings,           // byte-aligned character storage
+  containers         // Array/Dictionary/Document objects
+};
+inline constexpr std::size_t kAllocationKinds{6};
+
+/// Kind of the container allocating on this thread.
+inline thread_local AllocationKind currentAllocationKind{AllocationKind::other};
+
+/// RAII tag: sets currentAllocationKind, restoring the previous kind on exit.
+class AllocationScope {
+public:
+  explicit AllocationScope(const AllocationKind kind) noexcept
+      : previous_(currentAllocationKind) {
+    currentAllocationKind = kind;
+  }
+  ~AllocationScope() { currentAllocationKind = previous_; }
+  AllocationScope(const AllocationScope &) = delete;
+  AllocationScope &operator=(const AllocationScope &) = delete;
+  AllocationScope(AllocationScope &&) = delete;
+  AllocationScope &operator=(AllocationScope &&) = delete;
+
+private:
+  AllocationKind previous_;
+};
+
+/// AllocationCounter — std::pmr::memory_resource adapter that forwards to an
+/// upstream resource and records what passes through it: allocation count,
+/// bytes, live and peak bytes, a power-of-two size histogram and a per
+/// AllocationKind breakdown.
+///
+/// Usage:
+/// @code
+///   AllocationCounter counter;              // upstream: new_delete_resource
+///   Options options;
+///   options.memory_resource = &counter;
+///   YAML yaml{options};
+///   yaml.parse(BufferSource{yamlText});
+///   const auto stats = counter.getStatistics();
+/// @endcode
+///
+/// Like std::pmr::unsynchronized_pool_resource it is not thread safe, and it
+/// must outlive every object allocated through it.
+class AllocationCounter final : public std::pmr::memory_resource {
+public:
+  // Histogram buckets: <= 16, <= 32, ... <= 32768 and larger.
+  static constexpr std::size_t kHistogramBuckets{13};
+
+  struct KindStatistics {
+    uint64_t allocations{};
+    uint64_t bytes{};
+  };
+  // Snapshot of the counters.
+  struct Statistics {
+    uint64_t allocations{};
+    uint64_t deallocations{};
+    uint64_t bytes{};
+    uint64_t liveBytes{};
+    uint64_t peakBytes{};
+    // Sum of (alignment - 1) over all allocations: the most padding a
+    // bump allocator could add on top of bytes.
+    uint64_t alignmentSlack{};
+    std::array<uint64_t, kHistogramBuckets> histogram{};
+    std::array<KindStatistics, kAllocationKinds> kinds{};
+    [[nodiscard]] const KindStatistics &operator[](AllocationKind kind) const {
+      return kinds[static_cast<std::size_t>(kind)];
+    }
+  };
+
+  explicit AllocationCounter(
+      std::pmr::memory_resource *upstream = std::pmr::new_delete_resource()) noexcept
+      : upstream_(upstream) {}
+  AllocationCounter(const AllocationCounter &) = delete;
+  AllocationCounter &operator=(const AllocationCounter &) = delete;
+  AllocationCounter(AllocationCounter &&) = delete;
+  AllocationCounter &operator=(AllocationCounter &&) = delete;
+  ~AllocationCounter() override = default;
+
+  [[nodiscard]] Statistics getStatistics() const { return statistics_; }
+  // Zero the counters (live bytes are kept so later frees still balance).
+  void resetStatistics() noexcept;
+  [[nodiscard]] std::pmr::memory_resource *upstream() const noexcept {
+    return upstream_;
+  }
+  // Histogram bucket for an allocation of the given size.
+  [[nodiscard]] static std::size_t histogramBucket(std::size_t bytes) noexcept;
+
+private:
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void *pointer, std::size_t bytes,
+                     std::size_t alignment) override;
+  [[nodiscard]] bool do_is_equal(
+      const std::pmr::memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+
+  std::pmr::memory_resource *upstream_;
+  Statistics statistics_;
+};
+
+/// Parse a representative source the way MonotonicArena<N> would (a pool
+/// over a monotonic buffer) and return an N that holds it: the bytes the
+/// pool took from the buffer plus alignment padding, rounded up to 1 KiB.
+/// Only the limits and strict_booleans of options are used.
+[[nodiscard]] std::size_t recommendArenaSize(ISource &source,
+                                             const Options &options = Options());
+[[nodiscard]] std::size_t recommendArenaSize(ISource &&source,
+                                             const Options &options = Options());
+
+} // namespace YAML_Lib
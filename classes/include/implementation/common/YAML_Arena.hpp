@@ -1,8 +1,13 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <memory_resource>
+#include <string>
+#include <type_traits>
 
 namespace YAML_Lib {
 
@@ -22,8 +27,8 @@ namespace YAML_Lib {
 ///
 /// Constraints:
 ///   - The arena MUST outlive every YAML object that was parsed with it.
-///   - parse() is single-threaded with respect to the PMR default resource;
-///     do NOT parse from multiple threads using the same MonotonicArena.
+///   - The arena is not thread safe; do NOT parse from multiple threads
+///     using the same MonotonicArena.
 ///   - Calling parse() again on the same YAML object with the same arena
 ///     reuses any freed memory in the pool layer.
 ///
@@ -52,4 +57,243 @@ private:
   std::pmr::unsynchronized_pool_resource pool_;
 };
 
+/// ChainedArena — growable PMR arena.
+///
+/// Allocations are bumped out of blocks taken from an upstream resource. When
+/// the current block is full a new one, twice the size of the last, is
+/// chained on, so unlike MonotonicArena a larger than expected input never
+/// fails. deallocate() is a no-op; memory comes back all at once:
+///   - reset() keeps every block and starts bumping from the first again, so
+///     once the arena has grown to its high-water mark, repeated parses of
+///     similar inputs take nothing more from the upstream;
+///   - release() (and the destructor) returns every block to the upstream.
+///
+/// Usage:
+/// @code
+///   ChainedArena arena;                   // 64 KB first block, then 128 KB ...
+///   YAML yaml{arena.resource()};
+///   yaml.parse(BufferSource{yamlText});   // containers allocated from arena
+/// @endcode
+///
+/// Setting Options::arena_tree gives a YAML object its own ChainedArena, which
+/// YAML::reparse() resets before each parse.
+///
+/// Constraints are as for MonotonicArena: the arena must outlive everything
+/// allocated from it and it is not thread safe.
+class ChainedArena final : public std::pmr::memory_resource {
+public:
+  static constexpr std::size_t kDefaultBlockSize{64 * 1024};
+
+  // Snapshot of the arena counters.
+  struct Statistics {
+    std::size_t blocks{};          // blocks held
+    std::size_t capacity{};        // total size of those blocks
+    std::size_t used{};            // bytes handed out since the last reset
+                                   // (alignment padding included)
+    std::size_t highWater{};       // largest used between two resets
+    uint64_t upstreamAllocations{}; // blocks ever taken from the upstream
+    uint64_t deallocations{};       // deallocate() calls (each a no-op)
+    uint64_t resets{};
+  };
+
+  explicit ChainedArena(
+      const std::size_t initialBlockSize = kDefaultBlockSize,
+      std::pmr::memory_resource *upstream = std::pmr::new_delete_resource()) noexcept
+      : upstream_{upstream},
+        initialBlockSize_{std::max(initialBlockSize, sizeof(Block))},
+        nextBlockSize_{initialBlockSize_} {}
+  ~ChainedArena() override { release(); }
+
+  ChainedArena(const ChainedArena &) = delete;
+  ChainedArena &operator=(const ChainedArena &) = delete;
+  ChainedArena(ChainedArena &&) = delete;
+  ChainedArena &operator=(ChainedArena &&) = delete;
+
+  /// Returns the PMR memory_resource backed by this arena.
+  [[nodiscard]] std::pmr::memory_resource *resource() noexcept { return this; }
+  /// Resource the blocks are allocated from.
+  [[nodiscard]] std::pmr::memory_resource *upstream() const noexcept { return upstream_; }
+  /// Total size of the blocks currently held.
+  [[nodiscard]] std::size_t capacity() const noexcept { return statistics_.capacity; }
+  /// Current counters.
+  [[nodiscard]] Statistics getStatistics() const noexcept {
+    Statistics statistics{statistics_};
+    statistics.highWater = std::max(statistics.highWater, statistics.used);
+    return statistics;
+  }
+
+  /// Keep every block but make all of them free again. Anything allocated
+  /// from the arena must no longer be in use.
+  void reset() noexcept {
+    statistics_.highWater = std::max(statistics_.highWater, statistics_.used);
+    statistics_.used = 0;
+    statistics_.resets++;
+    useBlock(first_);
+  }
+  /// Return every block to the upstream resource and start again from the
+  /// initial block size. Anything allocated from the arena must no longer be
+  /// in use.
+  void release() noexcept {
+    while (first_ != nullptr) {
+      Block *const next = first_->next;
+      upstream_->deallocate(first_, first_->size, alignof(std::max_align_t));
+      first_ = next;
+    }
+    useBlock(nullptr);
+    nextBlockSize_ = initialBlockSize_;
+    statistics_.highWater = std::max(statistics_.highWater, statistics_.used);
+    statistics_.used = 0;
+    statistics_.blocks = 0;
+    statistics_.capacity = 0;
+  }
+
+private:
+  // Header at the start of each block; blocks are chained oldest first.
+  struct Block {
+    Block *next;
+    std::size_t size;
+  };
+
+  void *do_allocate(const std::size_t bytes, const std::size_t alignment) override {
+    void *pointer = current_;
+    std::size_t space = static_cast<std::size_t>(end_ - current_);
+    if (current_ == nullptr ||
+        std::align(alignment, bytes, pointer, space) == nullptr) {
+      nextBlock(bytes + alignment);
+      pointer = current_;
+      space = static_cast<std::size_t>(end_ - current_);
+      std::align(alignment, bytes, pointer, space);
+    }
+    std::byte *const next = static_cast<std::byte *>(pointer) + bytes;
+    statistics_.used += static_cast<std::size_t>(next - current_);
+    current_ = next;
+    return pointer;
+  }
+  void do_deallocate(void *, std::size_t, std::size_t) override {
+    statistics_.deallocations++;
+  }
+  [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+  // Bump from the start of block (nothing when block is nullptr).
+  void useBlock(Block *block) noexcept {
+    active_ = block;
+    current_ = block != nullptr ? reinterpret_cast<std::byte *>(block + 1) : nullptr;
+    end_ = block != nullptr ? reinterpret_cast<std::byte *>(block) + block->size : nullptr;
+  }
+  // Move on to a block with room for at least minimumBytes after its header:
+  // the next block kept by reset() if it is big enough, otherwise a new block
+  // from the upstream chained on after the active one.
+  void nextBlock(const std::size_t minimumBytes) {
+    const std::size_t needed = sizeof(Block) + minimumBytes;
+    Block *const retained = active_ != nullptr ? active_->next : first_;
+    if (retained != nullptr && retained->size >= needed) {
+      useBlock(retained);
+      return;
+    }
+    const std::size_t size = std::max(nextBlockSize_, needed);
+    auto *const block = static_cast<Block *>(
+        upstream_->allocate(size, alignof(std::max_align_t)));
+    block->next = retained;
+    block->size = size;
+    (active_ != nullptr ? active_->next : first_) = block;
+    useBlock(block);
+    nextBlockSize_ = size * 2;
+    statistics_.blocks++;
+    statistics_.capacity += size;
+    statistics_.upstreamAllocations++;
+  }
+
+  std::pmr::memory_resource *upstream_;
+  Block *first_{nullptr};
+  Block *active_{nullptr};
+  std::byte *current_{nullptr};
+  std::byte *end_{nullptr};
+  std::size_t initialBlockSize_;
+  std::size_t nextBlockSize_;
+  Statistics statistics_;
+};
+
+/// Resource a parse on this thread builds its tree from (nullptr outside a
+/// parse with Options::memory_resource or Options::arena_tree). It is per
+/// thread rather than the process-wide PMR default so that nodes created by
+/// other threads while a parse runs never end up in that parse's resource.
+inline thread_local std::pmr::memory_resource *treeResource{nullptr};
+
+/// Resource new Node containers and strings are allocated from: the tree
+/// resource of a parse running on this thread, else the PMR default.
+[[nodiscard]] inline std::pmr::memory_resource *nodeResource() noexcept {
+  return treeResource != nullptr ? treeResource : std::pmr::get_default_resource();
+}
+
+/// RAII: make resource (if not nullptr) this thread's tree resource,
+/// restoring the previous one on exit.
+class TreeResourceScope {
+public:
+  explicit TreeResourceScope(std::pmr::memory_resource *resource) noexcept
+      : previous_{treeResource} {
+    if (resource != nullptr) {
+      treeResource = resource;
+    }
+  }
+  ~TreeResourceScope() { treeResource = previous_; }
+  TreeResourceScope(const TreeResourceScope &) = delete;
+  TreeResourceScope &operator=(const TreeResourceScope &) = delete;
+  TreeResourceScope(TreeResourceScope &&) = delete;
+  TreeResourceScope &operator=(TreeResourceScope &&) = delete;
+
+private:
+  std::pmr::memory_resource *previous_;
+};
+
+/// Allocator for strings and containers a parse only needs while it runs
+/// (the parser's scratch strings, alias and tag tables). It takes this
+/// thread's tree resource when it is constructed, so a parse into an arena
+/// or Options::memory_resource makes no global heap allocations, and
+/// otherwise falls back to std::allocator at no extra cost. Copies made
+/// during a parse take the current tree resource; moves and swaps carry
+/// the allocator along with the storage.
+template <typename T> class ScratchAllocator {
+public:
+  using value_type = T;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  ScratchAllocator() noexcept = default;
+  template <typename U>
+  ScratchAllocator(const ScratchAllocator<U> &other) noexcept // NOLINT
+      : resource_{other.resource()} {}
+
+  [[nodiscard]] T *allocate(const std::size_t count) {
+    if (resource_ == nullptr) {
+      return std::allocator<T>{}.allocate(count);
+    }
+    return static_cast<T *>(resource_->allocate(count * sizeof(T), alignof(T)));
+  }
+  void deallocate(T *pointer, const std::size_t count) noexcept {
+    if (resource_ == nullptr) {
+      std::allocator<T>{}.deallocate(pointer, count);
+    } else {
+      resource_->deallocate(pointer, count * sizeof(T), alignof(T));
+    }
+  }
+  [[nodiscard]] ScratchAllocator select_on_container_copy_construction() const noexcept {
+    return ScratchAllocator{};
+  }
+  [[nodiscard]] std::pmr::memory_resource *resource() const noexcept { return resource_; }
+
+  template <typename U>
+  friend bool operator==(const ScratchAllocator &lhs, const ScratchAllocator<U> &rhs) noexcept {
+    return lhs.resource() == rhs.resource() ||
+           (lhs.resource() != nullptr && rhs.resource() != nullptr &&
+            lhs.resource()->is_equal(*rhs.resource()));
+  }
+
+private:
+  std::pmr::memory_resource *resource_{treeResource};
+};
+
+/// String type of the parser's scratch strings.
+using ScratchString = std::basic_string<char, std::char_traits<char>, ScratchAllocator<char>>;
+
 } // namespace YAML_Lib
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace YAML_Lib {
+
+// =============================================================================
+// Binary snapshot format — shared by Binary_Stringify and Binary_Parser.
+//
+// Every document is written as one self-contained frame:
+//
+//   Header   magic "YBIN", format version, byte order, sizeof(long double),
+//            total frame size and the offset of the root node record.
+//   Records  16-byte NodeRecords (type, detail, tag, two payload words).
+//   Tables   child offset tables (Array/Document) and EntryRecord tables
+//            (Dictionary, insertion order) each followed by a uint32_t table
+//            of entry indices sorted by key for binary search lookups.
+//   Strings  uint32_t length + bytes + NUL; identical strings are stored once.
+//
+// All offsets are relative to the start of the frame, so a frame can be
+// mapped anywhere in memory and walked in place without any text scanning.
+// Children are always written after their parent, which lets readers reject
+// cyclic offsets cheaply. Values are stored in host byte order: a snapshot is
+// a reload cache for the YAML text, not an interchange format.
+// =============================================================================
+namespace binary_format {
+
+inline constexpr char kMagic[4]{'Y', 'B', 'I', 'N'};
+inline constexpr uint16_t kVersion{2};
+inline constexpr uint8_t kByteOrder{
+    std::endian::native == std::endian::little ? 1 : 2};
+// Maximum container nesting accepted when decoding a frame.
+inline constexpr unsigned long kMaxNestingDepth{1024};
+
+enum class Type : uint8_t {
+  hole = 0,
+  null,
+  boolean,
+  number,
+  string,
+  timestamp,
+  comment,
+  array,
+  dictionary,
+  document
+};
+
+// Number kinds (match the alternative order of Number::Values).
+enum class NumberKind : uint8_t {
+  none = 0,
+  intValue,
+  longValue,
+  longLongValue,
+  floatValue,
+  doubleValue,
+  longDoubleValue
+};
+
+struct Header {
+  char magic[4];
+  uint16_t version;
+  uint8_t byteOrder;
+  uint8_t longDoubleSize;
+  uint32_t frameSize;
+  uint32_t rootOffset;
+};
+
+// type/detail:
+//   Boolean   detail = Boolean::kForms index, first = value
+//   Number    detail = NumberKind, first = payload offset (int64/double/long
+//             double stored raw)
+//   String    detail = quote character, first = string offset
+//   Timestamp first = string offset
+//   Comment   first = string offset
+//   Array     first = count, second = offset of uint32_t child offsets
+//   Document  first = count, second = offset of uint32_t child offsets
+//   Dictionary first = count, second = offset of EntryRecord table (the
+//             sorted key index follows it directly)
+// tag is a string offset (0 = untagged; offset 0 is always the header).
+struct NodeRecord {
+  Type type;
+  uint8_t detail;
+  uint16_t reserved;
+  uint32_t tag;
+  uint32_t first;
+  uint32_t second;
+};
+
+struct EntryRecord {
+  uint32_t key;
+  uint8_t keyQuote;
+  uint8_t reserved[3];
+  uint32_t node;
+};
+
+static_assert(sizeof(Header) == 16);
+static_assert(sizeof(NodeRecord) == 16);
+static_assert(sizeof(EntryRecord) == 12);
+
+/// Copy a trivially copyable value out of a frame (bounds checked).
+template <typename T> T load(const std::string_view frame, const uint32_t offset) {
+  if (static_cast<std::size_t>(offset) + sizeof(T) > frame.size()) {
+    YAML_THROW(Error, "Binary snapshot offset out of range.");
+  }
+  T value;
+  std::memcpy(&value, frame.data() + offset, sizeof(T));
+  return value;
+}
+
+/// Return a view of a length-prefixed string stored in a frame.
+inline std::string_view loadString(const std::string_view frame,
+                                   const uint32_t offset) {
+  const auto length = load<uint32_t>(frame, offset);
+  if (static_cast<std::size_t>(offset) + sizeof(uint32_t) + length >
+      frame.size()) {
+    YAML_THROW(Error, "Binary snapshot string out of range.");
+  }
+  return frame.substr(offset + sizeof(uint32_t), length);
+}
+
+/// Check that a table of count elements of elementSize bytes starting at
+/// offset lies inside a frame (so untrusted counts can be reserved).
+inline void checkTable(const std::string_view frame, const uint32_t offset,
+                       const uint32_t count, const std::size_t elementSize) {
+  if (offset > frame.size() || count > (frame.size() - offset) / elementSize) {
+    YAML_THROW(Error, "Binary snapshot table out of range.");
+  }
+}
+
+/// Offset of the sorted key index that follows a Dictionary entry table.
+inline uint32_t sortedKeysOffset(const NodeRecord &record) {
+  return record.second + record.first * static_cast<uint32_t>(sizeof(EntryRecord));
+}
+
+/// Validate the header at the start of bytes and return it.
+inline Header loadHeader(const std::string_view bytes) {
+  if (bytes.size() < sizeof(Header)) {
+    YAML_THROW(Error, "Binary snapshot is truncated.");
+  }
+  const auto header = load<Header>(bytes, 0);
+  if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+    YAML_THROW(Error, "Binary snapshot has an invalid signature.");
+  }
+  if (header.version != kVersion) {
+    YAML_THROW(Error, "Binary snapshot version is not supported.");
+  }
+  if (header.byteOrder != kByteOrder ||
+      header.longDoubleSize != sizeof(long double)) {
+    YAML_THROW(Error, "Binary snapshot was written on an incompatible platform.");
+  }
+  if (header.frameSize < sizeof(Header) || header.frameSize > bytes.size() ||
+      header.rootOffset < sizeof(Header) ||
+      header.rootOffset >= header.frameSize) {
+    YAML_THROW(Error, "Binary snapshot is truncated.");
+  }
+  return header;
+}
+
+} // namespace binary_format
+} // namespace YAML_Lib
@@ -0,0 +1,236 @@
+#pragma once
+
+#include "YAML.hpp"
+#include "YAML_Core.hpp"
+#include "YAML_Binary.hpp"
+
+namespace YAML_Lib {
+
+// =============================================================================
+// NodeView / DocumentView — read-only navigation of binary snapshot frames
+// (see YAML_Binary.hpp) directly in the memory that holds them.
+//
+// Nothing is deserialised or allocated: a NodeView is a frame view plus the
+// record offset, strings are returned as views into the snapshot and
+// dictionary keys are found by binary search of each mapping's sorted key
+// table. The snapshot memory (for example a read-only mmap of the file shared
+// by many processes) MUST outlive every view taken from it.
+//
+// Lookups follow the const Node::operator[] semantics and error messages.
+//
+// Usage:
+// @code
+//   DocumentView config{std::string_view{mappedBytes, mappedLength}};
+//   const auto port = config["server"]["port"].getNumber<int>();
+// @endcode
+// =============================================================================
+class NodeView {
+public:
+  NodeView() = default;
+  NodeView(const std::string_view frame, const uint32_t offset)
+      : frame_(frame), offset_(offset),
+        record_(binary_format::load<binary_format::NodeRecord>(frame, offset)) {}
+
+  // Node type queries (same type names as isA<T>() on a Node)
+  [[nodiscard]] binary_format::Type getType() const { return record_.type; }
+  template <typename T> [[nodiscard]] bool is() const {
+    return record_.type == typeOf<T>();
+  }
+  // Tag (empty when untagged)
+  [[nodiscard]] std::string_view getTag() const {
+    return record_.tag != 0 ? binary_format::loadString(frame_, record_.tag)
+                            : std::string_view{};
+  }
+  // String, Timestamp or Comment contents (viewed in place)
+  [[nodiscard]] std::string_view getString() const {
+    if (!is<String>() && !is<Timestamp>() && !is<Comment>()) {
+      YAML_THROW(Node::Error, "Node not a string.");
+    }
+    return binary_format::loadString(frame_, record_.first);
+  }
+  // Quote character of a String
+  [[nodiscard]] char getQuote() const {
+    check<String>("Node not a string.");
+    return static_cast<char>(record_.detail);
+  }
+  [[nodiscard]] bool getBoolean() const {
+    check<Boolean>("Node not a boolean.");
+    return record_.first != 0;
+  }
+  // Number converted to T (as Number::value<T>())
+  template <typename T> [[nodiscard]] T getNumber() const {
+    using binary_format::NumberKind;
+    check<Number>("Node not a number.");
+    switch (static_cast<NumberKind>(record_.detail)) {
+    case NumberKind::intValue:
+    case NumberKind::longValue:
+    case NumberKind::longLongValue:
+      return static_cast<T>(binary_format::load<int64_t>(frame_, record_.first));
+    case NumberKind::floatValue:
+    case NumberKind::doubleValue:
+      return static_cast<T>(binary_format::load<double>(frame_, record_.first));
+    case NumberKind::longDoubleValue:
+      return static_cast<T>(
+          binary_format::load<long double>(frame_, record_.first));
+    default:
+      YAML_THROW(Node::Error, "Could not convert unknown type.");
+    }
+  }
+  // Number of entries in an Array, Dictionary or Document (0 for scalars)
+  [[nodiscard]] std::size_t size() const {
+    return is<Array>() || is<Dictionary>() || is<Document>() ? record_.first : 0;
+  }
+  // Dictionary entry access in insertion order
+  [[nodiscard]] std::string_view getKey(const std::size_t index) const {
+    return binary_format::loadString(frame_, entry(index).key);
+  }
+  [[nodiscard]] char getKeyQuote(const std::size_t index) const {
+    return static_cast<char>(entry(index).keyQuote);
+  }
+  [[nodiscard]] NodeView getValue(const std::size_t index) const {
+    return child(entry(index).node);
+  }
+  // Return true if a dictionary contains a given key
+  [[nodiscard]] bool contains(const std::string_view &key) const {
+    return is<Dictionary>() && findKey(key) != kNotFound;
+  }
+  // Indexing operators
+  [[nodiscard]] NodeView operator[](const std::string_view &key) const {
+    check<Dictionary>("Node not an dictionary.");
+    const auto index = findKey(key);
+    if (index == kNotFound) {
+      YAML_THROW(Node::Error, "Invalid key used to access dictionary.");
+    }
+    return getValue(index);
+  }
+  [[nodiscard]] NodeView operator[](const std::size_t index) const {
+    if (!is<Array>() && !is<Document>()) {
+      YAML_THROW(Node::Error, "Not an array or document to index.");
+    }
+    if (index >= record_.first) {
+      YAML_THROW(Node::Error, is<Array>()
+                                  ? "Invalid index used to access array."
+                                  : "Invalid index used to access document.");
+    }
+    return child(binary_format::load<uint32_t>(
+        frame_, static_cast<uint32_t>(record_.second + index * sizeof(uint32_t))));
+  }
+
+private:
+  static constexpr std::size_t kNotFound{static_cast<std::size_t>(-1)};
+
+  template <typename T> static consteval binary_format::Type typeOf() {
+    using binary_format::Type;
+    if constexpr (std::is_same_v<T, String>)          return Type::string;
+    else if constexpr (std::is_same_v<T, Number>)     return Type::number;
+    else if constexpr (std::is_same_v<T, Array>)      return Type::array;
+    else if constexpr (std::is_same_v<T, Dictionary>) return Type::dictionary;
+    else if constexpr (std::is_same_v<T, Boolean>)    return Type::boolean;
+    else if constexpr (std::is_same_v<T, Null>)       return Type::null;
+    else if constexpr (std::is_same_v<T, Hole>)       return Type::hole;
+    else if constexpr (std::is_same_v<T, Comment>)    return Type::comment;
+    else if constexpr (std::is_same_v<T, Document>)   return Type::document;
+    else if constexpr (std::is_same_v<T, Timestamp>)  return Type::timestamp;
+  }
+  template <typename T> void check(const char *message) const {
+    if (!is<T>()) {
+      YAML_THROW(Node::Error, message);
+    }
+  }
+  [[nodiscard]] NodeView child(const uint32_t offset) const {
+    // Children are always written after their parent (no cycles possible).
+    if (offset <= offset_) {
+      YAML_THROW(Error, "Binary snapshot contains an invalid node offset.");
+    }
+    return {frame_, offset};
+  }
+  [[nodiscard]] binary_format::EntryRecord entry(const std::size_t index) const {
+    check<Dictionary>("Node not an dictionary.");
+    if (index >= record_.first) {
+      YAML_THROW(Node::Error, "Invalid index used to access dictionary.");
+    }
+    return binary_format::load<binary_format::EntryRecord>(
+        frame_, static_cast<uint32_t>(
+                    record_.second + index * sizeof(binary_format::EntryRecord)));
+  }
+  [[nodiscard]] uint32_t sortedEntry(const std::size_t position) const {
+    return binary_format::load<uint32_t>(
+        frame_, static_cast<uint32_t>(binary_format::sortedKeysOffset(record_) +
+                                      position * sizeof(uint32_t)));
+  }
+  // Binary search of the sorted key table; the last of any duplicate keys
+  // wins, matching the Dictionary hash index.
+  [[nodiscard]] std::size_t findKey(const std::string_view &key) const {
+    std::size_t low = 0;
+    std::size_t high = record_.first;
+    while (low < high) { // upper bound
+      const std::size_t middle = low + (high - low) / 2;
+      if (key < getKey(sortedEntry(middle))) {
+        high = middle;
+      } else {
+        low = middle + 1;
+      }
+    }
+    if (low > 0) {
+      const auto index = sortedEntry(low - 1);
+      if (getKey(index) == key) {
+        return index;
+      }
+    }
+    return kNotFound;
+  }
+
+  std::string_view frame_;
+  uint32_t offset_{};
+  binary_format::NodeRecord record_{};
+};
+
+// What is NodeView ? (mirror of isA<T>() for Node)
+template <typename T> bool isA(const NodeView &yNodeView) {
+  return yNodeView.is<T>();
+}
+
+class DocumentView {
+public:
+  // Construct over a snapshot of one or more frames; only headers are checked.
+  explicit DocumentView(const std::string_view snapshot) : snapshot_(snapshot) {
+    for (std::string_view bytes{snapshot_}; !bytes.empty();) {
+      bytes.remove_prefix(binary_format::loadHeader(bytes).frameSize);
+      documentCount_++;
+    }
+  }
+  DocumentView(const DocumentView &other) = default;
+  DocumentView &operator=(const DocumentView &other) = default;
+  ~DocumentView() = default;
+
+  // Get number of documents
+  [[nodiscard]] std::size_t getNumberOfDocuments() const {
+    return documentCount_;
+  }
+  // Root node of a document (as YAML::document())
+  [[nodiscard]] NodeView document(const std::size_t index) const {
+    if (index >= documentCount_) {
+      YAML_THROW(Error, "Document does not exist.");
+    }
+    std::string_view bytes{snapshot_};
+    for (std::size_t skipped = 0; skipped < index; ++skipped) {
+      bytes.remove_prefix(binary_format::loadHeader(bytes).frameSize);
+    }
+    const auto header = binary_format::loadHeader(bytes);
+    const NodeView root{bytes.substr(0, header.frameSize), header.rootOffset};
+    return root.is<Document>() ? root[0] : root;
+  }
+  // Indexing operators on the first document
+  [[nodiscard]] NodeView operator[](const std::string_view &key) const {
+    return document(0)[key];
+  }
+  [[nodiscard]] NodeView operator[](const std::size_t index) const {
+    return document(0)[index];
+  }
+
+private:
+  std::string_view snapshot_;
+  std::size_t documentCount_{};
+};
+
+} // namespace YAML_Lib
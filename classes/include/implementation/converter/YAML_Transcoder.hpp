@@ -0,0 +1,43 @@
+#pragma once
+
+namespace YAML_Lib {
+
+// -----------------------------------------------------------------------
+// Transcoder — validating UTF-8 <-> UTF-16 <-> UTF-32 conversion without
+// any platform conversion facet. Runs of ASCII take a fast path (eight
+// UTF-8 bytes tested per step); everything else is decoded to a code
+// point and re-encoded, rejecting malformed sequences, overlong forms,
+// unpaired surrogates and code points above U+10FFFF with an Error.
+//
+// The byte-oriented decodeUtf16()/decodeUtf32() read encoded file data
+// in either byte order and may be called block by block: with final set
+// to false an incomplete trailing unit (or a high surrogate still waiting
+// for its pair) is left unconsumed for the next call.
+//
+// appendUtf8()/decodeUtf8() encode and decode a single code point; the
+// translators and JSON_Parser use them for their escape sequences.
+// -----------------------------------------------------------------------
+
+// One code point <-> UTF-8 (decodeUtf8 moves index past the sequence)
+void appendUtf8(std::string &utf8, char32_t codePoint);
+[[nodiscard]] char32_t decodeUtf8(const std::string_view &utf8,
+                                  std::size_t &index);
+
+// UTF-16 code units <-> UTF-8
+void utf8ToUtf16(const std::string_view &utf8, std::u16string &utf16);
+void utf16ToUtf8(const std::u16string_view &utf16, std::string &utf8);
+// UTF-32 code points <-> UTF-8
+[[nodiscard]] std::u32string toUtf32(const std::string_view &utf8);
+[[nodiscard]] std::string toUtf8(const std::u32string_view &utf32);
+// Byte encoded UTF-16/UTF-32 -> UTF-8; returns the number of bytes consumed.
+std::size_t decodeUtf16(const std::string_view &bytes, std::endian order,
+                        std::string &utf8, bool final = true);
+std::size_t decodeUtf32(const std::string_view &bytes, std::endian order,
+                        std::string &utf8, bool final = true);
+// UTF-8 -> byte encoded UTF-16/UTF-32 (appended, no byte order mark).
+void encodeUtf16(const std::string_view &utf8, std::endian order,
+                 std::string &bytes);
+void encodeUtf32(const std::string_view &utf8, std::endian order,
+                 std::string &bytes);
+
+} // namespace YAML_Lib
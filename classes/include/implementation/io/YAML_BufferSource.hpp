@@ -35,6 +35,9 @@ protected:
   [[nodiscard]] const char *endOfInputMessage() const noexcept override {
     return "Tried to read past and of buffer.";
   }
+  [[nodiscard]] std::string_view contents() const noexcept override {
+    return bufferView;
+  }
 
 private:
   std::string      ownedBuffer; // non-empty only when constructed from rvalue std::string
@@ -6,16 +6,18 @@ namespace YAML_Lib {
 // BufferedSourceBase — shared implementation for contiguous-buffer ISource types.
 //
 // Provides concrete implementations of next(), save(), restore(), discardSave(),
-// reset(), position(), and backup() for any source backed by a flat byte buffer
-// accessed via bufferPosition (index into a contiguous block of memory).
+// reset(), position(), backup(), remaining() and skip() for any source backed
+// by a flat byte buffer accessed via bufferPosition (index into a contiguous
+// block of memory).
 //
 // Concrete subclasses only need to supply:
 //   - current() const override   — return byte at bufferPosition (or EOF when done)
 //   - more()    const override   — return (bufferPosition < bufferSize)
 //   - endOfInputMessage() const  — string literal for the "read past end" error
+//   - contents() const           — view of the whole backing buffer
 //
 // Shared across: BufferSource, SpanSource, FileSource.
-// NOT used by: StreamSource (its next()/reset() use std::istream seekg/get).
+// NOT used by: StreamSource (it buffers a sliding window of a std::istream).
 // =============================================================================
 class BufferedSourceBase : public ISource {
 public:
@@ -73,6 +75,19 @@ public:
 
   void discardSave() override { contexts.pop_back(); }
 
+  [[nodiscard]] std::string_view remaining() const override {
+    const std::string_view buffer{contents()};
+    return buffer.substr(std::min(bufferPosition, buffer.size()));
+  }
+
+  void skip(const std::size_t length) override {
+    if (length > remaining().size()) {
+      YAML_THROW(Error, endOfInputMessage());
+    }
+    bufferPosition += length;
+    column         += static_cast<long>(length);
+  }
+
 protected:
   void backup(const unsigned long length) override {
     if (static_cast<long>(column) - static_cast<long>(length) < 1) {
@@ -84,6 +99,9 @@ protected:
 
   /// Subclass supplies the "read past end" error message (string literal).
   [[nodiscard]] virtual const char *endOfInputMessage() const noexcept = 0;
+
+  /// Subclass supplies the whole backing buffer (for remaining()/skip()).
+  [[nodiscard]] virtual std::string_view contents() const noexcept = 0;
 };
 
 } // namespace YAML_Lib
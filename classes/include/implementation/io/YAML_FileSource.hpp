@@ -49,6 +49,9 @@ protected:
   [[nodiscard]] const char *endOfInputMessage() const noexcept override {
     return "Tried to read past end of file.";
   }
+  [[nodiscard]] std::string_view contents() const noexcept override {
+    return buffer;
+  }
 
 private:
   std::string buffer;
@@ -6,4 +6,7 @@
 #include "YAML_FileSource.hpp"
 #endif
 #include "YAML_StreamSource.hpp"
+#ifdef YAML_LIB_FILE_IO
+#include "YAML_TranscodingSource.hpp"
+#endif
 #include "YAML_SpanSource.hpp"
\ No newline at end of file
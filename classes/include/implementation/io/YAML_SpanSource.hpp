@@ -54,6 +54,9 @@ protected:
   [[nodiscard]] const char *endOfInputMessage() const noexcept override {
     return "Tried to read past end of span.";
   }
+  [[nodiscard]] std::string_view contents() const noexcept override {
+    return std::string_view{data_, len_};
+  }
 
 private:
   const char *data_;
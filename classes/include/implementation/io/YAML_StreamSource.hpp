@@ -3,24 +3,51 @@
 namespace YAML_Lib {
 
 // ======================================================================
-// StreamSource — ISource backed by any seekable std::istream.
+// StreamSource — ISource backed by any std::istream.
 //
-// Allows parsing YAML from std::istringstream, std::ifstream, or any
-// other seekable C++ input stream.  Requires the stream to support
-// seekg/tellg (e.g. std::istringstream, std::ifstream opened in binary
-// mode).  Non-seekable streams such as std::cin are not supported
-// because save()/restore()/backup() require random access.
+// Allows parsing YAML from std::istringstream, std::ifstream, std::cin,
+// pipes or any other C++ input stream.  The stream is read in chunks
+// (kDefaultChunkSize bytes by default) into a sliding window; CR/LF and
+// bare CR are normalised to LF as each chunk arrives.  Bytes before the
+// oldest saved context (and a short backup history) are dropped when
+// the window is refilled, so save()/restore() never touch the stream
+// and non-seekable streams are supported.
+//
+// Because the stream is read ahead, its get position after parsing is
+// not the end of the parsed text.  reset() only needs the stream to be
+// seekable once the start of the input has left the window.
+//
+// Given a YAML::Format other than utf8 the stream is taken to be in that
+// encoding: UTF-16/UTF-32 chunks are decoded to UTF-8 as they are read
+// (a character split across chunks waits for the next read) and a
+// leading byte order mark is skipped, so memory use stays bounded by the
+// window whatever the encoding.
 //
 // Usage:
 //   std::istringstream ss{"key: value\n"};
 //   yaml.parse(StreamSource{ss});
 // ======================================================================
-class StreamSource final : public ISource {
+class StreamSource : public ISource {
 public:
-  explicit StreamSource(std::istream &stream) : stream(stream) {
+  // Bytes requested from the stream per read.
+  static constexpr std::size_t kDefaultChunkSize{64 * 1024};
+  // Bytes kept behind the current position for backup().
+  static constexpr std::size_t kBackupHistory{256};
+
+  explicit StreamSource(std::istream &stream,
+                        const std::size_t chunkSize = kDefaultChunkSize)
+      : StreamSource(stream, YAML::Format::utf8, chunkSize) {}
+  StreamSource(std::istream &stream, const YAML::Format format,
+               const std::size_t chunkSize = kDefaultChunkSize)
+      : stream(stream), chunkSize(chunkSize), format(format) {
     if (!stream.good()) {
       YAML_THROW(Error, "Stream is not in a good state.");
     }
+    if (chunkSize == 0) {
+      YAML_THROW(Error, "Stream chunk size must be greater than zero.");
+    }
+    startPosition = stream.tellg();
+    start();
   }
   StreamSource() = delete;
   StreamSource(const StreamSource &) = delete;
@@ -30,7 +57,10 @@ public:
   ~StreamSource() override = default;
 
   [[nodiscard]] char current() const override {
-    return static_cast<char>(stream.peek());
+    if (more()) {
+      return window[bufferPosition - windowStart];
+    }
+    return EOF;
   }
 
   void next() override {
@@ -43,44 +73,38 @@ public:
     if (!more()) {
       YAML_THROW(Error, "Tried to read past end of stream.");
     }
-    stream.get();
-    // Capture the stream position BEFORE current() (peek()) can set eofbit.
-    // Once peek() triggers EOF the stream returns tellg() == -1.
-    {
-      const auto pos = stream.tellg();
-      if (pos != static_cast<std::streampos>(-1)) {
-        bufferPosition = static_cast<std::size_t>(pos);
-      }
-    }
-    if (current() == kCarriageReturn) {
-      if (more()) {
-        stream.get();
-        if (current() != kLineFeed) {
-          stream.unget();
-        }
-      }
+    bufferPosition++;
+    if (bufferPosition - windowStart == window.size()) {
+      fill();
     }
   }
 
-  [[nodiscard]] bool more() const override { return stream.peek() != EOF; }
+  [[nodiscard]] bool more() const override {
+    return bufferPosition - windowStart < window.size();
+  }
 
   void reset() override {
     lineNo = 1;
     column = 1;
-    stream.clear();
-    stream.seekg(0, std::ios_base::beg);
     bufferPosition = 0;
-  }
-
-  [[nodiscard]] std::size_t position() override {
-    if (more()) {
-      bufferPosition = static_cast<std::size_t>(stream.tellg());
+    if (windowStart == 0) {
+      return;
     }
-    return bufferPosition;
+    if (startPosition == static_cast<std::streampos>(-1)) {
+      YAML_THROW(Error, "Cannot reset a non-seekable stream.");
+    }
+    stream.clear();
+    stream.seekg(startPosition);
+    window.clear();
+    windowStart = 0;
+    skipLineFeed = false;
+    undecoded.clear();
+    start();
   }
 
+  [[nodiscard]] std::size_t position() override { return bufferPosition; }
+
   void save() override {
-    bufferPosition = static_cast<std::size_t>(stream.tellg());
     contexts.push_back(Context(lineNo, column, bufferPosition));
   }
 
@@ -89,29 +113,123 @@ public:
     contexts.pop_back();
     lineNo = context.lineNo;
     column = context.column;
-    if (stream.eof()) {
-      stream.clear();
-    }
-    stream.seekg(static_cast<std::streamoff>(context.bufferPosition),
-                 std::ios_base::beg);
-    bufferPosition = static_cast<std::size_t>(stream.tellg());
-  }
-  void discardSave() override {
-    contexts.pop_back();
+    bufferPosition = context.bufferPosition;
   }
+  void discardSave() override { contexts.pop_back(); }
 
 protected:
+  // For sources that own their stream (see TranscodingSource).
+  StreamSource(std::unique_ptr<std::istream> owned, const YAML::Format format,
+               const std::size_t chunkSize)
+      : ownedStream(std::move(owned)), stream(*ownedStream),
+        chunkSize(chunkSize), format(format) {
+    if (!stream.good()) {
+      YAML_THROW(Error, "Stream is not in a good state.");
+    }
+    if (chunkSize == 0) {
+      YAML_THROW(Error, "Stream chunk size must be greater than zero.");
+    }
+    startPosition = stream.tellg();
+    start();
+  }
+
   void backup(const unsigned long length) override {
-    if (column - length < 1) {
+    if (static_cast<long>(column) - static_cast<long>(length) < 1) {
       YAML_THROW(Error, "Backup past start column.");
     }
-    stream.clear();
-    stream.seekg(-static_cast<long>(length), std::ios_base::cur);
+    if (length > bufferPosition - windowStart) {
+      YAML_THROW(Error, "Backup past start of stream buffer.");
+    }
+    bufferPosition -= length;
     column -= length;
   }
 
 private:
+  // Byte order mark (U+FEFF) once decoded to UTF-8.
+  static constexpr std::string_view kByteOrderMark{"\xEF\xBB\xBF"};
+
+  // Fill the window from the start of the stream, dropping any byte order
+  // mark of an encoded stream.
+  void start() {
+    if (format != YAML::Format::utf8) {
+      while (window.size() < kByteOrderMark.size() && stream.good()) {
+        readChunk();
+      }
+      if (window.starts_with(kByteOrderMark)) {
+        window.erase(0, kByteOrderMark.size());
+      }
+    }
+    fill();
+  }
+  // Drop bytes no saved context or backup() can reach, then append the
+  // next chunk(s) from the stream until at least one new byte is
+  // available or the stream is exhausted.
+  void fill() {
+    std::size_t keep =
+        bufferPosition - std::min(bufferPosition - windowStart, kBackupHistory);
+    for (const auto &context : contexts) {
+      keep = std::min(keep, context.bufferPosition);
+    }
+    if (keep > windowStart) {
+      window.erase(0, keep - windowStart);
+      windowStart = keep;
+    }
+    while (!more() && stream.good()) {
+      readChunk();
+    }
+  }
+  // Append the next chunk of the stream to the window as UTF-8.
+  void readChunk() {
+    const std::size_t start = window.size();
+    if (format == YAML::Format::utf8 || format == YAML::Format::utf8BOM) {
+      window.resize(start + chunkSize);
+      stream.read(window.data() + start, static_cast<std::streamsize>(chunkSize));
+      window.resize(start + static_cast<std::size_t>(stream.gcount()));
+    } else {
+      const std::size_t held = undecoded.size();
+      undecoded.resize(held + chunkSize);
+      stream.read(undecoded.data() + held, static_cast<std::streamsize>(chunkSize));
+      undecoded.resize(held + static_cast<std::size_t>(stream.gcount()));
+      const auto order = format == YAML::Format::utf16BE || format == YAML::Format::utf32BE
+                             ? std::endian::big
+                             : std::endian::little;
+      const bool final = !stream.good();
+      undecoded.erase(0, format == YAML::Format::utf16BE || format == YAML::Format::utf16LE
+                             ? decodeUtf16(undecoded, order, window, final)
+                             : decodeUtf32(undecoded, order, window, final));
+    }
+    // Normalise CR/LF and bare CR → LF in place (output never outgrows input)
+    std::size_t out = start;
+    for (std::size_t in = start; in < window.size(); ++in) {
+      char ch = window[in];
+      if (skipLineFeed) {
+        skipLineFeed = false;
+        if (ch == kLineFeed) {
+          continue;
+        }
+      }
+      if (ch == kCarriageReturn) {
+        ch = kLineFeed;
+        skipLineFeed = true;
+      }
+      window[out++] = ch;
+    }
+    window.resize(out);
+  }
+
+  // Set when the source owns its stream; declared before stream.
+  std::unique_ptr<std::istream> ownedStream;
   std::istream &stream;
+  std::size_t chunkSize;
+  YAML::Format format;
+  std::streampos startPosition;
+  // Buffered bytes; window[0] is at source offset windowStart.
+  std::string window;
+  std::size_t windowStart{};
+  // Last chunk ended in CR, so a leading LF in the next one is dropped.
+  bool skipLineFeed{};
+  // UTF-16/UTF-32 bytes read but not yet decoded (a split character).
+  std::string undecoded;
 };
 
 } // namespace YAML_Lib
@@ -0,0 +1,40 @@
+#pragma once
+
+namespace YAML_Lib {
+
+// ======================================================================
+// TranscodingSource — ISource for a YAML file in any YAML::Format.
+//
+// The encoding is detected from the file's byte order mark (as
+// YAML::getFileFormat() reports it) and the file is read through a
+// StreamSource in that format, so UTF-16 and UTF-32 files are decoded to
+// UTF-8 a chunk at a time as the parser consumes them. Unlike FileSource
+// (or YAML::fromFile()) the file is never held in memory as a whole.
+//
+// Usage:
+//   yaml.parse(TranscodingSource{"utf16le.yaml"});
+// ======================================================================
+class TranscodingSource final : public StreamSource {
+public:
+  explicit TranscodingSource(const std::string_view &fileName,
+                             const std::size_t chunkSize = kDefaultChunkSize)
+      : StreamSource(openFile(fileName), YAML::getFileFormat(fileName),
+                     chunkSize) {}
+  TranscodingSource() = delete;
+  TranscodingSource(const TranscodingSource &) = delete;
+  TranscodingSource &operator=(const TranscodingSource &) = delete;
+  TranscodingSource(TranscodingSource &&) = delete;
+  TranscodingSource &operator=(TranscodingSource &&) = delete;
+  ~TranscodingSource() override = default;
+
+private:
+  static std::unique_ptr<std::istream> openFile(const std::string_view &fileName) {
+    auto file = std::make_unique<std::ifstream>(fileName.data(), std::ios_base::binary);
+    if (!file->is_open()) {
+      YAML_THROW(Error, "File input stream failed to open or does not exist.");
+    }
+    return file;
+  }
+};
+
+} // namespace YAML_Lib
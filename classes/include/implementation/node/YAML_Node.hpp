@@ -2,19 +2,31 @@
 
 namespace YAML_Lib {
 
-// Forward declarations for container types (stored via unique_ptr in NodeVariant)
+// Forward declarations for container types (stored via NodePointer in NodeVariant)
 struct Array;
 struct Dictionary;
 struct Document;
 
-// NodeVariant: scalars stored inline, containers via unique_ptr to avoid
+// Deleter for container nodes. A container is allocated from nodeResource()
+// when Node::make created it (the parse arena if one is installed) and is
+// returned to that same resource. Deeply nested containers
+// are queued and destroyed in a loop rather than by recursion, so tearing
+// down a deep tree uses bounded stack (body defined in
+// YAML_Node_Reference.hpp).
+template <typename T> struct NodeDeleter {
+  std::pmr::memory_resource *resource{std::pmr::new_delete_resource()};
+  void operator()(T *container) const noexcept;
+};
+template <typename T> using NodePointer = std::unique_ptr<T, NodeDeleter<T>>;
+
+// NodeVariant: scalars stored inline, containers via NodePointer to avoid
 // circular sizeof dependency (Array/Document contain vector<Node>).
 using NodeVariant = std::variant<
     std::monostate,            // empty / "hole" sentinel
     Boolean, Null, Number, String, Timestamp, Comment, Hole,
-    std::unique_ptr<Array>,
-    std::unique_ptr<Dictionary>,
-    std::unique_ptr<Document>>;
+    NodePointer<Array>,
+    NodePointer<Dictionary>,
+    NodePointer<Document>>;
 
 struct Node {
   // Node Error
@@ -47,16 +59,26 @@ struct Node {
   [[nodiscard]] const NodeVariant &getVariant() const { return yNodeVariant; }
   // Tag access (was on Variant base class; now lives here)
   [[nodiscard]] std::string_view getTag() const { return yamlTag; }
-  void setTag(const std::string_view &tag) { yamlTag = std::string(tag); }
+  void setTag(const std::string_view &tag) { yamlTag = tag; }
   // String conversion helpers (bodies defined in YAML_Node_Reference.hpp)
   [[nodiscard]] std::string toString() const;
   [[nodiscard]] std::string toKey() const;
-  // Make Node — scalars stored inline, containers via unique_ptr
+  // Deep copy (body defined in YAML_Node_Reference.hpp)
+  [[nodiscard]] Node clone() const;
+  // Make Node — scalars stored inline, containers allocated from
+  // nodeResource() and held by NodePointer
   template <typename T, typename... Args> static Node make(Args &&...args) {
     Node n;
     if constexpr (std::is_same_v<T, Array> || std::is_same_v<T, Dictionary> ||
                   std::is_same_v<T, Document>) {
-      n.yNodeVariant = std::make_unique<T>(std::forward<Args>(args)...);
+      std::pmr::memory_resource *resource = nodeResource();
+      void *memory;
+      {
+        AllocationScope scope{AllocationKind::containers};
+        memory = resource->allocate(sizeof(T), alignof(T));
+      }
+      n.yNodeVariant = NodePointer<T>(::new (memory) T(std::forward<Args>(args)...),
+                                      NodeDeleter<T>{resource});
     } else {
       n.yNodeVariant = T(std::forward<Args>(args)...);
     }
@@ -65,6 +87,6 @@ struct Node {
 
 private:
   NodeVariant yNodeVariant;
-  std::string yamlTag;
+  std::pmr::string yamlTag{nodeResource()};
 };
 } // namespace YAML_Lib
\ No newline at end of file
@@ -8,7 +8,7 @@ namespace YAML_Lib {
 template <typename T> bool isA(const Node &yNode) {
   if constexpr (std::is_same_v<T, Array> || std::is_same_v<T, Dictionary> ||
                 std::is_same_v<T, Document>) {
-    return std::holds_alternative<std::unique_ptr<T>>(yNode.getVariant());
+    return std::holds_alternative<NodePointer<T>>(yNode.getVariant());
   } else {
     return std::holds_alternative<T>(yNode.getVariant());
   }
@@ -46,7 +46,7 @@ template <typename T> T &NRef(Node &yNode) {
   checkNode<T>(yNode);
   if constexpr (std::is_same_v<T, Array> || std::is_same_v<T, Dictionary> ||
                 std::is_same_v<T, Document>) {
-    return *std::get<std::unique_ptr<T>>(yNode.getVariant());
+    return *std::get<NodePointer<T>>(yNode.getVariant());
   } else {
     return std::get<T>(yNode.getVariant());
   }
@@ -55,7 +55,7 @@ template <typename T> const T &NRef(const Node &yNode) {
   checkNode<T>(yNode);
   if constexpr (std::is_same_v<T, Array> || std::is_same_v<T, Dictionary> ||
                 std::is_same_v<T, Document>) {
-    return *std::get<std::unique_ptr<T>>(yNode.getVariant());
+    return *std::get<NodePointer<T>>(yNode.getVariant());
   } else {
     return std::get<T>(yNode.getVariant());
   }
@@ -64,7 +64,7 @@ template <typename T> T &NRef(Dictionary::Entry &yNodeEntry) {
   checkNode<T>(yNodeEntry.getNode());
   if constexpr (std::is_same_v<T, Array> || std::is_same_v<T, Dictionary> ||
                 std::is_same_v<T, Document>) {
-    return *std::get<std::unique_ptr<T>>(yNodeEntry.getNode().getVariant());
+    return *std::get<NodePointer<T>>(yNodeEntry.getNode().getVariant());
   } else {
     return std::get<T>(yNodeEntry.getNode().getVariant());
   }
@@ -73,7 +73,7 @@ template <typename T> const T &NRef(const Dictionary::Entry &yNodeEntry) {
   checkNode<T>(yNodeEntry.getNode());
   if constexpr (std::is_same_v<T, Array> || std::is_same_v<T, Dictionary> ||
                 std::is_same_v<T, Document>) {
-    return *std::get<std::unique_ptr<T>>(yNodeEntry.getNode().getVariant());
+    return *std::get<NodePointer<T>>(yNodeEntry.getNode().getVariant());
   } else {
     return std::get<T>(yNodeEntry.getNode().getVariant());
   }
@@ -90,7 +90,7 @@ namespace detail {
 enum class TextMode { ToString, ToKey };
 
 template <typename T>
-inline std::string pointerContainerToKey(const std::unique_ptr<T> &p) {
+inline std::string pointerContainerToKey(const NodePointer<T> &p) {
   if constexpr (std::is_same_v<T, Document>) {
     return "";
   } else {
@@ -102,7 +102,7 @@ template <TextMode Mode>
 struct NodeTextVisitor {
   std::string operator()(const std::monostate &) const { return ""; }
   template <typename T>
-  std::string operator()(const std::unique_ptr<T> &p) const {
+  std::string operator()(const NodePointer<T> &p) const {
     return pointerContainerToKey(p);
   }
   template <typename T> std::string operator()(const T &v) const {
@@ -144,8 +144,78 @@ inline std::string dictionaryToKey(const std::size_t count,
   result += kRightCurlyBrace;
   return result;
 }
+// Container being torn down by NodeDeleter and the resource it came from.
+struct PendingContainer {
+  void *container;
+  std::pmr::memory_resource *resource;
+  void (*destroy)(void *container, std::pmr::memory_resource *resource);
+};
+// Containers nested deeper than this below the one a NodeDeleter was called
+// for are queued rather than destroyed recursively.
+inline constexpr unsigned kDestroyDepthLimit{64};
+// Depth of the NodeDeleter calls active on this thread, and the worklist of
+// the outermost one (nullptr when no container is being destroyed).
+inline thread_local unsigned destroyDepth{0};
+inline thread_local std::vector<PendingContainer> *pendingContainers{nullptr};
+
+template <typename T>
+void destroyContainer(void *container, std::pmr::memory_resource *resource) {
+  static_cast<T *>(container)->~T();
+  resource->deallocate(container, sizeof(T), alignof(T));
+}
+
+// Copy of a node without its children: scalars are copied, containers are
+// created empty (NodePointer is not copyable) for Node::clone() to fill.
+struct NodeShellVisitor {
+  Node operator()(const std::monostate &) const { return Node(); }
+  template <typename T> Node operator()(const NodePointer<T> &container) const {
+    return container ? Node::make<T>() : Node();
+  }
+  template <typename T> Node operator()(const T &scalar) const {
+    return Node::make<T>(scalar);
+  }
+};
+inline Node cloneShell(const Node &source) {
+  Node target = std::visit(NodeShellVisitor{}, source.getVariant());
+  if (!source.getTag().empty()) {
+    target.setTag(source.getTag());
+  }
+  return target;
+}
+inline bool isContainer(const Node &yNode) {
+  return isA<Array>(yNode) || isA<Dictionary>(yNode) || isA<Document>(yNode);
+}
 } // namespace detail
 
+// NodeDeleter<T>::operator() — shallow trees are destroyed recursively as
+// usual; a container kDestroyDepthLimit levels down is queued on the
+// outermost deleter's worklist instead, and each queued subtree is destroyed
+// from there with the depth reset, so stack use stays bounded however deep
+// the tree is.
+template <typename T>
+void NodeDeleter<T>::operator()(T *container) const noexcept {
+  if (detail::destroyDepth == detail::kDestroyDepthLimit) {
+    detail::pendingContainers->push_back(
+        {container, resource, &detail::destroyContainer<T>});
+    return;
+  }
+  if (detail::destroyDepth++ != 0) {
+    detail::destroyContainer<T>(container, resource);
+    --detail::destroyDepth;
+    return;
+  }
+  std::vector<detail::PendingContainer> pending;
+  detail::pendingContainers = &pending;
+  detail::destroyContainer<T>(container, resource);
+  while (!pending.empty()) {
+    const auto next = pending.back();
+    pending.pop_back();
+    next.destroy(next.container, next.resource);
+  }
+  detail::pendingContainers = nullptr;
+  detail::destroyDepth = 0;
+}
+
 inline std::string Node::toString() const {
   return std::visit(detail::NodeTextVisitor<detail::TextMode::ToString>{}, yNodeVariant);
 }
@@ -153,6 +223,56 @@ inline std::string Node::toKey() const {
   return std::visit(detail::NodeTextVisitor<detail::TextMode::ToKey>{}, yNodeVariant);
 }
 
+// Node::clone() — deep copy built from a worklist rather than by recursion,
+// so cloning a very deeply nested tree uses bounded stack. Each container is
+// reserved to its source's size and then filled, after which its children
+// stay put and are queued to be filled in turn. New containers and strings
+// come from nodeResource(), as with Node::make.
+inline Node Node::clone() const {
+  Node root = detail::cloneShell(*this);
+  std::vector<std::pair<const Node *, Node *>> pending;
+  if (detail::isContainer(root)) {
+    pending.emplace_back(this, &root);
+  }
+  const auto queueContainers = [&pending](const Node &source, Node &target) {
+    if (detail::isContainer(target)) {
+      pending.emplace_back(&source, &target);
+    }
+  };
+  while (!pending.empty()) {
+    const auto [source, target] = pending.back();
+    pending.pop_back();
+    if (isA<Dictionary>(*source)) {
+      const auto &entries = NRef<Dictionary>(*source).value();
+      auto &dictionary = NRef<Dictionary>(*target);
+      dictionary.reserve(entries.size());
+      for (const auto &entry : entries) {
+        dictionary.add(Dictionary::Entry(entry.getKey(), detail::cloneShell(entry.getNode()),
+                                         entry.getKeyQuote()));
+      }
+      for (std::size_t index = 0; index < entries.size(); ++index) {
+        queueContainers(entries[index].getNode(), dictionary.value()[index].getNode());
+      }
+    } else {
+      const auto cloneSequence = [&](const auto &from, auto &to) {
+        to.reserve(from.size());
+        for (const auto &element : from.value()) {
+          to.add(detail::cloneShell(element));
+        }
+        for (std::size_t index = 0; index < from.size(); ++index) {
+          queueContainers(from.value()[index], to.value()[index]);
+        }
+      };
+      if (isA<Array>(*source)) {
+        cloneSequence(NRef<Array>(*source), NRef<Array>(*target));
+      } else {
+        cloneSequence(NRef<Document>(*source), NRef<Document>(*target));
+      }
+    }
+  }
+  return root;
+}
+
 // Array::toKey() — build "[a, b, c]" key string
 inline std::string Array::toKey() const {
   return detail::sequenceToKey('[', ']', entries_.size(),
@@ -165,6 +285,7 @@ inline std::string Array::toKey() const {
 // Shared by Array and Document; defined here after Node::make<Hole>() is available.
 template <typename Derived>
 inline void SequenceBase<Derived>::resize(const std::size_t index) {
+  AllocationScope scope{AllocationKind::sequences};
   entries_.resize(index + 1);
   for (auto &entry : entries_) {
     if (entry.isEmpty()) {
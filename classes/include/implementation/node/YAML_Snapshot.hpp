@@ -0,0 +1,113 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include "YAML.hpp"
+#include "YAML_Core.hpp"
+
+namespace YAML_Lib {
+
+// -----------------------------------------------------------------------
+// Snapshot — a parsed YAML tree frozen so that any number of threads can
+// read and stringify it at once without a lock, with AtomicSnapshot to swap
+// in a new one on reload:
+//
+//   AtomicSnapshot config{Snapshot::make(FileSource{"config.yaml"})};
+//   // request threads
+//   const auto snapshot = config.load();
+//   serve(snapshot->document(0)["listen"]);
+//   // reload thread
+//   config.store(Snapshot::make(FileSource{"config.yaml"}));
+//
+// A Snapshot is only reachable as std::shared_ptr<const Snapshot> and only
+// hands out const Nodes. Const access never changes a tree (a missing key or
+// index throws instead of inserting a Hole) and the stringifiers keep no
+// shared mutable state. A reader keeps the snapshot it loaded alive after a
+// reload replaces it; the old tree is freed when the last reader drops it.
+// Its memory comes from Options::memory_resource (or its own arena with
+// Options::arena_tree) when given, else the PMR default resource. That
+// resource must outlive the snapshot and, because the last reader to drop
+// the snapshot frees it on that reader's thread, accept deallocations from
+// any thread (the resource is only allocated from by the thread making it).
+// -----------------------------------------------------------------------
+class Snapshot {
+
+public:
+  // Parse a source into a new snapshot.
+  [[nodiscard]] static std::shared_ptr<const Snapshot>
+  make(ISource &source, const Options &options = Options());
+  [[nodiscard]] static std::shared_ptr<const Snapshot>
+  make(ISource &&source, const Options &options = Options());
+  // Deep copy the documents of a YAML object into a new snapshot. The copy
+  // stringifies with options.stringifier (the default YAML stringifier if
+  // none), not with the stringifier of the object copied.
+  [[nodiscard]] static std::shared_ptr<const Snapshot>
+  make(const YAML &yaml, const Options &options = Options());
+
+  Snapshot(const Snapshot &other) = delete;
+  Snapshot &operator=(const Snapshot &other) = delete;
+  Snapshot(Snapshot &&other) = delete;
+  Snapshot &operator=(Snapshot &&other) = delete;
+  ~Snapshot() = default;
+
+  [[nodiscard]] unsigned long getNumberOfDocuments() const {
+    return tree.getNumberOfDocuments();
+  }
+  // Root node of a document (as YAML::document() returns).
+  [[nodiscard]] const Node &document(const unsigned long index) const {
+    return tree.document(index);
+  }
+  // Entries of the first document's root.
+  [[nodiscard]] const Node &operator[](const std::string_view &key) const {
+    return tree[key];
+  }
+  [[nodiscard]] const Node &operator[](const std::size_t index) const {
+    return tree[index];
+  }
+  // Stringify with the Options::stringifier the snapshot was made with.
+  void stringify(IDestination &destination) const { tree.stringify(destination); }
+  void stringify(IDestination &&destination) const { tree.stringify(destination); }
+
+private:
+  explicit Snapshot(const Options &options) : tree(options) {}
+
+  const YAML tree;
+};
+
+// -----------------------------------------------------------------------
+// AtomicSnapshot — the current Snapshot of something that is reloaded.
+// load(), store() and exchange() may be called from any threads at once:
+// readers never wait for a reload to build its tree and never see a partly
+// built one (RCU style; the snapshot is built before it is stored).
+// -----------------------------------------------------------------------
+class AtomicSnapshot {
+
+public:
+  AtomicSnapshot() = default;
+  explicit AtomicSnapshot(std::shared_ptr<const Snapshot> snapshot)
+      : current(std::move(snapshot)) {}
+  AtomicSnapshot(const AtomicSnapshot &other) = delete;
+  AtomicSnapshot &operator=(const AtomicSnapshot &other) = delete;
+  AtomicSnapshot(AtomicSnapshot &&other) = delete;
+  AtomicSnapshot &operator=(AtomicSnapshot &&other) = delete;
+  ~AtomicSnapshot() = default;
+
+  // Current snapshot (nullptr if none has been stored).
+  [[nodiscard]] std::shared_ptr<const Snapshot> load() const {
+    return current.load(std::memory_order_acquire);
+  }
+  // Replace the current snapshot.
+  void store(std::shared_ptr<const Snapshot> snapshot) {
+    current.store(std::move(snapshot), std::memory_order_release);
+  }
+  // Replace the current snapshot, returning the one it replaced.
+  std::shared_ptr<const Snapshot> exchange(std::shared_ptr<const Snapshot> snapshot) {
+    return current.exchange(std::move(snapshot), std::memory_order_acq_rel);
+  }
+
+private:
+  std::atomic<std::shared_ptr<const Snapshot>> current;
+};
+
+} // namespace YAML_Lib
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <optional>
+
+#include "Incremental_Parser.hpp"
+
+namespace YAML_Lib {
+
+// -----------------------------------------------------------------------
+// Async_Parser — C++20 coroutine front end for Incremental_Parser, for
+// event loops (epoll, kqueue, asio, ...) serving many connections from
+// one thread. The loop feed()s bytes as a non-blocking read returns them;
+// a coroutine co_awaits next() and is resumed, on the thread that called
+// feed()/finish(), once a complete document is ready:
+//
+//   Task handle(Async_Parser &parser) {
+//     while (auto document = co_await parser.next()) { ... }
+//   }
+//
+// next() yields std::nullopt after finish() has flushed the last
+// document. A parse error is rethrown from the co_await that would have
+// received the failing document; if more fail before it is delivered,
+// only the first error is kept. Only one coroutine may wait at a time,
+// and the parser must outlive it.
+// -----------------------------------------------------------------------
+class Async_Parser {
+
+public:
+  // Awaitable returned by next().
+  class Awaiter {
+  public:
+    explicit Awaiter(Async_Parser &parser) : parser(parser) {}
+    [[nodiscard]] bool await_ready() const noexcept {
+      return !parser.documents.empty() || parser.error || parser.finished;
+    }
+    void await_suspend(std::coroutine_handle<> handle);
+    std::optional<Node> await_resume();
+
+  private:
+    Async_Parser &parser;
+  };
+
+  Async_Parser() : Async_Parser(Options()) {}
+  explicit Async_Parser(const Options &options)
+      : parser(queueDocument, this, options) {}
+  Async_Parser(const Async_Parser &other) = delete;
+  Async_Parser &operator=(const Async_Parser &other) = delete;
+  Async_Parser(Async_Parser &&other) = delete;
+  Async_Parser &operator=(Async_Parser &&other) = delete;
+  ~Async_Parser() = default;
+
+  // Event loop side: bytes received / end of stream.
+  void feed(std::span<const char> chunk);
+  void finish();
+  // Coroutine side: co_await the next document.
+  [[nodiscard]] Awaiter next() { return Awaiter{*this}; }
+  // Documents parsed but not yet taken by next().
+  [[nodiscard]] std::size_t readyCount() const { return documents.size(); }
+
+private:
+  static void queueDocument(Node &&document, void *context);
+  void keepError(std::exception_ptr failure);
+  void resumeWaiting();
+
+  Incremental_Parser parser;
+  std::deque<Node> documents;
+  std::exception_ptr error;
+  std::coroutine_handle<> waiting;
+  bool finished{false};
+};
+
+} // namespace YAML_Lib
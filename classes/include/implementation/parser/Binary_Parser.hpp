@@ -0,0 +1,45 @@
+#pragma once
+
+#include "YAML.hpp"
+#include "YAML_Core.hpp"
+#include "YAML_Binary.hpp"
+
+namespace YAML_Lib {
+
+// -----------------------------------------------------------------------
+// Binary_Parser — rebuilds Node trees from the snapshot frames written by
+// Binary_Stringify. No text is scanned: records are decoded directly from
+// their frame offsets. The source must expose its bytes through
+// ISource::remaining() (BufferSource, SpanSource, FileSource). Any
+// malformed frame, header or record throws YAML_Lib::Error.
+// -----------------------------------------------------------------------
+class Binary_Parser final : public IParser {
+
+public:
+  Binary_Parser() = default;
+  Binary_Parser(const Binary_Parser &other) = delete;
+  Binary_Parser &operator=(const Binary_Parser &other) = delete;
+  Binary_Parser(Binary_Parser &&other) = delete;
+  Binary_Parser &operator=(Binary_Parser &&other) = delete;
+  ~Binary_Parser() override = default;
+
+  std::vector<Node> parse(ISource &source) override;
+
+  // Decode a single snapshot frame held in memory (e.g. a mapped file).
+  static Node decodeFrame(std::string_view frame);
+
+private:
+  static Node decodeNode(std::string_view frame, uint32_t offset,
+                         uint32_t parent, unsigned long depth);
+  static Node decodeNumber(std::string_view frame,
+                           const binary_format::NodeRecord &record);
+  template <typename T>
+  static Node decodeSequence(std::string_view frame,
+                             const binary_format::NodeRecord &record,
+                             uint32_t offset, unsigned long depth);
+  static Node decodeDictionary(std::string_view frame,
+                               const binary_format::NodeRecord &record,
+                               uint32_t offset, unsigned long depth);
+};
+
+} // namespace YAML_Lib
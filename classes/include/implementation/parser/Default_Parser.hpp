@@ -1,9 +1,13 @@
 #pragma once
 
+#include <atomic>
 #include <bitset>
 
 #include "YAML.hpp"
 #include "YAML_Core.hpp"
+#ifdef YAML_LIB_PROFILE
+#include "YAML_Parse_Profile.hpp"
+#endif
 
 namespace YAML_Lib {
 
@@ -11,18 +15,33 @@ namespace YAML_Lib {
 // E2: Per-parse mutable state — one ParseContext per Default_Parser
 // instance.  Moved out of inline static members so that multiple
 // Default_Parser objects (one per YAML instance) are fully independent and
-// concurrent parses do not corrupt each other's state.
+// concurrent parses do not corrupt each other's state. Its tables hold
+// ScratchAllocator storage, which may come from the tree resource of the
+// parse that filled them, so Default_Parser::parseInto() starts and
+// finishes each parse with a fresh ParseContext.
 // -----------------------------------------------------------------------
+struct ScratchStringHash {
+  std::size_t operator()(const std::string_view text) const noexcept {
+    return std::hash<std::string_view>{}(text);
+  }
+};
+using ScratchSet = std::set<ScratchString, std::less<>, ScratchAllocator<ScratchString>>;
+using ScratchMap = std::map<ScratchString, ScratchString, std::less<>,
+                            ScratchAllocator<std::pair<const ScratchString, ScratchString>>>;
+using ScratchHashMap =
+    std::unordered_map<ScratchString, ScratchString, ScratchStringHash, std::equal_to<>,
+                       ScratchAllocator<std::pair<const ScratchString, ScratchString>>>;
+
 struct ParseContext {
-  std::unordered_map<std::string, std::string> yamlAliasMap;
-  std::set<std::string>                        activeAliasExpansions;
+  ScratchHashMap yamlAliasMap;
+  ScratchSet     activeAliasExpansions;
   long          arrayIndentLevel{0};
   long          inlineArrayDepth{0};
   long          inlineDictionaryDepth{0};
   unsigned long blockFlowValueIndent{0};
   int           yamlDirectiveMinor{2};
   bool          yamlDirectiveSeen{false};
-  std::map<std::string, std::string> yamlTagPrefixes;
+  ScratchMap    yamlTagPrefixes;
 };
 
 class Default_Parser final : public IParser {
@@ -58,7 +77,14 @@ public:
       : yamlTranslator_(std::move(translator)),
         maxParseDepth(options.max_parse_depth),
         maxAliasExpansions(options.max_alias_expansions),
-        maxDocuments(options.max_documents) {}
+        maxDocuments(options.max_documents),
+        strictBooleans(options.strict_booleans) {
+#ifdef YAML_LIB_PROFILE
+    for (const auto name : kParserNames) {
+      profile_.productions.push_back({name});
+    }
+#endif
+  }
   Default_Parser(const Default_Parser &other) = delete;
   Default_Parser &operator=(const Default_Parser &other) = delete;
   Default_Parser(Default_Parser &&other) = delete;
@@ -66,18 +92,41 @@ public:
   ~Default_Parser() override = default;
 
   std::vector<Node> parse(ISource &source) override;
+  void parseInto(ISource &source, std::vector<Node> &yNodeTree) override;
 
   // Enable/disable strict YAML 1.2 boolean mode (only 'true'/'false' valid)
-  static void setStrictBooleans(const bool strict) { strictBooleans = strict; }
+  // for every parser, in addition to those given Options::strict_booleans.
+  static void setStrictBooleans(const bool strict) {
+    strictBooleansForAll.store(strict, std::memory_order_relaxed);
+  }
+
+#ifdef YAML_LIB_PROFILE
+  // Profile counters (YAML_LIB_PROFILE builds only)
+  [[nodiscard]] const ParseProfile &getProfile() const { return profile_; }
+  void resetProfile() { profile_.reset(); }
+#endif
 
 private:
   // RAII save/restore guard for ISource lookahead.
   // Calls source.restore() in the destructor unless release() is called first.
+  // In YAML_LIB_PROFILE builds each restore, and the bytes it rewinds, is
+  // recorded against the profile of the parse running on this thread.
   class SourceGuard {
   public:
-    explicit SourceGuard(ISource &src) : src_(&src) { src_->save(); }
+    explicit SourceGuard(ISource &src) : src_(&src) {
+      src_->save();
+#ifdef YAML_LIB_PROFILE
+      saved_ = src_->position();
+#endif
+    }
     ~SourceGuard() {
       if (src_) {
+#ifdef YAML_LIB_PROFILE
+        if (activeProfile != nullptr) {
+          activeProfile->restores++;
+          activeProfile->backtrackBytes += src_->position() - saved_;
+        }
+#endif
         src_->restore();
       }
     }
@@ -95,6 +144,9 @@ private:
 
   private:
     ISource *src_;
+#ifdef YAML_LIB_PROFILE
+    std::size_t saved_{};
+#endif
   };
 
   // RAII guard that increments a depth counter on construction and
@@ -128,7 +180,7 @@ private:
                             unsigned long indentation, Predicate &&pred) {
     const unsigned long tokenIndent = source.getPosition().second;
     SourceGuard guard(source);
-    std::string token{extractToNext(source, delimiters)};
+    ScratchString token{extractToNext(source, delimiters)};
     rightTrim(token);
     if (source.more() && source.current() == kLineFeed &&
         hasPlainScalarContinuation(source, tokenIndent)) {
@@ -147,7 +199,7 @@ private:
   // YAML parser
   bool endsWith(const std::string_view &str,
                        const std::string_view &substr);
-  void rightTrim(std::string &str);
+  void rightTrim(ScratchString &str);
   void moveToNext(ISource &source, const Delimiters &delimiters);
   void skipLine(ISource &source);
   bool skipIfComment(ISource &source);
@@ -156,40 +208,44 @@ private:
                                  ISource &source);
   void addInlineDictEntry(Dictionary &dict, DictionaryEntry entry,
                                  ISource &source);
-  const std::string &resolveAlias(const std::string &name,
+  const ScratchString &resolveAlias(const ScratchString &name,
                                          ISource &source);
   bool isNullStringNode(const Node &node);
-  bool looksLikeIso8601Date(const std::string &s);
-  std::string extractString(ISource &source, char quote);
-  std::string extractString(ISource &source, char quote,
+  bool looksLikeIso8601Date(const ScratchString &s);
+  ScratchString extractString(ISource &source, char quote);
+  ScratchString extractString(ISource &source, char quote,
                                    unsigned long *quoteColumn);
-  std::string extractString(ISource &source);
-  std::string extractRawQuotedScalar(ISource &source);
-  std::string extractTagSuffix(ISource &source);
-  std::string extractToNext(ISource &source,
+  ScratchString extractString(ISource &source);
+  ScratchString extractRawQuotedScalar(ISource &source);
+  ScratchString extractTagSuffix(ISource &source);
+  ScratchString extractToNext(ISource &source,
                                    const Delimiters &delimiters);
-  std::string extractTrimmed(ISource &source,
+  ScratchString extractTrimmed(ISource &source,
                                     const Delimiters &delimiters);
-  std::string extractInLine(ISource &source, char start, char end);
-  std::string extractInlineCollectionAt(ISource &source);
-  std::string extractMapping(ISource &source);
+  ScratchString extractInLine(ISource &source, char start, char end);
+  ScratchString extractInlineCollectionAt(ISource &source);
+  ScratchString extractMapping(ISource &source);
   void checkForEnd(ISource &source, char end);
   void checkFlowDelimiter(ISource &source, const Delimiters &delimiters);
   void checkAtFlowClose(ISource &source, const Delimiters &delimiters,
                                long depth);
-  Node parseFromBuffer(const std::string &text,
+  Node parseFromBuffer(const ScratchString &text,
                               const Delimiters &delimiters,
                               unsigned long indentation);
-  std::string captureIndentedBlock(ISource &source,
+  ScratchString captureIndentedBlock(ISource &source,
                                           unsigned long minIndent);
-  void upsertDictEntry(Dictionary &dict, const std::string &key,
+  void upsertDictEntry(Dictionary &dict, const ScratchString &key,
                               Node value);
   Node mergeOverrides(Node &overrideRoot);
   Node convertYAMLToStringNode(const std::string_view &yamlString);
   Node convertYAMLToStringNode(const std::string_view &yamlString,
                                       unsigned long indentation);
-  bool isValidKey(const std::string_view &key) noexcept;
+  bool isValidKey(const std::string_view &key);
+  // Outcome of decoding a key without re-parsing it (see decodeKey).
+  enum class KeyDecode : uint8_t { decoded, invalid, reparse };
+  KeyDecode decodeKey(const std::string_view &key, Node &keyNode);
   bool isOverride(ISource &source);
+  bool hasKeyColon(ISource &source);
   bool isKey(ISource &source);
   bool isArray(ISource &source);
   bool isBoolean(ISource &source);
@@ -212,23 +268,24 @@ private:
   bool isDocumentEnd(ISource &source);
   bool isDocumentBoundary(ISource &source);
   bool isInlineComment(const ISource &source,
-                              const std::string &yamlString);
-  void convertOctalToDecimal(std::string &numeric,
-                                    const std::string &digits);
+                              const ScratchString &yamlString);
+  void convertOctalToDecimal(ScratchString &numeric,
+                                    const ScratchString &digits);
   bool isDirective(ISource &source);
   bool isTagged(ISource &source);
   bool isTimestamp(ISource &source);
-  void appendCharacterToString(ISource &source, std::string &yamlString,
+  const char *appendCharacterToString(ISource &source, ScratchString &yamlString,
                                       bool escapeAware = false,
                                       unsigned long minIndent = 0);
-  std::string extractKey(ISource &source,
+  ScratchString extractKey(ISource &source,
                                 unsigned long *quoteIndent = nullptr);
   std::pair<BlockChomping, int> parseBlockChomping(ISource &source);
-  std::string parseBlockString(ISource &source,
+  ScratchString parseBlockString(ISource &source,
                                       const Delimiters &delimiters,
                                       unsigned long indentation,
                                       char fillerDefault);
   Node parseKey(ISource &source);
+  Node parseFlowKey(ISource &source);
   Node parseFoldedBlockString(ISource &source,
                                      const Delimiters &delimiters,
                                      unsigned long indentation);
@@ -241,6 +298,16 @@ private:
   Node parseQuotedFlowString(ISource &source,
                                     const Delimiters &delimiters,
                                     unsigned long indentation);
+  // Exception-free scan of a quoted scalar (error message or nullptr), shared
+  // by parseQuotedFlowString and the probeQuotedFlowString key check.
+  const char *scanQuotedScalar(ISource &source, unsigned long indentation,
+                               ScratchString &yamlString);
+  const char *scanQuotedScalarEnd(ISource &source, const Delimiters &delimiters);
+  // Escapes of a double quoted scalar translated into translated_; throws as
+  // ITranslator::from() does.
+  std::string_view translateEscapes(const std::string_view &escapedString);
+  bool probeQuotedFlowString(ISource &source, const Delimiters &delimiters,
+                             unsigned long indentation);
   Node parseComment(ISource &source,
                            [[maybe_unused]] const Delimiters &delimiters);
   Node parseNumber(ISource &source, const Delimiters &delimiters,
@@ -251,6 +318,20 @@ private:
                            unsigned long indentation);
   Node parseTimestamp(ISource &source, const Delimiters &delimiters,
                              unsigned long indentation);
+  Node numberFromToken(ScratchString numeric);
+  Node noneFromToken(const ScratchString &token);
+  Node booleanFromToken(const ScratchString &token);
+  // Only 'true'/'false' are booleans (options, setStrictBooleans or %YAML 1.2).
+  [[nodiscard]] bool strictBooleanMode() const {
+    return strictBooleans ||
+           strictBooleansForAll.load(std::memory_order_relaxed) ||
+           ctx_.yamlDirectiveMinor >= 2;
+  }
+  // One pass parse of a flow collection element (single line number,
+  // boolean, null or quoted scalar, or nested collection) that bypasses the
+  // router; empty Node when the element needs parseDocument.
+  Node parseFlowElement(ISource &source, const Delimiters &delimiters,
+                        unsigned long indentation, char close);
   Node parseAnchor(ISource &source, const Delimiters &delimiters,
                           unsigned long indentation);
   Node parseAlias(ISource &source, const Delimiters &delimiters,
@@ -311,17 +392,70 @@ private:
       {&Default_Parser::isTagged,           &Default_Parser::parseTagged},
       {&Default_Parser::isDefault,          &Default_Parser::parsePlainFlowString},
   }};
+  // First-byte dispatch: for each value of the current character, the bit
+  // set of parsers_ entries whose probe can succeed on it. parseDocument
+  // runs only those, in table order. A key (dictionary) or plain scalar may
+  // start with any character; every other probe tests fixed characters.
+  static_assert(parsers_.size() <= 16);
+  inline static constexpr std::array<uint16_t, 256> kFirstByteProductions =
+      [] {
+        std::array<uint16_t, 256> table{};
+        table.fill((1u << 1) | (1u << 15)); // dictionary, plain
+        const auto allow = [&table](const unsigned production,
+                                    const std::string_view firstBytes) {
+          for (const char ch : firstBytes) {
+            table[static_cast<unsigned char>(ch)] |=
+                static_cast<uint16_t>(1u << production);
+          }
+        };
+        allow(0, "-");                 // array
+        allow(2, "{");                 // inlineDictionary
+        allow(3, "[");                 // inlineArray
+        allow(4, "TFOYNtfyno");        // boolean (YAML 1.1 words included)
+        allow(5, "'\"");               // quotedString
+        allow(6, "0123456789");        // timestamp
+        allow(7, "0123456789+-.");     // number
+        allow(8, "n~");                // none
+        allow(9, ">");                 // foldedBlock
+        allow(10, "|");                // literalBlock
+        allow(11, "&");                // anchor
+        allow(12, "*");                // alias
+        allow(13, "<");                // override
+        allow(14, "!");                // tagged
+        return table;
+      }();
+#ifdef YAML_LIB_PROFILE
+  // Production names reported by ParseProfile, in parsers_ order.
+  inline static constexpr std::array<std::string_view, parsers_.size()>
+      kParserNames{"array",       "dictionary", "inlineDictionary",
+                   "inlineArray", "boolean",    "quotedString",
+                   "timestamp",   "number",     "none",
+                   "foldedBlock", "literalBlock", "anchor",
+                   "alias",       "override",   "tagged",
+                   "plain"};
+  Node parseProduction(std::size_t index, ISource &source,
+                       const Delimiters &delimiters, unsigned long indentation);
+  ParseProfile profile_;
+  // Profile of the parse() running on this thread; lets SourceGuard, which
+  // has no parser pointer, record its restores.
+  inline static thread_local ParseProfile *activeProfile{nullptr};
+#endif
   // Per-parse mutable state (replaces the former inline static members).
   ParseContext ctx_;
   long parseDepth{0};
   unsigned long aliasExpansionCount{0};
   // Translator (per-instance, not shared across Default_Parser instances).
   std::unique_ptr<ITranslator> yamlTranslator_;
+  // Translator output, reused from one scalar (and parse) to the next.
+  std::string translated_;
   const unsigned long maxParseDepth{0};
   const unsigned long maxAliasExpansions{0};
   const unsigned long maxDocuments{0};
-  // Strict YAML 1.2 boolean mode — process-global setting (not per-parse).
-  inline static bool strictBooleans{false};
+  // Strict YAML 1.2 boolean mode from Options::strict_booleans.
+  const bool strictBooleans{false};
+  // Strict mode for all parsers, set only by setStrictBooleans(); atomic so
+  // that it may be changed while other threads parse.
+  inline static std::atomic<bool> strictBooleansForAll{false};
 };
 
 } // namespace YAML_Lib
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <atomic>
+
+#include "YAML.hpp"
+#include "YAML_Core.hpp"
+#include "Default_Parser.hpp"
+#include "JSON_Parser.hpp"
+
+namespace YAML_Lib {
+
+// -----------------------------------------------------------------------
+// Dispatch_Parser — inspects the first non-blank bytes of the source and
+// routes the payload to the cheapest parser that gives the same result:
+//
+//   json   '{' + '"'/'}' or '[' + JSON value start: JSON_Parser. Falls back
+//          to Default_Parser (from the saved position) if the payload is
+//          not exactly one JSON document.
+//   flow   any other '{' / '[' start: Default_Parser flow collections.
+//   block  everything else (block YAML, directives, multi-document streams):
+//          Default_Parser.
+//
+// Route counters are atomic so they can be sampled from another thread
+// while parsing continues.
+// -----------------------------------------------------------------------
+class Dispatch_Parser final : public IParser {
+
+public:
+  // Snapshot of the route counters.
+  struct Statistics {
+    uint64_t json{};
+    uint64_t flow{};
+    uint64_t block{};
+    uint64_t jsonFallbacks{};
+  };
+
+  Dispatch_Parser() : Dispatch_Parser(Options()) {}
+  explicit Dispatch_Parser(const Options &options);
+  Dispatch_Parser(const Dispatch_Parser &other) = delete;
+  Dispatch_Parser &operator=(const Dispatch_Parser &other) = delete;
+  Dispatch_Parser(Dispatch_Parser &&other) = delete;
+  Dispatch_Parser &operator=(Dispatch_Parser &&other) = delete;
+  ~Dispatch_Parser() override = default;
+
+  std::vector<Node> parse(ISource &source) override;
+
+  // Route counters
+  [[nodiscard]] Statistics getStatistics() const;
+  void resetStatistics();
+
+private:
+  enum class Route : uint8_t { json = 0, flow, block };
+  // Number of bytes examined when choosing a route.
+  static constexpr std::size_t kPrefixLength{64};
+
+  static Route detectRoute(ISource &source);
+
+  Default_Parser defaultParser;
+  JSON_Parser jsonParser;
+  std::atomic<uint64_t> jsonCount{0};
+  std::atomic<uint64_t> flowCount{0};
+  std::atomic<uint64_t> blockCount{0};
+  std::atomic<uint64_t> jsonFallbackCount{0};
+};
+
+} // namespace YAML_Lib
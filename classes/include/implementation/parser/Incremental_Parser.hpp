@@ -0,0 +1,111 @@
+#pragma once
+
+#include <span>
+
+#include "YAML.hpp"
+#include "YAML_Core.hpp"
+#include "Default_Parser.hpp"
+
+namespace YAML_Lib {
+
+// -----------------------------------------------------------------------
+// Incremental_Parser — push-style parser for YAML that arrives in chunks
+// (e.g. straight off a socket). feed() accepts any number of bytes, split
+// anywhere (mid-line, mid-scalar); each document is handed to the sink as
+// soon as the line that closes it ("...", or the next "---") has arrived.
+// finish() flushes the final document at end of input.
+//
+// Only the bytes of the document still open are buffered, so latency to
+// the first document and peak memory are independent of the total
+// stream length. Each completed document is parsed by Default_Parser and
+// yields exactly the Document nodes a whole-stream parse would; error
+// line numbers are those of the whole stream, and a document that fails
+// to parse is dropped so feeding can carry on with the next one. feed()
+// still emits every other document its chunk closes before it rethrows
+// the first parse error.
+// max_documents applies to each document's parse, not the stream.
+//
+// Usage:
+//   Incremental_Parser parser{[](Node &&document, void *) { ... }, nullptr};
+//   while (read chunk) { parser.feed(chunk); }
+//   parser.finish();
+// -----------------------------------------------------------------------
+class Incremental_Parser {
+
+public:
+  // Receives each completed Document node and the opaque context pointer.
+  using DocumentSink = void (*)(Node &&document, void *context);
+
+  Incremental_Parser(const DocumentSink sink, void *context)
+      : Incremental_Parser(sink, context, Options()) {}
+  Incremental_Parser(DocumentSink sink, void *context, const Options &options);
+  Incremental_Parser(const Incremental_Parser &other) = delete;
+  Incremental_Parser &operator=(const Incremental_Parser &other) = delete;
+  Incremental_Parser(Incremental_Parser &&other) = delete;
+  Incremental_Parser &operator=(Incremental_Parser &&other) = delete;
+  ~Incremental_Parser() = default;
+
+  // Append the next chunk of the stream and emit any documents it closes.
+  void feed(std::span<const char> chunk);
+  // End of stream: emit the last document and reset for a new stream.
+  void finish();
+  // Documents handed to the sink since construction.
+  [[nodiscard]] unsigned long documentCount() const { return documents; }
+  // Bytes buffered for the document still open.
+  [[nodiscard]] std::size_t bufferedSize() const { return pending.size(); }
+
+private:
+  enum class LineKind : uint8_t {
+    blank = 0,
+    directive,
+    startMarker,
+    endMarker,
+    content
+  };
+  // In-memory source for one buffered document whose line numbers start
+  // at its line in the whole stream.
+  class Segment final : public BufferedSourceBase {
+  public:
+    Segment(const std::string_view text, const unsigned long firstLine)
+        : text(text) {
+      lineNo = firstLine;
+    }
+    [[nodiscard]] char current() const override {
+      if (more()) {
+        return text[bufferPosition];
+      }
+      return EOF;
+    }
+    [[nodiscard]] bool more() const override {
+      return bufferPosition < text.size();
+    }
+
+  protected:
+    [[nodiscard]] const char *endOfInputMessage() const noexcept override {
+      return "Tried to read past end of fed data.";
+    }
+    [[nodiscard]] std::string_view contents() const noexcept override {
+      return text;
+    }
+
+  private:
+    std::string_view text;
+  };
+
+  static LineKind classifyLine(std::string_view line);
+  void emit(std::size_t length);
+
+  DocumentSink sink;
+  void *context;
+  Default_Parser parser;
+  // Unemitted bytes; everything before 'scanned' has been classified.
+  std::string pending;
+  std::size_t scanned{};
+  // True once the buffered document has a start marker or content.
+  bool inDocument{false};
+  // Stream line number of pending[0].
+  unsigned long firstLine{1};
+  unsigned long documents{};
+};
+
+} // namespace YAML_Lib
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "YAML.hpp"
+#include "YAML_Core.hpp"
+
+namespace YAML_Lib {
+
+// -----------------------------------------------------------------------
+// JSON_Parser — strict RFC 8259 parser producing the same Node trees as
+// Default_Parser does for JSON input (double-quoted keys and strings,
+// smallest fitting Number type, Boolean forms "true"/"false"). A single
+// forward pass with no indentation tracking, lookahead or backtracking.
+// Each top-level value (e.g. one per line of NDJSON) becomes a document.
+// Sources exposing ISource::remaining() are scanned in place; other sources
+// are read into a buffer first.
+// -----------------------------------------------------------------------
+class JSON_Parser final : public IParser {
+
+public:
+  JSON_Parser() : JSON_Parser(Options()) {}
+  explicit JSON_Parser(const Options &options)
+      : maxParseDepth(options.max_parse_depth),
+        maxDocuments(options.max_documents) {}
+  JSON_Parser(const JSON_Parser &other) = delete;
+  JSON_Parser &operator=(const JSON_Parser &other) = delete;
+  JSON_Parser(JSON_Parser &&other) = delete;
+  JSON_Parser &operator=(JSON_Parser &&other) = delete;
+  ~JSON_Parser() override = default;
+
+  std::vector<Node> parse(ISource &source) override;
+
+private:
+  // Position within the JSON text; line/column are only worked out when an
+  // error is reported.
+  class Cursor {
+  public:
+    explicit Cursor(const std::string_view text) : text_(text) {}
+    [[nodiscard]] bool more() const { return offset_ < text_.size(); }
+    [[nodiscard]] char current() const { return more() ? text_[offset_] : kNull; }
+    void next() { offset_++; }
+    [[nodiscard]] std::size_t offset() const { return offset_; }
+    [[nodiscard]] std::string_view from(const std::size_t start) const {
+      return text_.substr(start, offset_ - start);
+    }
+    [[nodiscard]] std::pair<unsigned long, unsigned long> getPosition() const;
+
+  private:
+    std::string_view text_;
+    std::size_t offset_{};
+  };
+
+  Node parseValue(Cursor &cursor, unsigned long depth);
+  Node parseObject(Cursor &cursor, unsigned long depth);
+  Node parseArray(Cursor &cursor, unsigned long depth);
+  static std::string parseString(Cursor &cursor);
+  static Node parseNumber(Cursor &cursor);
+  static Node parseLiteral(Cursor &cursor);
+  static uint32_t parseHexQuad(Cursor &cursor);
+  static void skipWhiteSpace(Cursor &cursor);
+  void checkDepth(unsigned long depth) const;
+
+  unsigned long maxParseDepth;
+  unsigned long maxDocuments;
+};
+
+} // namespace YAML_Lib
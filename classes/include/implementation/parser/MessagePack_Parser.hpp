@@ -0,0 +1,61 @@
+#pragma once
+
+#include "YAML.hpp"
+#include "YAML_Core.hpp"
+
+namespace YAML_Lib {
+
+// -----------------------------------------------------------------------
+// MessagePack_Parser — decodes MessagePack (e.g. as written by
+// MessagePack_Stringify) into the Node trees JSON_Parser would build:
+// strings and keys are double-quoted, integers use the smallest fitting
+// Number type, bin becomes a !!binary base64 String and the timestamp
+// extension a Timestamp. Each top-level object becomes a document. The
+// source must expose its bytes through ISource::remaining().
+// -----------------------------------------------------------------------
+class MessagePack_Parser final : public IParser {
+
+public:
+  MessagePack_Parser() : MessagePack_Parser(Options()) {}
+  explicit MessagePack_Parser(const Options &options)
+      : maxParseDepth(options.max_parse_depth),
+        maxDocuments(options.max_documents) {}
+  MessagePack_Parser(const MessagePack_Parser &other) = delete;
+  MessagePack_Parser &operator=(const MessagePack_Parser &other) = delete;
+  MessagePack_Parser(MessagePack_Parser &&other) = delete;
+  MessagePack_Parser &operator=(MessagePack_Parser &&other) = delete;
+  ~MessagePack_Parser() override = default;
+
+  std::vector<Node> parse(ISource &source) override;
+
+private:
+  // Bounds checked big-endian reader over the encoded bytes.
+  class Reader {
+  public:
+    explicit Reader(const std::string_view bytes) : bytes_(bytes) {}
+    [[nodiscard]] bool more() const { return offset_ < bytes_.size(); }
+    [[nodiscard]] std::size_t available() const { return bytes_.size() - offset_; }
+    [[nodiscard]] std::size_t offset() const { return offset_; }
+    uint64_t readBigEndian(unsigned width);
+    std::string_view readBytes(uint64_t length);
+
+  private:
+    std::string_view bytes_;
+    std::size_t offset_{};
+  };
+
+  Node decodeNode(Reader &reader, unsigned long depth);
+  Node decodeArray(Reader &reader, uint64_t count, unsigned long depth);
+  Node decodeMap(Reader &reader, uint64_t count, unsigned long depth);
+  static Node decodeExtension(Reader &reader, uint64_t length);
+  static Node makeInteger(int64_t value);
+  static Node makeUnsigned(uint64_t value);
+  static Node makeBinary(std::string_view bytes);
+  static std::string decodeKey(Reader &reader);
+  static uint64_t checkedCount(const Reader &reader, uint64_t count);
+
+  unsigned long maxParseDepth;
+  unsigned long maxDocuments;
+};
+
+} // namespace YAML_Lib
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <deque>
+
+#include "Incremental_Parser.hpp"
+
+namespace YAML_Lib {
+
+// -----------------------------------------------------------------------
+// DocumentReader — yields the documents of a multi-document stream one
+// at a time, in order, instead of parsing them all into a vector:
+//
+//   DocumentReader reader{source};
+//   while (reader.next()) {
+//     process(reader.document());
+//   }
+//
+// The source is read in blocks and handed to an Incremental_Parser, which
+// parses a document once its closing marker has been read. next()
+// destroys the previous document before parsing on, so peak memory is
+// proportional to the largest single document (plus one read block).
+// If options.memory_resource is set it is installed as the tree resource
+// while documents are parsed (as YAML::parse does), so a pool
+// resource reuses each document's memory for the next one.
+// A parse error is thrown from next(); the failing document is dropped and
+// the documents before and after it are still returned by later calls.
+// -----------------------------------------------------------------------
+class DocumentReader {
+
+public:
+  // Bytes passed to the incremental parser per read from the source.
+  static constexpr std::size_t kReadBlockSize{16 * 1024};
+
+  explicit DocumentReader(ISource &source)
+      : DocumentReader(source, Options()) {}
+  DocumentReader(ISource &source, const Options &options)
+      : source(source), parser(queueDocument, this, options),
+        memoryResource(options.memory_resource) {}
+  DocumentReader(const DocumentReader &other) = delete;
+  DocumentReader &operator=(const DocumentReader &other) = delete;
+  DocumentReader(DocumentReader &&other) = delete;
+  DocumentReader &operator=(DocumentReader &&other) = delete;
+  ~DocumentReader() = default;
+
+  // Advance to the next document; false once the stream is exhausted.
+  bool next();
+  // Root node of the current document (as YAML::document() returns).
+  [[nodiscard]] Node &document();
+  // Number of documents returned by next() so far.
+  [[nodiscard]] unsigned long documentCount() const { return count; }
+
+private:
+  static void queueDocument(Node &&document, void *context);
+  void readBlock();
+
+  ISource &source;
+  Incremental_Parser parser;
+  std::pmr::memory_resource *memoryResource;
+  std::deque<Node> documents;
+  Node current;
+  std::string block;
+  unsigned long count{};
+  bool finished{false};
+};
+
+} // namespace YAML_Lib
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <chrono>
+
+namespace YAML_Lib {
+
+// -----------------------------------------------------------------------
+// ParseProfile — instrumentation gathered by Default_Parser when the
+// library is built with YAML_LIB_PROFILE. Without that option none of
+// this is compiled into the parser, so an unprofiled build pays nothing.
+//
+// productions  one entry per parsers_ routing entry (same order): how
+//              often its is-a probe ran and matched, how often the parse
+//              function returned an empty Node (the router moved on), the
+//              time spent in probe + parse and the source bytes the parse
+//              consumed. Time and bytes are inclusive of nested productions.
+// restores     SourceGuard restores (lookahead that was thrown away) and
+//              the bytes re-read because of them.
+// reparses     parseFromBuffer() calls (anchors, aliases, overrides, keys,
+//              tagged scalars) and the bytes handed to them.
+// aliases      alias and merge-override expansions.
+// flowElements flow collection elements and flow mapping keys taken by
+//              the one pass parseFlowElement/parseFlowKey paths instead of
+//              the productions.
+//
+// Counters accumulate over every parse() until reset() is called.
+// -----------------------------------------------------------------------
+struct ParseProfile {
+  struct Production {
+    std::string_view name;
+    uint64_t probes{};
+    uint64_t matches{};
+    uint64_t misses{};
+    uint64_t nanoseconds{};
+    uint64_t bytes{};
+  };
+  std::vector<Production> productions;
+  uint64_t parses{};
+  uint64_t restores{};
+  uint64_t backtrackBytes{};
+  uint64_t reparses{};
+  uint64_t reparseBytes{};
+  uint64_t aliasExpansions{};
+  uint64_t flowElements{};
+
+  // Zero every counter (production names are kept).
+  void reset();
+  // Human readable table, productions ordered by time spent.
+  [[nodiscard]] std::string report() const;
+  // The same data as a single JSON object.
+  [[nodiscard]] std::string toJSON() const;
+};
+
+} // namespace YAML_Lib
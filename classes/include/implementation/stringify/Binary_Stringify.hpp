@@ -0,0 +1,205 @@
+#pragma once
+
+#include <numeric>
+
+#include "YAML.hpp"
+#include "YAML_Core.hpp"
+#include "YAML_Binary.hpp"
+
+namespace YAML_Lib {
+class Binary_Stringify final : public IStringify {
+public:
+  Binary_Stringify() = default;
+  Binary_Stringify &operator=(const Binary_Stringify &other) = delete;
+  Binary_Stringify(Binary_Stringify &&other) = delete;
+  Binary_Stringify &operator=(Binary_Stringify &&other) = delete;
+  ~Binary_Stringify() override = default;
+
+  /// <summary>
+  /// Encode a Node structure (normally a Document) into a self-contained
+  /// binary snapshot frame on the destination stream passed in.
+  /// </summary>
+  /// <param name="yNode">Node structure to be encoded.</param>
+  /// <param name="destination">Destination stream for the snapshot.</param>
+  /// <param name="indent">Unused (binary output has no indentation).</param>
+  void stringify(const Node &yNode, IDestination &destination,
+                 [[maybe_unused]] const unsigned long indent) const override {
+    FrameWriter writer;
+    destination.add(writer.encode(yNode));
+  }
+
+private:
+  class FrameWriter {
+  public:
+    std::string encode(const Node &yNode) {
+      using namespace binary_format;
+      reserve(sizeof(Header));
+      const uint32_t root = encodeNode(yNode);
+      align(8); // keep consecutive frames 8-byte aligned
+      Header header{};
+      std::memcpy(header.magic, kMagic, sizeof(kMagic));
+      header.version = kVersion;
+      header.byteOrder = kByteOrder;
+      header.longDoubleSize = sizeof(long double);
+      header.frameSize = checkedOffset(frame.size());
+      header.rootOffset = root;
+      store(0, header);
+      return std::move(frame);
+    }
+
+  private:
+    static uint32_t checkedOffset(const std::size_t offset) {
+      if (offset > std::numeric_limits<uint32_t>::max()) {
+        YAML_THROW(IStringify::Error,
+                   "Document too large for a binary snapshot frame.");
+      }
+      return static_cast<uint32_t>(offset);
+    }
+    void align(const std::size_t alignment) {
+      frame.resize((frame.size() + alignment - 1) & ~(alignment - 1));
+    }
+    uint32_t reserve(const std::size_t size, const std::size_t alignment = 4) {
+      align(alignment);
+      const auto offset = checkedOffset(frame.size());
+      frame.resize(frame.size() + size);
+      return offset;
+    }
+    template <typename T> void store(const uint32_t offset, const T &value) {
+      std::memcpy(frame.data() + offset, &value, sizeof(T));
+    }
+    uint32_t addString(const std::string_view string) {
+      if (const auto found = strings.find(string); found != strings.end()) {
+        return found->second;
+      }
+      const uint32_t offset = reserve(sizeof(uint32_t) + string.size() + 1);
+      store(offset, checkedOffset(string.size()));
+      std::memcpy(frame.data() + offset + sizeof(uint32_t), string.data(),
+                  string.size());
+      strings.emplace(string, offset);
+      return offset;
+    }
+    template <typename T> uint32_t addPayload(const T value) {
+      const uint32_t offset = reserve(sizeof(T), alignof(T));
+      store(offset, value);
+      return offset;
+    }
+    void encodeNumber(const Number &number, binary_format::NodeRecord &record) {
+      using binary_format::NumberKind;
+      if (number.is<int>() || number.is<long>() || number.is<long long>()) {
+        record.detail = static_cast<uint8_t>(
+            number.is<int>()    ? NumberKind::intValue
+            : number.is<long>() ? NumberKind::longValue
+                                : NumberKind::longLongValue);
+        record.first = addPayload(static_cast<int64_t>(number.value<long long>()));
+      } else if (number.is<float>() || number.is<double>()) {
+        record.detail = static_cast<uint8_t>(
+            number.is<float>() ? NumberKind::floatValue : NumberKind::doubleValue);
+        record.first = addPayload(number.value<double>());
+      } else if (number.is<long double>()) {
+        record.detail = static_cast<uint8_t>(NumberKind::longDoubleValue);
+        record.first = addPayload(number.value<long double>());
+      }
+    }
+    static uint8_t booleanForm(const Boolean &boolean) {
+      const std::string form{boolean.toString()};
+      for (uint8_t index = 0; index < std::size(Boolean::kForms); ++index) {
+        if (form == Boolean::kForms[index]) {
+          return index;
+        }
+      }
+      return boolean.value() ? 3 : 9;
+    }
+    template <typename T>
+    uint32_t encodeSequence(const T &sequence, binary_format::NodeRecord &record) {
+      const auto &entries = sequence.value();
+      record.first = checkedOffset(entries.size());
+      const uint32_t table = reserve(entries.size() * sizeof(uint32_t));
+      for (std::size_t index = 0; index < entries.size(); ++index) {
+        store(static_cast<uint32_t>(table + index * sizeof(uint32_t)),
+              encodeNode(entries[index]));
+      }
+      return table;
+    }
+    uint32_t encodeDictionary(const Dictionary &dictionary,
+                              binary_format::NodeRecord &record) {
+      const auto &entries = dictionary.value();
+      record.first = checkedOffset(entries.size());
+      const uint32_t table =
+          reserve(entries.size() * (sizeof(binary_format::EntryRecord) +
+                                    sizeof(uint32_t)));
+      // Sorted key index (stable, so the last of any duplicate keys wins a
+      // lookup just as it does in the Dictionary hash index).
+      std::vector<uint32_t> sorted(entries.size());
+      std::iota(sorted.begin(), sorted.end(), 0);
+      std::ranges::stable_sort(sorted, [&entries](const uint32_t lhs,
+                                                  const uint32_t rhs) {
+        return entries[lhs].getKey() < entries[rhs].getKey();
+      });
+      const auto sortedKeys = static_cast<uint32_t>(
+          table + entries.size() * sizeof(binary_format::EntryRecord));
+      for (std::size_t index = 0; index < entries.size(); ++index) {
+        store(static_cast<uint32_t>(sortedKeys + index * sizeof(uint32_t)),
+              sorted[index]);
+      }
+      for (std::size_t index = 0; index < entries.size(); ++index) {
+        binary_format::EntryRecord entry{};
+        entry.key = addString(entries[index].getKey());
+        entry.keyQuote = static_cast<uint8_t>(entries[index].getKeyQuote());
+        entry.node = encodeNode(entries[index].getNode());
+        store(static_cast<uint32_t>(table +
+                                    index * sizeof(binary_format::EntryRecord)),
+              entry);
+      }
+      return table;
+    }
+    uint32_t encodeNode(const Node &yNode) {
+      using binary_format::Type;
+      const uint32_t offset = reserve(sizeof(binary_format::NodeRecord));
+      binary_format::NodeRecord record{};
+      if (!yNode.getTag().empty()) {
+        record.tag = addString(yNode.getTag());
+      }
+      if (isA<Number>(yNode)) {
+        record.type = Type::number;
+        encodeNumber(NRef<Number>(yNode), record);
+      } else if (isA<String>(yNode)) {
+        record.type = Type::string;
+        record.detail = static_cast<uint8_t>(NRef<String>(yNode).getQuote());
+        record.first = addString(NRef<String>(yNode).value());
+      } else if (isA<Boolean>(yNode)) {
+        record.type = Type::boolean;
+        record.detail = booleanForm(NRef<Boolean>(yNode));
+        record.first = NRef<Boolean>(yNode).value() ? 1 : 0;
+      } else if (isA<Null>(yNode)) {
+        record.type = Type::null;
+      } else if (isA<Hole>(yNode)) {
+        record.type = Type::hole;
+      } else if (isA<Timestamp>(yNode)) {
+        record.type = Type::timestamp;
+        record.first = addString(NRef<Timestamp>(yNode).value());
+      } else if (isA<Comment>(yNode)) {
+        record.type = Type::comment;
+        record.first = addString(NRef<Comment>(yNode).value());
+      } else if (isA<Dictionary>(yNode)) {
+        record.type = Type::dictionary;
+        record.second = encodeDictionary(NRef<Dictionary>(yNode), record);
+      } else if (isA<Array>(yNode)) {
+        record.type = Type::array;
+        record.second = encodeSequence(NRef<Array>(yNode), record);
+      } else if (isA<Document>(yNode)) {
+        record.type = Type::document;
+        record.second = encodeSequence(NRef<Document>(yNode), record);
+      } else {
+        IStringify::throwUnknownNodeType();
+      }
+      store(offset, record);
+      return offset;
+    }
+
+    // Frame being built (offsets are indices into this buffer)
+    std::string frame;
+    // Interned strings: views into the Node tree being encoded
+    std::unordered_map<std::string_view, uint32_t> strings;
+  };
+};
+} // namespace YAML_Lib
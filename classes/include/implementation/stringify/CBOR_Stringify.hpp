@@ -0,0 +1,196 @@
+#pragma once
+
+#include <bit>
+
+#include "YAML.hpp"
+#include "YAML_Core.hpp"
+#include "YAML_Stringify_Helper.hpp"
+
+namespace YAML_Lib {
+class CBOR_Stringify final : public IStringify {
+public:
+  CBOR_Stringify() = default;
+  CBOR_Stringify &operator=(const CBOR_Stringify &other) = delete;
+  CBOR_Stringify(CBOR_Stringify &&other) = delete;
+  CBOR_Stringify &operator=(CBOR_Stringify &&other) = delete;
+  ~CBOR_Stringify() override = default;
+
+  /// <summary>
+  /// Recursively traverse Node structure encoding it into CBOR (RFC 8949) on
+  /// the destination stream passed in.
+  /// </summary>
+  /// <param name="yNode">Node structure to be traversed.</param>
+  /// <param name="destination">Destination stream for CBOR.</param>
+  /// <param name="indent">Current print indentation.</param>
+  void stringify(const Node &yNode, IDestination &destination,
+                 const unsigned long indent) const override {
+    stringifyNodes(yNode, destination, indent);
+  }
+
+private:
+  // CBOR major types
+  static constexpr uint8_t kUnsigned{0};
+  static constexpr uint8_t kNegative{1};
+  static constexpr uint8_t kText{3};
+  static constexpr uint8_t kArray{4};
+  static constexpr uint8_t kMap{5};
+  static constexpr uint8_t kTag{6};
+
+  static void stringifyNodes(const Node &yNode, IDestination &destination,
+                             [[maybe_unused]] const unsigned long indent) {
+    // A hole still occupies a slot in a counted array/map, so encode null.
+    if (isA<Hole>(yNode)) {
+      stringifyNull(yNode, destination);
+      return;
+    }
+    stringify_detail::dispatchStringifyNode(
+        yNode, destination, indent,
+        [](const Node &yNode, IDestination &destination, const long indent) {
+          stringifyDocument(yNode, destination, indent);
+        },
+        [](const Node &yNode, IDestination &destination) {
+          stringifyNumber(yNode, destination);
+        },
+        [](const Node &yNode, IDestination &destination) {
+          stringifyString(yNode, destination);
+        },
+        [](const Node &yNode, IDestination &destination) {
+          stringifyBoolean(yNode, destination);
+        },
+        [](const Node &yNode, IDestination &destination) {
+          stringifyNull(yNode, destination);
+        },
+        [](const Node &yNode, IDestination &destination) {
+          stringifyTimestamp(yNode, destination);
+        },
+        [](const Node &yNode, IDestination &destination) {
+          stringifyDictionary(yNode, destination);
+        },
+        [](const Node &yNode, IDestination &destination) {
+          stringifyAray(yNode, destination);
+        });
+  }
+  // Intentional parallel to JSON_Stringify/Bencode_Stringify: unwrap Document
+  // and recurse. Default_Stringify differs (emits --- / ... markers).
+  static void stringifyDocument(const Node &yNode, IDestination &destination,
+                                const long indent) {
+    stringify_detail::stringifyDocument(yNode, destination, indent, stringifyNodes);
+  }
+  // Initial byte (major type + additional info) followed by the shortest
+  // argument encoding.
+  static void addHead(IDestination &destination, const uint8_t majorType,
+                      const uint64_t argument) {
+    using stringify_detail::addBigEndian;
+    const auto initial = static_cast<uint8_t>(majorType << 5);
+    if (argument < 24) {
+      destination.add(static_cast<char>(initial | argument));
+    } else if (argument <= 0xff) {
+      destination.add(static_cast<char>(initial | 24));
+      addBigEndian(destination, argument, 1);
+    } else if (argument <= 0xffff) {
+      destination.add(static_cast<char>(initial | 25));
+      addBigEndian(destination, argument, 2);
+    } else if (argument <= 0xffffffff) {
+      destination.add(static_cast<char>(initial | 26));
+      addBigEndian(destination, argument, 4);
+    } else {
+      destination.add(static_cast<char>(initial | 27));
+      addBigEndian(destination, argument, 8);
+    }
+  }
+  static void addInteger(IDestination &destination, const long long value) {
+    if (value >= 0) {
+      addHead(destination, kUnsigned, static_cast<uint64_t>(value));
+    } else {
+      addHead(destination, kNegative, static_cast<uint64_t>(-(value + 1)));
+    }
+  }
+  static void addText(IDestination &destination, const std::string_view sv) {
+    addHead(destination, kText, sv.size());
+    destination.add(sv);
+  }
+  static void stringifyNumber(const Node &yNode, IDestination &destination) {
+    using stringify_detail::addBigEndian;
+    const auto &number = NRef<Number>(yNode);
+    if (number.is<int>() || number.is<long>() || number.is<long long>()) {
+      addInteger(destination, number.value<long long>());
+    } else if (number.is<float>()) {
+      destination.add(static_cast<char>(0xfa));
+      addBigEndian(destination, std::bit_cast<uint32_t>(number.value<float>()), 4);
+    } else {
+      destination.add(static_cast<char>(0xfb));
+      addBigEndian(destination, std::bit_cast<uint64_t>(number.value<double>()), 8);
+    }
+  }
+  static void stringifyString(const Node &yNode, IDestination &destination) {
+    addText(destination, NRef<String>(yNode).value());
+  }
+  static void stringifyBoolean(const Node &yNode, IDestination &destination) {
+    destination.add(static_cast<char>(NRef<Boolean>(yNode).value() ? 0xf5 : 0xf4));
+  }
+  static void stringifyNull([[maybe_unused]] const Node &yNode,
+                            IDestination &destination) {
+    destination.add(static_cast<char>(0xf6));
+  }
+  // Date-times become tag 0 (RFC 3339 text), dates tag 1 (epoch seconds of
+  // UTC midnight). Unparseable timestamps are written as plain text.
+  static void stringifyTimestamp(const Node &yNode, IDestination &destination) {
+    const auto raw = NRef<Timestamp>(yNode).value();
+    stringify_detail::TimestampParts parts;
+    if (!stringify_detail::parseTimestamp(raw, parts)) {
+      addText(destination, raw);
+    } else if (!parts.hasTime) {
+      addHead(destination, kTag, 1);
+      addInteger(destination, stringify_detail::toEpochSeconds(parts));
+    } else {
+      addHead(destination, kTag, 0);
+      addText(destination, toRFC3339(raw, parts));
+    }
+  }
+  static std::string toRFC3339(const std::string_view raw,
+                               const stringify_detail::TimestampParts &parts) {
+    const auto twoDigits = [](std::string &text, const long value) {
+      text += static_cast<char>('0' + value / 10);
+      text += static_cast<char>('0' + value % 10);
+    };
+    std::string text{raw.substr(0, 10)};
+    text += 'T';
+    twoDigits(text, parts.hour);
+    text += ':';
+    twoDigits(text, parts.minute);
+    text += ':';
+    twoDigits(text, parts.second);
+    if (!parts.fraction.empty()) {
+      text += '.';
+      text += parts.fraction;
+    }
+    if (parts.offsetMinutes == 0) {
+      text += 'Z';
+    } else {
+      const long offset = parts.offsetMinutes < 0 ? -parts.offsetMinutes
+                                                  : parts.offsetMinutes;
+      text += parts.offsetMinutes < 0 ? '-' : '+';
+      twoDigits(text, offset / 60);
+      text += ':';
+      twoDigits(text, offset % 60);
+    }
+    return text;
+  }
+  static void stringifyDictionary(const Node &yNode,
+                                  IDestination &destination) {
+    const auto &entries = NRef<Dictionary>(yNode).value();
+    addHead(destination, kMap, entries.size());
+    for (auto &entry : entries) {
+      addText(destination, entry.getKey());
+      stringifyNodes(entry.getNode(), destination, 0);
+    }
+  }
+  static void stringifyAray(const Node &yNode, IDestination &destination) {
+    const auto &entries = NRef<Array>(yNode).value();
+    addHead(destination, kArray, entries.size());
+    for (auto &entry : entries) {
+      stringifyNodes(entry, destination, 0);
+    }
+  }
+};
+} // namespace YAML_Lib
@@ -27,9 +27,12 @@ public:
                  const unsigned long indent) const override {
     stringifyNodes(yNode, destination, indent);
   }
-  // Indentation increment
+  // Indentation increment (process wide, like Number::setPrecision())
   void setIndentation(const unsigned long indentation) const {
-    yamlIndentation = indentation;
+    yamlIndentation.store(indentation, std::memory_order_relaxed);
+  }
+  [[nodiscard]] unsigned long getIndentation() const {
+    return yamlIndentation.load(std::memory_order_relaxed);
   }
 
 private:
@@ -85,7 +88,8 @@ private:
                                           const unsigned long indent) const {
     if (destination.last() == kLineFeed) {
       // Grow cache only when needed; reuse existing allocation otherwise.
-      static std::string indentBuf;
+      // Per thread, so that several threads may stringify at once.
+      thread_local std::string indentBuf;
       if (indentBuf.size() < indent) {
         indentBuf.assign(indent, kSpace);
       }
@@ -214,7 +218,7 @@ private:
         destination.add(kLineFeed);
       }
       stringifyNodes(entryNode.getNode(), destination,
-                     indent + yamlIndentation);
+                     indent + getIndentation());
       if (!isA<Array>(entryNode.getNode()) &&
           !isA<Dictionary>(entryNode.getNode()) &&
           !isA<Comment>(entryNode.getNode())) {
@@ -228,7 +232,7 @@ private:
       destination.add(calculateIndent(destination, indent));
       destination.add("- ");
       stringifyAnyBlockStyle(destination, entryNode);
-      stringifyNodes(entryNode, destination, indent + yamlIndentation);
+      stringifyNodes(entryNode, destination, indent + getIndentation());
       if (destination.last() != kLineFeed) {
         destination.add(kLineFeed);
       }
@@ -253,7 +257,7 @@ private:
     destination.add(kLineFeed);
   }
   // Current indentation level
-  inline static unsigned long yamlIndentation{2};
+  inline static std::atomic<unsigned long> yamlIndentation{2};
   // Translator (per-instance)
   std::unique_ptr<ITranslator> yamlTranslator_;
 };
@@ -9,9 +9,8 @@ namespace YAML_Lib {
 class JSON_Stringify final : public IStringify {
 public:
   explicit JSON_Stringify(std::unique_ptr<ITranslator> translator =
-                              std::make_unique<Default_Translator>()) {
-    jsonTranslator = std::move(translator);
-  }
+                              std::make_unique<Default_Translator>())
+      : jsonTranslator(std::move(translator)) {}
   JSON_Stringify &operator=(const JSON_Stringify &other) = delete;
   JSON_Stringify(JSON_Stringify &&other) = delete;
   JSON_Stringify &operator=(JSON_Stringify &&other) = delete;
@@ -30,65 +29,69 @@ public:
   }
 
 private:
-  static void stringifyNodes(const Node &yNode, IDestination &destination,
-                             [[maybe_unused]] const unsigned long indent) {
+  void stringifyNodes(const Node &yNode, IDestination &destination,
+                      [[maybe_unused]] const unsigned long indent) const {
     stringify_detail::dispatchStringifyNode(
         yNode, destination, indent,
-        [](const Node &yNode, IDestination &destination, const long indent) {
+        [this](const Node &yNode, IDestination &destination, const long indent) {
           stringifyDocument(yNode, destination, indent);
         },
-        [](const Node &yNode, IDestination &destination) {
+        [this](const Node &yNode, IDestination &destination) {
           stringifyNumber(yNode, destination);
         },
-        [](const Node &yNode, IDestination &destination) {
+        [this](const Node &yNode, IDestination &destination) {
           stringifyString(yNode, destination);
         },
-        [](const Node &yNode, IDestination &destination) {
+        [this](const Node &yNode, IDestination &destination) {
           stringifyBoolean(yNode, destination);
         },
-        [](const Node &yNode, IDestination &destination) {
+        [this](const Node &yNode, IDestination &destination) {
           stringifyNull(yNode, destination);
         },
-        [](const Node &yNode, IDestination &destination) {
+        [this](const Node &yNode, IDestination &destination) {
           stringifyTimestamp(yNode, destination);
         },
-        [](const Node &yNode, IDestination &destination) {
+        [this](const Node &yNode, IDestination &destination) {
           stringifyDictionary(yNode, destination);
         },
-        [](const Node &yNode, IDestination &destination) {
+        [this](const Node &yNode, IDestination &destination) {
           stringifyAray(yNode, destination);
         });
   }
 
   // Intentional parallel to XML_Stringify/Bencode_Stringify: unwrap Document
   // and recurse. Default_Stringify differs (emits --- / ... markers).
-  static void stringifyDocument(const Node &yNode, IDestination &destination,
-                                const long indent) {
-    stringify_detail::stringifyDocument(yNode, destination, indent, stringifyNodes);
+  void stringifyDocument(const Node &yNode, IDestination &destination,
+                         const long indent) const {
+    stringify_detail::stringifyDocument(
+        yNode, destination, indent,
+        [this](const Node &yNode, IDestination &destination, const long indent) {
+          stringifyNodes(yNode, destination, indent);
+        });
   }
-  static void stringifyNumber(const Node &yNode, IDestination &destination) {
+  void stringifyNumber(const Node &yNode, IDestination &destination) const {
     destination.add(NRef<Number>(yNode).toString());
   }
-  static void stringifyString(const Node &yNode, IDestination &destination) {
+  void stringifyString(const Node &yNode, IDestination &destination) const {
     const std::string_view yamlString = NRef<String>(yNode).value();
     destination.add("\"" + jsonTranslator->to(yamlString) + "\"");
   }
-  static void stringifyBoolean(const Node &yNode, IDestination &destination) {
+  void stringifyBoolean(const Node &yNode, IDestination &destination) const {
     stringify_detail::addBooleanLiteral(destination,
                                         NRef<Boolean>(yNode).value(),
                                         "true", "false");
   }
-  static void stringifyNull([[maybe_unused]] const Node &yNode,
-                            IDestination &destination) {
+  void stringifyNull([[maybe_unused]] const Node &yNode,
+                     IDestination &destination) const {
     destination.add("null");
   }
-  static void stringifyTimestamp(const Node &yNode, IDestination &destination) {
+  void stringifyTimestamp(const Node &yNode, IDestination &destination) const {
     destination.add('"');
     destination.add(std::string(NRef<Timestamp>(yNode).value()));
     destination.add('"');
   }
-  static void stringifyDictionary(const Node &yNode,
-                                  IDestination &destination) {
+  void stringifyDictionary(const Node &yNode,
+                           IDestination &destination) const {
     const auto &entries = NRef<Dictionary>(yNode).value();
     stringify_detail::addDelimited(
         destination, '{', '}', entries.size(), ",",
@@ -99,7 +102,7 @@ private:
           stringifyNodes(entry.getNode(), destination, 0);
         });
   }
-  static void stringifyAray(const Node &yNode, IDestination &destination) {
+  void stringifyAray(const Node &yNode, IDestination &destination) const {
     const auto &entries = NRef<Array>(yNode).value();
     stringify_detail::addDelimited(
         destination, '[', ']', entries.size(), ",",
@@ -108,7 +111,9 @@ private:
         });
   }
 
-  inline static std::unique_ptr<ITranslator> jsonTranslator;
+  // Per instance, so that stringifiers never share or replace a translator
+  // another thread is using.
+  std::unique_ptr<ITranslator> jsonTranslator;
 };
 
 } // namespace YAML_Lib
@@ -0,0 +1,199 @@
+#pragma once
+
+#include <bit>
+
+#include "YAML.hpp"
+#include "YAML_Core.hpp"
+#include "YAML_Stringify_Helper.hpp"
+
+namespace YAML_Lib {
+class MessagePack_Stringify final : public IStringify {
+public:
+  MessagePack_Stringify() = default;
+  MessagePack_Stringify &operator=(const MessagePack_Stringify &other) = delete;
+  MessagePack_Stringify(MessagePack_Stringify &&other) = delete;
+  MessagePack_Stringify &operator=(MessagePack_Stringify &&other) = delete;
+  ~MessagePack_Stringify() override = default;
+
+  /// <summary>
+  /// Recursively traverse Node structure encoding it into MessagePack on
+  /// the destination stream passed in.
+  /// </summary>
+  /// <param name="yNode">Node structure to be traversed.</param>
+  /// <param name="destination">Destination stream for MessagePack.</param>
+  /// <param name="indent">Current print indentation.</param>
+  void stringify(const Node &yNode, IDestination &destination,
+                 const unsigned long indent) const override {
+    stringifyNodes(yNode, destination, indent);
+  }
+
+private:
+  static void stringifyNodes(const Node &yNode, IDestination &destination,
+                             [[maybe_unused]] const unsigned long indent) {
+    // A hole still occupies a slot in a counted array/map, so encode nil.
+    if (isA<Hole>(yNode)) {
+      stringifyNull(yNode, destination);
+      return;
+    }
+    stringify_detail::dispatchStringifyNode(
+        yNode, destination, indent,
+        [](const Node &yNode, IDestination &destination, const long indent) {
+          stringifyDocument(yNode, destination, indent);
+        },
+        [](const Node &yNode, IDestination &destination) {
+          stringifyNumber(yNode, destination);
+        },
+        [](const Node &yNode, IDestination &destination) {
+          stringifyString(yNode, destination);
+        },
+        [](const Node &yNode, IDestination &destination) {
+          stringifyBoolean(yNode, destination);
+        },
+        [](const Node &yNode, IDestination &destination) {
+          stringifyNull(yNode, destination);
+        },
+        [](const Node &yNode, IDestination &destination) {
+          stringifyTimestamp(yNode, destination);
+        },
+        [](const Node &yNode, IDestination &destination) {
+          stringifyDictionary(yNode, destination);
+        },
+        [](const Node &yNode, IDestination &destination) {
+          stringifyAray(yNode, destination);
+        });
+  }
+  // Intentional parallel to JSON_Stringify/Bencode_Stringify: unwrap Document
+  // and recurse. Default_Stringify differs (emits --- / ... markers).
+  static void stringifyDocument(const Node &yNode, IDestination &destination,
+                                const long indent) {
+    stringify_detail::stringifyDocument(yNode, destination, indent, stringifyNodes);
+  }
+  // Smallest encoding that holds the value (positive/negative fixint,
+  // uint8-64, int8-64).
+  static void addInteger(IDestination &destination, const long long value) {
+    using stringify_detail::addBigEndian;
+    if (value >= 0) {
+      const auto unsignedValue = static_cast<uint64_t>(value);
+      if (unsignedValue <= 0x7f) {
+        destination.add(static_cast<char>(unsignedValue));
+      } else if (unsignedValue <= 0xff) {
+        destination.add(static_cast<char>(0xcc));
+        addBigEndian(destination, unsignedValue, 1);
+      } else if (unsignedValue <= 0xffff) {
+        destination.add(static_cast<char>(0xcd));
+        addBigEndian(destination, unsignedValue, 2);
+      } else if (unsignedValue <= 0xffffffff) {
+        destination.add(static_cast<char>(0xce));
+        addBigEndian(destination, unsignedValue, 4);
+      } else {
+        destination.add(static_cast<char>(0xcf));
+        addBigEndian(destination, unsignedValue, 8);
+      }
+    } else if (value >= -32) {
+      destination.add(static_cast<char>(value));
+    } else if (value >= INT8_MIN) {
+      destination.add(static_cast<char>(0xd0));
+      addBigEndian(destination, static_cast<uint64_t>(value), 1);
+    } else if (value >= INT16_MIN) {
+      destination.add(static_cast<char>(0xd1));
+      addBigEndian(destination, static_cast<uint64_t>(value), 2);
+    } else if (value >= INT32_MIN) {
+      destination.add(static_cast<char>(0xd2));
+      addBigEndian(destination, static_cast<uint64_t>(value), 4);
+    } else {
+      destination.add(static_cast<char>(0xd3));
+      addBigEndian(destination, static_cast<uint64_t>(value), 8);
+    }
+  }
+  // Container/string length header: fix form, then 8/16/32-bit forms
+  // (fix8 == 0 when the format has no 8-bit length form).
+  static void addLength(IDestination &destination, const std::size_t length,
+                        const unsigned char fixBase, const std::size_t fixLimit,
+                        const unsigned char length8,
+                        const unsigned char length16) {
+    using stringify_detail::addBigEndian;
+    if (length < fixLimit) {
+      destination.add(static_cast<char>(fixBase | length));
+    } else if (length8 != 0 && length <= 0xff) {
+      destination.add(static_cast<char>(length8));
+      addBigEndian(destination, length, 1);
+    } else if (length <= 0xffff) {
+      destination.add(static_cast<char>(length16));
+      addBigEndian(destination, length, 2);
+    } else if (length <= 0xffffffff) {
+      destination.add(static_cast<char>(length16 + 1));
+      addBigEndian(destination, length, 4);
+    } else {
+      YAML_THROW(IStringify::Error, "Value too large to encode as MessagePack.");
+    }
+  }
+  static void addString(IDestination &destination, const std::string_view sv) {
+    addLength(destination, sv.size(), 0xa0, 32, 0xd9, 0xda);
+    destination.add(sv);
+  }
+  static void stringifyNumber(const Node &yNode, IDestination &destination) {
+    using stringify_detail::addBigEndian;
+    const auto &number = NRef<Number>(yNode);
+    if (number.is<int>() || number.is<long>() || number.is<long long>()) {
+      addInteger(destination, number.value<long long>());
+    } else if (number.is<float>()) {
+      destination.add(static_cast<char>(0xca));
+      addBigEndian(destination, std::bit_cast<uint32_t>(number.value<float>()), 4);
+    } else {
+      destination.add(static_cast<char>(0xcb));
+      addBigEndian(destination, std::bit_cast<uint64_t>(number.value<double>()), 8);
+    }
+  }
+  static void stringifyString(const Node &yNode, IDestination &destination) {
+    addString(destination, NRef<String>(yNode).value());
+  }
+  static void stringifyBoolean(const Node &yNode, IDestination &destination) {
+    destination.add(static_cast<char>(NRef<Boolean>(yNode).value() ? 0xc3 : 0xc2));
+  }
+  static void stringifyNull([[maybe_unused]] const Node &yNode,
+                            IDestination &destination) {
+    destination.add(static_cast<char>(0xc0));
+  }
+  // Timestamp extension type (-1): timestamp 64 when the seconds fit in 34
+  // bits, otherwise timestamp 96. Unparseable timestamps are written as str.
+  static void stringifyTimestamp(const Node &yNode, IDestination &destination) {
+    using stringify_detail::addBigEndian;
+    stringify_detail::TimestampParts parts;
+    if (!stringify_detail::parseTimestamp(NRef<Timestamp>(yNode).value(), parts)) {
+      addString(destination, NRef<Timestamp>(yNode).value());
+      return;
+    }
+    const int64_t seconds = stringify_detail::toEpochSeconds(parts);
+    if (seconds >= 0 && (seconds >> 34) == 0) {
+      destination.add(static_cast<char>(0xd7));
+      destination.add(static_cast<char>(-1));
+      addBigEndian(destination,
+                   static_cast<uint64_t>(parts.nanoseconds) << 34 |
+                       static_cast<uint64_t>(seconds),
+                   8);
+    } else {
+      destination.add(static_cast<char>(0xc7));
+      destination.add(static_cast<char>(12));
+      destination.add(static_cast<char>(-1));
+      addBigEndian(destination, parts.nanoseconds, 4);
+      addBigEndian(destination, static_cast<uint64_t>(seconds), 8);
+    }
+  }
+  static void stringifyDictionary(const Node &yNode,
+                                  IDestination &destination) {
+    const auto &entries = NRef<Dictionary>(yNode).value();
+    addLength(destination, entries.size(), 0x80, 16, 0, 0xde);
+    for (auto &entry : entries) {
+      addString(destination, entry.getKey());
+      stringifyNodes(entry.getNode(), destination, 0);
+    }
+  }
+  static void stringifyAray(const Node &yNode, IDestination &destination) {
+    const auto &entries = NRef<Array>(yNode).value();
+    addLength(destination, entries.size(), 0x90, 16, 0, 0xdc);
+    for (auto &entry : entries) {
+      stringifyNodes(entry, destination, 0);
+    }
+  }
+};
+} // namespace YAML_Lib
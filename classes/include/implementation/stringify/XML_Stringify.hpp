@@ -10,9 +10,8 @@ namespace YAML_Lib {
 class XML_Stringify final : public IStringify {
 public:
   explicit XML_Stringify(std::unique_ptr<ITranslator> translator =
-                             std::make_unique<XML_Translator>()) {
-    xmlTranslator = std::move(translator);
-  }
+                             std::make_unique<XML_Translator>())
+      : xmlTranslator(std::move(translator)) {}
   XML_Stringify(const XML_Stringify &other) = delete;
   XML_Stringify &operator=(const XML_Stringify &other) = delete;
   XML_Stringify(XML_Stringify &&other) = delete;
@@ -35,60 +34,64 @@ public:
   }
 
 private:
-  static void stringifyNodes(const Node &yNode, IDestination &destination,
-                             const long indent) {
+  void stringifyNodes(const Node &yNode, IDestination &destination,
+                      const long indent) const {
     stringify_detail::dispatchStringifyNode(
         yNode, destination, indent,
-        [](const Node &yNode, IDestination &destination, const long indent) {
+        [this](const Node &yNode, IDestination &destination, const long indent) {
           stringifyDocument(yNode, destination, indent);
         },
-        [](const Node &yNode, IDestination &destination) {
+        [this](const Node &yNode, IDestination &destination) {
           stringifyNumber(yNode, destination);
         },
-        [](const Node &yNode, IDestination &destination) {
+        [this](const Node &yNode, IDestination &destination) {
           stringifyString(yNode, destination);
         },
-        [](const Node &yNode, IDestination &destination) {
+        [this](const Node &yNode, IDestination &destination) {
           stringifyBoolean(yNode, destination);
         },
-        [](const Node &yNode, IDestination &destination) {
+        [this](const Node &yNode, IDestination &destination) {
           stringifyNull(yNode, destination);
         },
-        [](const Node &yNode, IDestination &destination) {
+        [this](const Node &yNode, IDestination &destination) {
           stringifyTimestamp(yNode, destination);
         },
-        [](const Node &yNode, IDestination &destination) {
+        [this](const Node &yNode, IDestination &destination) {
           stringifyDictionary(yNode, destination);
         },
-        [](const Node &yNode, IDestination &destination) {
+        [this](const Node &yNode, IDestination &destination) {
           stringifyArray(yNode, destination);
         });
   }
   // Intentional parallel to JSON_Stringify/Bencode_Stringify: unwrap Document
   // and recurse. Default_Stringify differs (emits --- / ... markers).
-  static void stringifyDocument(const Node &yNode, IDestination &destination,
-                                const long indent) {
-    stringify_detail::stringifyDocument(yNode, destination, indent, stringifyNodes);
+  void stringifyDocument(const Node &yNode, IDestination &destination,
+                         const long indent) const {
+    stringify_detail::stringifyDocument(
+        yNode, destination, indent,
+        [this](const Node &yNode, IDestination &destination, const long indent) {
+          stringifyNodes(yNode, destination, indent);
+        });
   }
-  static void stringifyTimestamp(const Node &yNode, IDestination &destination) {
+  void stringifyTimestamp(const Node &yNode, IDestination &destination) const {
     destination.add(std::string(NRef<Timestamp>(yNode).value()));
   }
-  static void stringifyNumber(const Node &yNode, IDestination &destination) {
+  void stringifyNumber(const Node &yNode, IDestination &destination) const {
     destination.add(stringify_detail::integerToString(yNode));
   }
-  static void stringifyString(const Node &yNode, IDestination &destination) {
+  void stringifyString(const Node &yNode, IDestination &destination) const {
     destination.add(xmlTranslator->to(NRef<String>(yNode).value()));
   }
 
-  static void stringifyBoolean(const Node &yNode, IDestination &destination) {
+  void stringifyBoolean(const Node &yNode, IDestination &destination) const {
     destination.add(NRef<Boolean>(yNode).toString());
   }
 
-  static void stringifyNull([[maybe_unused]] const Node &yNode,
-                            [[maybe_unused]] IDestination &destination) {}
+  void stringifyNull([[maybe_unused]] const Node &yNode,
+                     [[maybe_unused]] IDestination &destination) const {}
 
-  static void stringifyDictionary(const Node &yNode,
-                                  IDestination &destination) {
+  void stringifyDictionary(const Node &yNode,
+                           IDestination &destination) const {
     for (const auto &yNodeNext : NRef<Dictionary>(yNode).value()) {
       std::string elementName{yNodeNext.getKey()};
       std::ranges::replace(elementName, ' ', '-');
@@ -97,7 +100,7 @@ private:
       destination.add("</" + elementName + ">");
     }
   }
-  static void stringifyArray(const Node &yNode, IDestination &destination) {
+  void stringifyArray(const Node &yNode, IDestination &destination) const {
     if (NRef<Array>(yNode).value().size() > 1) {
       for (const auto &bNodeNext : NRef<Array>(yNode).value()) {
         destination.add("<Row>");
@@ -107,7 +110,9 @@ private:
     }
   }
 
-  inline static std::unique_ptr<ITranslator> xmlTranslator;
+  // Per instance, so that stringifiers never share or replace a translator
+  // another thread is using.
+  std::unique_ptr<ITranslator> xmlTranslator;
 };
 
 } // namespace YAML_Lib
\ No newline at end of file
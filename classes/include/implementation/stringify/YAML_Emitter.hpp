@@ -0,0 +1,248 @@
+#pragma once
+
+#include "YAML.hpp"
+#include "YAML_Core.hpp"
+#include "JSON_Stringify.hpp"
+#include "XML_Stringify.hpp"
+
+namespace YAML_Lib {
+
+// -----------------------------------------------------------------------
+// Emitter — writes YAML, JSON or XML straight to an IDestination from
+// builder calls, without building a Node tree first:
+//
+//   Emitter emitter{destination};
+//   emitter.beginMap();
+//   emitter.value("name", "Alice");
+//   emitter.key("tags").beginSeq().scalar("a").scalar("b").end();
+//   emitter.end();
+//
+// Each top-level value is one document. The output is byte for byte what
+// stringify() gives for the same tree built with operator[] / initializer
+// lists (Default_Stringify, JSON_Stringify or XML_Stringify): scalars are
+// made into Nodes and written by those stringifiers (so quoting and
+// escaping go through Default_Translator / XML_Translator), and the
+// layout follows their indentation and separator rules. XML drops
+// sequences with fewer than two entries, as XML_Stringify does, so the
+// first entry of an XML sequence is held back until the second arrives.
+// -----------------------------------------------------------------------
+class Emitter {
+
+public:
+  YAML_MAKE_ERROR(Error, "Emitter Error");
+  enum class Format : uint8_t { yaml = 0, json, xml };
+
+  explicit Emitter(IDestination &destination, const Format format = Format::yaml)
+      : destination(destination), format(format) {
+    if (format == Format::yaml) {
+      auto yaml = std::make_unique<Default_Stringify>(
+          std::make_unique<Default_Translator>());
+      indentation = yaml->getIndentation();
+      stringifier = std::move(yaml);
+    } else if (format == Format::json) {
+      stringifier = std::make_unique<JSON_Stringify>();
+    }
+  }
+  Emitter(const Emitter &other) = delete;
+  Emitter &operator=(const Emitter &other) = delete;
+  Emitter(Emitter &&other) = delete;
+  Emitter &operator=(Emitter &&other) = delete;
+  ~Emitter() = default;
+
+  // Open a mapping / sequence as the next value.
+  Emitter &beginMap() { return begin(Frame::Kind::map); }
+  Emitter &beginSeq() { return begin(Frame::Kind::seq); }
+  // Close the innermost mapping or sequence.
+  Emitter &end() {
+    if (frames.empty()) {
+      YAML_THROW(Error, "end() called with no open mapping or sequence.");
+    }
+    if (frames.back().kind == Frame::Kind::map && frames.back().keyPending) {
+      YAML_THROW(Error, "Mapping key has no value.");
+    }
+    if (format == Format::json) {
+      output().add(frames.back().kind == Frame::Kind::map ? kRightCurlyBrace
+                                                          : kRightSquareBracket);
+    }
+    frames.pop_back();
+    endValue(true);
+    return *this;
+  }
+  // Next mapping key; its value follows as scalar()/beginMap()/beginSeq().
+  Emitter &key(const std::string_view name) {
+    if (frames.empty() || frames.back().kind != Frame::Kind::map ||
+        frames.back().keyPending) {
+      YAML_THROW(Error, "Key is only valid in a mapping, before its value.");
+    }
+    auto &frame = frames.back();
+    if (format == Format::yaml) {
+      output().add(indent(frame.indent));
+      output().add(name);
+      output().add(": ");
+    } else if (format == Format::json) {
+      if (frame.count != 0) {
+        output().add(kComma);
+      }
+      output().add('"' + jsonTranslator.to(name) + '"');
+      output().add(kColon);
+    } else {
+      frame.elementName = name;
+      std::ranges::replace(frame.elementName, ' ', '-');
+      output().add("<" + frame.elementName + ">");
+    }
+    frame.count++;
+    frame.keyPending = true;
+    return *this;
+  }
+  // Scalar value: arithmetic, bool, nullptr or anything convertible to
+  // std::string_view.
+  template <typename T> Emitter &scalar(const T &value) {
+    beginValue(false);
+    if constexpr (!std::is_same_v<T, std::nullptr_t> &&
+                  std::is_convertible_v<const T &, std::string_view>) {
+      writeScalar(Node(std::string(std::string_view(value))));
+    } else {
+      writeScalar(Node(value));
+    }
+    endValue(false);
+    return *this;
+  }
+  // Shorthand for key(name).scalar(value).
+  template <typename T> Emitter &value(const std::string_view name, const T &value) {
+    return key(name).scalar(value);
+  }
+
+private:
+  struct Frame {
+    enum class Kind : uint8_t { map = 0, seq };
+    Kind kind;
+    unsigned long indent{};
+    std::size_t count{};
+    bool keyPending{false};
+    // XML: element name of the entry being written.
+    std::string elementName;
+    // XML: first sequence entry, held until a second one arrives.
+    std::unique_ptr<BufferDestination> held;
+  };
+
+  Emitter &begin(const Frame::Kind kind) {
+    beginValue(true);
+    Frame frame{kind};
+    frame.indent = childIndent();
+    frames.push_back(std::move(frame));
+    if (format == Format::json) {
+      output().add(kind == Frame::Kind::map ? kLeftCurlyBrace : kLeftSquareBracket);
+    }
+    return *this;
+  }
+  // Separators / prefixes written before any value.
+  void beginValue(const bool container) {
+    if (frames.empty()) {
+      if (format == Format::yaml) {
+        output().add("---");
+        output().add(kLineFeed);
+      } else if (format == Format::xml) {
+        output().add(R"(<?xml version="1.0" encoding="UTF-8"?>)");
+        output().add("<root>");
+      }
+      return;
+    }
+    auto &frame = frames.back();
+    if (frame.kind == Frame::Kind::map) {
+      if (!frame.keyPending) {
+        YAML_THROW(Error, "Mapping value requires a key.");
+      }
+      frame.keyPending = false;
+      if (format == Format::yaml && container) {
+        output().add(kLineFeed);
+      }
+      return;
+    }
+    frame.count++;
+    if (format == Format::yaml) {
+      output().add(indent(frame.indent));
+      output().add("- ");
+    } else if (format == Format::json) {
+      if (frame.count > 1) {
+        output().add(kComma);
+      }
+    } else if (frame.count == 1) {
+      frame.held = std::make_unique<BufferDestination>();
+    } else {
+      if (frame.count == 2) {
+        const auto held = std::move(frame.held);
+        output().add("<Row>");
+        output().add(held->toString());
+        output().add("</Row>");
+      }
+      output().add("<Row>");
+    }
+  }
+  // Terminators written after any value.
+  void endValue(const bool container) {
+    if (frames.empty()) {
+      if (format == Format::yaml) {
+        if (output().last() != kLineFeed) {
+          output().add(kLineFeed);
+        }
+        output().add("...");
+        output().add(kLineFeed);
+      } else if (format == Format::xml) {
+        output().add("</root>");
+      }
+      return;
+    }
+    const auto &frame = frames.back();
+    if (frame.kind == Frame::Kind::map) {
+      if (format == Format::yaml && !container) {
+        output().add(kLineFeed);
+      } else if (format == Format::xml) {
+        output().add("</" + frame.elementName + ">");
+      }
+    } else if (format == Format::yaml) {
+      if (output().last() != kLineFeed) {
+        output().add(kLineFeed);
+      }
+    } else if (format == Format::xml && frame.count > 1) {
+      output().add("</Row>");
+    }
+  }
+  void writeScalar(const Node &yNode) {
+    if (stringifier) {
+      stringifier->stringify(yNode, output(), childIndent());
+    } else if (isA<Number>(yNode)) {
+      output().add(stringify_detail::integerToString(yNode));
+    } else if (isA<String>(yNode)) {
+      output().add(xmlTranslator.to(NRef<String>(yNode).value()));
+    } else if (isA<Boolean>(yNode)) {
+      output().add(NRef<Boolean>(yNode).toString());
+    }
+  }
+  // Where output currently goes: the innermost held XML entry, if any.
+  IDestination &output() {
+    for (auto frame = frames.rbegin(); frame != frames.rend(); ++frame) {
+      if (frame->held) {
+        return *frame->held;
+      }
+    }
+    return destination;
+  }
+  [[nodiscard]] unsigned long childIndent() const {
+    return frames.empty() ? 0 : frames.back().indent + indentation;
+  }
+  // Default_Stringify only indents at the start of a line.
+  std::string indent(const unsigned long width) {
+    return output().last() == kLineFeed ? std::string(width, kSpace)
+                                        : std::string();
+  }
+
+  IDestination &destination;
+  Format format;
+  std::unique_ptr<IStringify> stringifier;
+  Default_Translator jsonTranslator;
+  XML_Translator xmlTranslator;
+  unsigned long indentation{2};
+  std::vector<Frame> frames;
+};
+
+} // namespace YAML_Lib
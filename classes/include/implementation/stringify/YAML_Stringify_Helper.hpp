@@ -83,5 +83,130 @@ inline std::string integerToString(const Node &yNode) {
   return std::to_string(NRef<Number>(yNode).value<long long>());
 }
 
+// Write an unsigned integer of width bytes in network (big-endian) order, as
+// used by the MessagePack and CBOR binary formats.
+inline void addBigEndian(IDestination &destination, const uint64_t value,
+                         const unsigned width) {
+  char bytes[8];
+  for (unsigned index = 0; index < width; ++index) {
+    bytes[index] = static_cast<char>(value >> (8 * (width - 1 - index)));
+  }
+  destination.add(std::string_view(bytes, width));
+}
+
+// Broken-down YAML timestamp (YYYY-MM-DD[(T|t| )hh:mm:ss[.f][Z|+-hh[:mm]]]).
+struct TimestampParts {
+  int year{}, month{}, day{}, hour{}, minute{}, second{};
+  std::string_view fraction;
+  uint32_t nanoseconds{};
+  long offsetMinutes{};
+  bool hasTime{};
+};
+
+// Parse the YAML 1.1 timestamp forms; false when raw is not a valid timestamp.
+// A date-time without a zone designator is UTC (YAML timestamp type).
+inline bool parseTimestamp(std::string_view raw, TimestampParts &parts) {
+  const auto number = [&raw](const std::size_t start, const std::size_t length,
+                             int &value) {
+    if (start + length > raw.size()) {
+      return false;
+    }
+    value = 0;
+    for (std::size_t index = start; index < start + length; ++index) {
+      if (raw[index] < '0' || raw[index] > '9') {
+        return false;
+      }
+      value = value * 10 + (raw[index] - '0');
+    }
+    return true;
+  };
+  if (!number(0, 4, parts.year) || raw.size() < 10 || raw[4] != '-' ||
+      !number(5, 2, parts.month) || raw[7] != '-' || !number(8, 2, parts.day) ||
+      parts.month < 1 || parts.month > 12 || parts.day < 1 || parts.day > 31) {
+    return false;
+  }
+  if (raw.size() == 10) {
+    return true;
+  }
+  std::size_t position = 10;
+  if (raw[position] == 'T' || raw[position] == 't') {
+    position++;
+  } else {
+    while (position < raw.size() && (raw[position] == ' ' || raw[position] == '\t')) {
+      position++;
+    }
+  }
+  if (position == 10 || !number(position, 2, parts.hour) ||
+      position + 2 >= raw.size() || raw[position + 2] != ':' ||
+      !number(position + 3, 2, parts.minute) || position + 5 >= raw.size() ||
+      raw[position + 5] != ':' || !number(position + 6, 2, parts.second) ||
+      parts.hour > 23 || parts.minute > 59 || parts.second > 60) {
+    return false;
+  }
+  parts.hasTime = true;
+  position += 8;
+  if (position < raw.size() && raw[position] == '.') {
+    const std::size_t start = ++position;
+    while (position < raw.size() && raw[position] >= '0' && raw[position] <= '9') {
+      if (position - start < 9) {
+        parts.nanoseconds = parts.nanoseconds * 10 + (raw[position] - '0');
+      }
+      position++;
+    }
+    if (position == start) {
+      return false;
+    }
+    for (std::size_t digits = position - start; digits < 9; ++digits) {
+      parts.nanoseconds *= 10;
+    }
+    parts.fraction = raw.substr(start, position - start);
+  }
+  while (position < raw.size() && (raw[position] == ' ' || raw[position] == '\t')) {
+    position++;
+  }
+  if (position == raw.size()) {
+    return true;
+  }
+  if (raw[position] == 'Z' || raw[position] == 'z') {
+    return position + 1 == raw.size();
+  }
+  if (raw[position] != '+' && raw[position] != '-') {
+    return false;
+  }
+  const long sign = raw[position] == '-' ? -1 : 1;
+  int hours{}, minutes{};
+  std::size_t digits = position + 1;
+  if (number(digits, 2, hours)) {
+    digits += 2;
+  } else if (number(digits, 1, hours)) {
+    digits += 1;
+  } else {
+    return false;
+  }
+  if (digits < raw.size()) {
+    if (raw[digits] != ':' || !number(digits + 1, 2, minutes) ||
+        digits + 3 != raw.size()) {
+      return false;
+    }
+  }
+  parts.offsetMinutes = sign * (hours * 60L + minutes);
+  return true;
+}
+
+// Seconds since the Unix epoch (UTC) of a parsed timestamp.
+inline int64_t toEpochSeconds(const TimestampParts &parts) {
+  // Days from civil date (proleptic Gregorian calendar).
+  const int64_t year = parts.month <= 2 ? parts.year - 1 : parts.year;
+  const int64_t era = (year >= 0 ? year : year - 399) / 400;
+  const int64_t yearOfEra = year - era * 400;
+  const int64_t dayOfYear =
+      (153 * (parts.month + (parts.month > 2 ? -3 : 9)) + 2) / 5 + parts.day - 1;
+  const int64_t dayOfEra =
+      yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  const int64_t days = era * 146097 + dayOfEra - 719468;
+  return days * 86400 + parts.hour * 3600 + parts.minute * 60 + parts.second -
+         parts.offsetMinutes * 60;
+}
+
 } // namespace stringify_detail
 } // namespace YAML_Lib
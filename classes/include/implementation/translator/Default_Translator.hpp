@@ -19,7 +19,7 @@ constexpr char16_t kLowSurrogatesEnd{0xDFFF};
 class Default_Translator final : public ITranslator {
 public:
 
-  Default_Translator();
+  Default_Translator() = default;
   Default_Translator(const Default_Translator &other) = delete;
   Default_Translator &operator=(const Default_Translator &other) = delete;
   Default_Translator(Default_Translator &&other) = delete;
@@ -29,10 +29,7 @@ public:
   [[nodiscard]] std::string to(const std::string_view &rawString) const override;
   [[nodiscard]] std::string
   from([[maybe_unused]] const std::string_view &escapedString) const override;
-
-private:
-  // To/From escape sequence lookup maps
-  inline static std::unordered_map<char, char16_t> fromEscape;
-  inline static std::unordered_map<char16_t, char> toEscape;
+  [[nodiscard]] bool tryFrom(const std::string_view &escapedString,
+                             std::string &translated) const override;
 };
 } // namespace YAML_Lib
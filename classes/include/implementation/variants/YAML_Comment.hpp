@@ -5,8 +5,8 @@ namespace YAML_Lib {
 struct Comment {
   // Constructors/Destructors
   explicit Comment(const std::string_view &comment = "")
-      : yamlComment(std::string(comment)) {}
-  Comment(const Comment &other) = default;
+      : yamlComment(comment, nodeResource()) {}
+  Comment(const Comment &other) : yamlComment(other.yamlComment, nodeResource()) {}
   Comment &operator=(const Comment &other) = default;
   Comment(Comment &&other) = default;
   Comment &operator=(Comment &&other) = default;
@@ -14,11 +14,13 @@ struct Comment {
   // Return reference to comment
   [[nodiscard]] std::string_view value() const { return yamlComment; }
   // Return string representation of value
-  [[nodiscard]] std::string toString() const { return "# " + yamlComment; }
+  [[nodiscard]] std::string toString() const {
+    return "# " + std::string(yamlComment);
+  }
   // Convert variant to a key
   [[nodiscard]] std::string toKey() const { return ""; }
 
 private:
-  std::string yamlComment;
+  std::pmr::string yamlComment;
 };
 } // namespace YAML_Lib
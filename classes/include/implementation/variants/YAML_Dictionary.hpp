@@ -8,9 +8,9 @@ namespace YAML_Lib {
 // Dictionary entry
 struct DictionaryEntry {
   DictionaryEntry(const std::string_view &key, Node yNode, char quote = kNull)
-      : yNodeKey(key), yNodeKeyQuote(quote), yNode(std::move(yNode)) {}
+      : yNodeKey(key, nodeResource()), yNodeKeyQuote(quote), yNode(std::move(yNode)) {}
   DictionaryEntry(Node &keyNode, Node yNode)
-      : yNodeKey(std::get<String>(keyNode.getVariant()).toString()),
+      : yNodeKey(std::get<String>(keyNode.getVariant()).value(), nodeResource()),
         yNodeKeyQuote(std::get<String>(keyNode.getVariant()).getQuote()),
         yNode(std::move(yNode)) {}
   [[nodiscard]] std::string_view getKey() const { return yNodeKey; }
@@ -19,7 +19,7 @@ struct DictionaryEntry {
   [[nodiscard]] const Node &getNode() const { return yNode; }
 
 private:
-  std::string yNodeKey;
+  std::pmr::string yNodeKey;
   char yNodeKeyQuote{kNull};
   Node yNode;
 };
@@ -36,13 +36,26 @@ struct Dictionary {
   ~Dictionary() = default;
   // Add Entry to Dictionary; also registers the key in the O(1) lookup index
   template <typename T> void add(T &&entry) {
-    const std::string key{entry.getKey()};
-    yNodeDictionaryIndex[key] = yNodeDictionary.size();
+    std::pmr::string key{entry.getKey(), yNodeDictionaryIndex.get_allocator()};
+    {
+      AllocationScope scope{AllocationKind::dictionaryIndex};
+      yNodeDictionaryIndex.insert_or_assign(std::move(key), yNodeDictionary.size());
+    }
+    AllocationScope scope{AllocationKind::dictionaryEntries};
     yNodeDictionary.emplace_back(std::forward<T>(entry));
   }
+  // Make room for size entries in both the entry list and the index
+  void reserve(const std::size_t size) {
+    {
+      AllocationScope scope{AllocationKind::dictionaryIndex};
+      yNodeDictionaryIndex.reserve(size);
+    }
+    AllocationScope scope{AllocationKind::dictionaryEntries};
+    yNodeDictionary.reserve(size);
+  }
   // Return true if a dictionary contains a given key (O(1), no exception)
   [[nodiscard]] bool contains(const std::string_view &key) const noexcept {
-    return yNodeDictionaryIndex.count(std::string(key)) != 0;
+    return yNodeDictionaryIndex.contains(key);
   }
   // Return number of entries in a dictionary
   [[nodiscard]] int size() const {
@@ -63,19 +76,28 @@ struct Dictionary {
   [[nodiscard]] std::string toString() const { return ""; }
 
 private:
+  // Key hash usable with std::string_view so that lookups need no temporary
+  // key string
+  struct KeyHash {
+    using is_transparent = void;
+    std::size_t operator()(const std::string_view &key) const noexcept {
+      return std::hash<std::string_view>{}(key);
+    }
+  };
   // Search for a given entry by key using the O(1) hash-map index
   [[nodiscard]] Entries::iterator findKey(const std::string_view &key);
   [[nodiscard]] Entries::const_iterator findKey(const std::string_view &key) const;
 
   // Dictionary entries list (preserves insertion order for stringify)
-  Entries yNodeDictionary;
+  Entries yNodeDictionary{nodeResource()};
   // Hash-map index: key → position in yNodeDictionary (O(1) lookup)
-  std::pmr::unordered_map<std::string, std::size_t> yNodeDictionaryIndex;
+  std::pmr::unordered_map<std::pmr::string, std::size_t, KeyHash, std::equal_to<>>
+      yNodeDictionaryIndex{nodeResource()};
 };
 
 inline Dictionary::Entries::iterator
 Dictionary::findKey(const std::string_view &key) {
-  const auto indexIt = yNodeDictionaryIndex.find(std::string(key));
+  const auto indexIt = yNodeDictionaryIndex.find(key);
   if (indexIt == yNodeDictionaryIndex.end()) {
     YAML_THROW(Node::Error, "Invalid key used to access dictionary.");
   }
@@ -83,7 +105,7 @@ Dictionary::findKey(const std::string_view &key) {
 }
 inline Dictionary::Entries::const_iterator
 Dictionary::findKey(const std::string_view &key) const {
-  const auto indexIt = yNodeDictionaryIndex.find(std::string(key));
+  const auto indexIt = yNodeDictionaryIndex.find(key);
   if (indexIt == yNodeDictionaryIndex.end()) {
     YAML_THROW(Node::Error, "Invalid key used to access dictionary.");
   }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <charconv>
 
 namespace YAML_Lib {
@@ -34,10 +35,13 @@ struct Number {
   [[nodiscard]] std::string toString() const { return getAs<std::string>(); }
   // Convert variant to a key
   [[nodiscard]] std::string toKey() const { return getAs<std::string>(); }
-  // Set floating point to string conversion parameters
-  static void setPrecision(const int precision) { numberPrecision = precision; }
+  // Set floating point to string conversion parameters (process wide; safe to
+  // change while other threads stringify, which see the old or new value)
+  static void setPrecision(const int precision) {
+    numberPrecision.store(precision, std::memory_order_relaxed);
+  }
   static void setNotation(const numberNotation notation) {
-    numberNotation = notation;
+    numberNotation.store(notation, std::memory_order_relaxed);
   }
 
 private:
@@ -61,12 +65,12 @@ private:
   // Number values (variant)
   Values yNodeNumber;
   // Floating point to string parameters
-  inline static int numberPrecision{6};
-  inline static auto numberNotation{numberNotation::normal};
+  inline static std::atomic<int> numberPrecision{6};
+  inline static std::atomic<enum numberNotation> numberNotation{numberNotation::normal};
 };
 // Construct Number from value
 template <typename T> Number::Number(T value) {
-  if constexpr (std::is_same_v<T, std::string>) {
+  if constexpr (std::is_convertible_v<const T &, std::string_view>) {
     convertNumber(value);
   } else {
     yNodeNumber = value;
@@ -123,18 +127,19 @@ std::string Number::numberToString(const T &number) const {
   }
   std::ostringstream os;
   if constexpr (std::is_floating_point_v<T>) {
-    switch (numberNotation) {
+    const int precision = numberPrecision.load(std::memory_order_relaxed);
+    switch (numberNotation.load(std::memory_order_relaxed)) {
     case numberNotation::normal:
-      os << std::defaultfloat << std::setprecision(numberPrecision) << number;
+      os << std::defaultfloat << std::setprecision(precision) << number;
       break;
     case numberNotation::fixed:
-      os << std::fixed << std::setprecision(numberPrecision) << number;
+      os << std::fixed << std::setprecision(precision) << number;
       break;
     case numberNotation::scientific:
-      os << std::scientific << std::setprecision(numberPrecision) << number;
+      os << std::scientific << std::setprecision(precision) << number;
       break;
     default:
-      os << std::setprecision(numberPrecision) << number;
+      os << std::setprecision(precision) << number;
     }
     if (os.str().find('.') == std::string::npos) {
       return os.str() + ".0";
@@ -146,7 +151,7 @@ std::string Number::numberToString(const T &number) const {
 }
 // Convert value to another specified type
 template <typename T, typename U> T Number::convertTo(U value) const {
-  if constexpr (std::is_same_v<T, std::string>) {
+  if constexpr (std::is_convertible_v<const T &, std::string_view>) {
     return numberToString(value);
   } else {
     return static_cast<T>(value);
@@ -25,7 +25,14 @@ struct SequenceBase {
   SequenceBase &operator=(SequenceBase &&) = default;
   ~SequenceBase() = default;
 
-  void add(Entry yNode) { entries_.emplace_back(std::move(yNode)); }
+  void add(Entry yNode) {
+    AllocationScope scope{AllocationKind::sequences};
+    entries_.emplace_back(std::move(yNode));
+  }
+  void reserve(const std::size_t size) {
+    AllocationScope scope{AllocationKind::sequences};
+    entries_.reserve(size);
+  }
   [[nodiscard]] std::size_t size() const { return entries_.size(); }
   Entries &value() { return entries_; }
   [[nodiscard]] const Entries &value() const { return entries_; }
@@ -48,7 +55,7 @@ struct SequenceBase {
   void resize(const std::size_t index);
 
 protected:
-  Entries entries_;
+  Entries entries_{nodeResource()};
 };
 
 } // namespace YAML_Lib
@@ -7,8 +7,9 @@ struct String {
   String() = default;
   explicit String(const std::string_view &string,
                   const char quotes = kDoubleQuote)
-      : yNodeString(std::string(string)), quote(quotes) {}
-  String(const String &other) = default;
+      : yNodeString(string, nodeResource()), quote(quotes) {}
+  String(const String &other)
+      : yNodeString(other.yNodeString, nodeResource()), quote(other.quote) {}
   String &operator=(const String &other) = default;
   String(String &&other) = default;
   String &operator=(String &&other) = default;
@@ -17,14 +18,16 @@ struct String {
   // does not allow mutation of the underlying data.
   [[nodiscard]] std::string_view value() const { return yNodeString; }
   // Return string representation of value
-  [[nodiscard]] std::string toString() const { return yNodeString; }
+  [[nodiscard]] std::string toString() const { return std::string(yNodeString); }
   // Convert variant to a key
-  [[nodiscard]] std::string toKey() const { return yNodeString; }
+  [[nodiscard]] std::string toKey() const { return std::string(yNodeString); }
   // Return string type/quote of value
   [[nodiscard]] char getQuote() const { return quote; }
 
 private:
-  std::string yNodeString;
+  // Allocated from nodeResource() when constructed (the parse arena while
+  // parsing)
+  std::pmr::string yNodeString{nodeResource()};
   char quote{};
 };
 } // namespace YAML_Lib
@@ -12,27 +12,21 @@ namespace YAML_Lib {
 struct Timestamp {
   // Constructors/Destructors
   Timestamp() = default;
-  Timestamp(const Timestamp &other) = default;
+  Timestamp(const Timestamp &other) : rawValue(other.rawValue, nodeResource()) {}
   Timestamp &operator=(const Timestamp &other) = default;
   Timestamp(Timestamp &&other) = default;
   Timestamp &operator=(Timestamp &&other) = default;
   ~Timestamp() = default;
 
-  // Construct from string_view — copies into owned storage (both modes).
-  explicit Timestamp(const std::string_view &raw) : rawValue(raw) {}
-
-#ifndef YAML_LIB_TIMESTAMP_PARSE
-  // OFF mode: move constructor so the parser can hand over the extracted
-  // token string without an extra heap allocation.
-  explicit Timestamp(std::string &&raw) noexcept : rawValue(std::move(raw)) {}
-#endif
+  // Construct from string_view — copies into storage from nodeResource().
+  explicit Timestamp(const std::string_view &raw) : rawValue(raw, nodeResource()) {}
 
   // Return reference to raw timestamp string
   [[nodiscard]] std::string_view value() const { return rawValue; }
   // Return string representation
-  [[nodiscard]] std::string toString() const { return rawValue; }
+  [[nodiscard]] std::string toString() const { return std::string(rawValue); }
   // Convert variant to a key
-  [[nodiscard]] std::string toKey() const { return rawValue; }
+  [[nodiscard]] std::string toKey() const { return std::string(rawValue); }
 
 #ifdef YAML_LIB_TIMESTAMP_PARSE
   // -----------------------------------------------------------------------
@@ -77,6 +71,6 @@ private:
     return val;
   }
 #endif
-  std::string rawValue;
+  std::pmr::string rawValue{nodeResource()};
 };
 } // namespace YAML_Lib
@@ -33,5 +33,21 @@ public:
    * @return Vector of parsed Node objects (one per document).
    */
   virtual std::vector<Node> parse(ISource &source) = 0;
+  /**
+   * @brief Parse a YAML source stream into an existing (empty) vector.
+   *
+   * YAML objects parse through this so that the vector's storage can be
+   * reused from one parse to the next; override it to avoid building a
+   * new vector. The default moves in the result of parse().
+   * @param source Input source implementing ISource.
+   * @param documents Vector to receive the parsed Node objects.
+   */
+  virtual void parseInto(ISource &source, std::vector<Node> &documents) {
+    documents = parse(source);
+  }
 };
+// Make custom parser to pass to YAML constructor: Pointer is tidied up internally.
+template <typename T, typename... Args> IParser *makeParser(Args &&...args) {
+  return std::make_unique<T>(std::forward<Args>(args)...).release();
+}
 } // namespace YAML_Lib
\ No newline at end of file
@@ -96,6 +96,31 @@ public:
     }
     return ch;
   }
+  /**
+   * @brief Append characters to text up to (not including) the first one
+   * for which stop is true, or the end of the source. On a contiguous
+   * source each run of ordinary characters within a line is copied as one
+   * span; anything else goes through next() a character at a time.
+   * @param text String appended to.
+   * @param stop Predicate marking the terminating character.
+   */
+  template <typename String, typename Stop> void appendUntil(String &text, Stop stop) {
+    while (more() && !stop(current())) {
+      const std::string_view rest{remaining()};
+      std::size_t length = 0;
+      while (length < rest.size() && rest[length] != '\n' &&
+             !kForbiddenChar[static_cast<unsigned char>(rest[length])] &&
+             !stop(rest[length])) {
+        ++length;
+      }
+      if (length > 0) {
+        text.append(rest.data(), length);
+        skip(length);
+      } else {
+        text += append();
+      }
+    }
+  }
   // ==================================
   // Get current source stream position
   // ==================================
@@ -108,6 +133,19 @@ public:
   virtual void save() = 0;
   virtual void restore() = 0;
   virtual void discardSave() = 0;
+  /**
+   * @brief Get the unread bytes when the source is backed by contiguous
+   * memory (used by binary parsers that must bypass character validation).
+   * @return View of the remaining bytes; empty if not supported.
+   */
+  [[nodiscard]] virtual std::string_view remaining() const { return {}; }
+  /**
+   * @brief Advance over raw bytes without character validation.
+   * @param length Number of bytes to skip.
+   */
+  virtual void skip([[maybe_unused]] std::size_t length) {
+    YAML_THROW(Error, "Source does not support raw byte access.");
+  }
 
 protected:
   // ========================
@@ -172,12 +210,47 @@ protected:
   // Saved context
   // =============
   struct Context {
+    Context() = default; // trivial: ContextStack slots start uninitialised
     Context(const unsigned long line, const unsigned long col, const std::size_t pos)
         : lineNo(line), column(col), bufferPosition(pos) {}
-    unsigned long lineNo{};
-    unsigned long column{};
-    std::size_t bufferPosition{};
+    unsigned long lineNo;
+    unsigned long column;
+    std::size_t bufferPosition;
+  };
+  // Stack of saved contexts. The parser's look-ahead seldom nests saves
+  // more than a few deep, so the first kLocalContexts are held in the
+  // source itself and save() only goes to the heap beyond that.
+  class ContextStack {
+  public:
+    [[nodiscard]] const Context *begin() const {
+      return spilled_.empty() ? local_.data() : spilled_.data();
+    }
+    [[nodiscard]] const Context *end() const { return begin() + size_; }
+    [[nodiscard]] const Context &back() const { return begin()[size_ - 1]; }
+    void push_back(const Context &context) {
+      if (spilled_.empty() && size_ == local_.size()) {
+        spilled_.assign(local_.begin(), local_.end());
+      }
+      if (spilled_.empty()) {
+        local_[size_] = context;
+      } else {
+        spilled_.push_back(context);
+      }
+      ++size_;
+    }
+    void pop_back() {
+      if (!spilled_.empty()) {
+        spilled_.pop_back();
+      }
+      --size_;
+    }
+
+  private:
+    static constexpr std::size_t kLocalContexts{16};
+    std::array<Context, kLocalContexts> local_;
+    std::vector<Context> spilled_; // all contexts once more than local_ hold
+    std::size_t size_{};
   };
-  std::vector<Context> contexts;
+  ContextStack contexts;
 };
 } // namespace YAML_Lib
\ No newline at end of file
@@ -21,6 +21,16 @@ public:
   // =====================================================================
   [[nodiscard]] virtual std::string
   from(const std::string_view &escapedString) const = 0;
+  // =====================================================================
+  // Convert escape sequences as from() does but return false rather than
+  // throw when the string cannot be translated. The parser uses it for
+  // speculative probes; override it if from() can fail.
+  // =====================================================================
+  [[nodiscard]] virtual bool tryFrom(const std::string_view &escapedString,
+                                     std::string &translated) const {
+    translated = from(escapedString);
+    return true;
+  }
   // =========================================================================
   // Convert a string from raw character values (UTF8) so that it has character
   // escapes where applicable for its form.
@@ -88,6 +88,18 @@ unsigned long YAML::getNumberOfDocuments() const {
 void YAML::parse(ISource &source) const { implementation->parse(source); }
 void YAML::parse(ISource &&source) const { implementation->parse(source); }
 /// <summary>
+/// Parse YAML from source stream into the Node tree, reusing the arena of
+/// the previous tree.
+/// </summary>
+/// <param name="source"></param>
+void YAML::reparse(ISource &source) const { implementation->reparse(source); }
+void YAML::reparse(ISource &&source) const { implementation->reparse(source); }
+/// <summary>
+/// Return the arena owning the Node tree.
+/// </summary>
+/// <returns>Arena if Options::arena_tree was set, else nullptr.</returns>
+const ChainedArena *YAML::arena() const { return implementation->arena(); }
+/// <summary>
 /// Stringify Node tree to destination stream (file/buffer/network).
 /// </summary>
 /// <param name="destination"></param>
@@ -106,7 +118,7 @@ Node &YAML::document(const unsigned long index) {
   return implementation->document(index);
 }
 const Node &YAML::document(const unsigned long index) const {
-  return implementation->document(index);
+  return std::as_const(*implementation).document(index);
 }
 /// <summary>
 /// Recursively traverse Node structure calling IAction methods (read-only)
@@ -137,7 +149,7 @@ Node &YAML::operator[](const std::string_view &key) {
   return (*implementation)[key];
 }
 const Node &YAML::operator[](const std::string_view &key) const {
-  return (*implementation)[key];
+  return std::as_const(*implementation)[key];
 }
 /// <summary>
 /// Return array entry for the passed in index.
@@ -147,7 +159,7 @@ Node &YAML::operator[](const std::size_t index) {
   return (*implementation)[index];
 }
 const Node &YAML::operator[](const std::size_t index) const {
-  return (*implementation)[index];
+  return std::as_const(*implementation)[index];
 }
 /// <summary>
 /// Open a YAML file, read its contents into a string buffer and return
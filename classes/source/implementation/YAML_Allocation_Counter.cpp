@@ -0,0 +1,103 @@
+//
+// Class: AllocationCounter
+//
+// Description: Counting std::pmr::memory_resource adapter and the arena
+// size recommendation built on it.
+//
+// Dependencies: C++20 - Language standard features used.
+//
+
+#include "YAML_Impl.hpp"
+
+namespace YAML_Lib {
+
+/// <summary>
+/// Map an allocation size to its power-of-two histogram bucket.
+/// </summary>
+/// <param name="bytes">Allocation size.</param>
+/// <returns>Bucket index (0 for <= 16 bytes; last bucket for > 32 KiB).</returns>
+std::size_t AllocationCounter::histogramBucket(const std::size_t bytes) noexcept {
+  if (bytes <= 16) {
+    return 0;
+  }
+  return std::min(static_cast<std::size_t>(std::bit_width(bytes - 1)) - 4,
+                  kHistogramBuckets - 1);
+}
+/// <summary>
+/// Zero the counters. Live bytes are kept (and become the new peak) so that
+/// memory allocated before the reset still balances when it is freed.
+/// </summary>
+void AllocationCounter::resetStatistics() noexcept {
+  const uint64_t liveBytes = statistics_.liveBytes;
+  statistics_ = Statistics{};
+  statistics_.liveBytes = liveBytes;
+  statistics_.peakBytes = liveBytes;
+}
+/// <summary>
+/// Allocate from upstream and record the allocation.
+/// </summary>
+/// <param name="bytes">Allocation size.</param>
+/// <param name="alignment">Allocation alignment.</param>
+/// <returns>Pointer to the allocated memory.</returns>
+void *AllocationCounter::do_allocate(const std::size_t bytes,
+                                     const std::size_t alignment) {
+  void *pointer = upstream_->allocate(bytes, alignment);
+  auto kind = currentAllocationKind;
+  if (kind == AllocationKind::other && alignment == 1) {
+    kind = AllocationKind::strings;
+  }
+  statistics_.allocations++;
+  statistics_.bytes += bytes;
+  statistics_.alignmentSlack += alignment - 1;
+  statistics_.liveBytes += bytes;
+  statistics_.peakBytes = std::max(statistics_.peakBytes, statistics_.liveBytes);
+  statistics_.histogram[histogramBucket(bytes)]++;
+  auto &kindStatistics = statistics_.kinds[static_cast<std::size_t>(kind)];
+  kindStatistics.allocations++;
+  kindStatistics.bytes += bytes;
+  return pointer;
+}
+/// <summary>
+/// Return memory to upstream and record the release.
+/// </summary>
+/// <param name="pointer">Memory to release.</param>
+/// <param name="bytes">Allocation size.</param>
+/// <param name="alignment">Allocation alignment.</param>
+void AllocationCounter::do_deallocate(void *pointer, const std::size_t bytes,
+                                      const std::size_t alignment) {
+  upstream_->deallocate(pointer, bytes, alignment);
+  statistics_.deallocations++;
+  statistics_.liveBytes -= std::min<uint64_t>(bytes, statistics_.liveBytes);
+}
+/// <summary>
+/// Parse a source through the same pool-over-monotonic-buffer layering as
+/// MonotonicArena and size the buffer from what the pool asked for. The
+/// monotonic buffer never reuses memory, so every byte the pool requests
+/// (plus worst case alignment padding) must fit.
+/// </summary>
+/// <param name="source">Representative source to parse.</param>
+/// <param name="options">Parser limits (parser, stringifier and memory
+/// resource are ignored).</param>
+/// <returns>Recommended MonotonicArena capacity in bytes.</returns>
+std::size_t recommendArenaSize(ISource &source, const Options &options) {
+  constexpr std::size_t kGranularity{1024};
+  AllocationCounter buffer;
+  {
+    std::pmr::unsynchronized_pool_resource pool{&buffer};
+    Options parseOptions{options};
+    parseOptions.parser = nullptr;
+    parseOptions.stringifier = nullptr;
+    parseOptions.memory_resource = &pool;
+    const YAML yaml{parseOptions};
+    yaml.parse(source);
+  }
+  const auto statistics = buffer.getStatistics();
+  const auto required =
+      static_cast<std::size_t>(statistics.bytes + statistics.alignmentSlack);
+  return (required + kGranularity - 1) / kGranularity * kGranularity;
+}
+std::size_t recommendArenaSize(ISource &&source, const Options &options) {
+  return recommendArenaSize(source, options);
+}
+
+} // namespace YAML_Lib
@@ -28,7 +28,12 @@ YAML_Impl::YAML_Impl(IStringify *stringify, IParser *parser,
 
 YAML_Impl::YAML_Impl(const Options &options)
     : memoryResource{options.memory_resource} {
-  Default_Parser::setStrictBooleans(options.strict_booleans);
+  if (options.arena_tree) {
+    treeArena = std::make_unique<ChainedArena>(
+        ChainedArena::kDefaultBlockSize,
+        memoryResource != nullptr ? memoryResource : std::pmr::new_delete_resource());
+    memoryResource = treeArena->resource();
+  }
 
   if (options.parser == nullptr) {
     yamlParser = std::make_unique<Default_Parser>(
@@ -43,6 +48,8 @@ YAML_Impl::YAML_Impl(const Options &options)
   }
 }
 
+YAML_Impl::~YAML_Impl() { dropTree(); }
+
 std::string YAML_Impl::version() {
   std::stringstream versionString;
   versionString << "YAML_Lib Version  " << YAML_VERSION_MAJOR << "."
@@ -51,24 +58,69 @@ std::string YAML_Impl::version() {
 }
 
 void YAML_Impl::parse(ISource &source) {
-  // RAII guard: if the caller supplied a PMR resource, install it as the PMR
-  // default for the duration of parse so that all std::pmr::* containers
-  // created during parse (Array/Document entries, Dictionary entries/index)
-  // draw from that resource. The previous default is restored on scope exit.
-  // NOTE: this modifies the process-wide PMR default; single-threaded use only.
-  struct ResourceScope {
-    std::pmr::memory_resource *prev_;
-    const bool active_;
-    explicit ResourceScope(std::pmr::memory_resource *mr)
-        : prev_{mr ? std::pmr::get_default_resource() : nullptr},
-          active_{mr != nullptr} {
-      if (active_) std::pmr::set_default_resource(mr);
-    }
-    ~ResourceScope() {
-      if (active_) std::pmr::set_default_resource(prev_);
+  if (treeArena != nullptr) {
+    // The previous tree lives in the arena: drop it and hand the blocks back
+    // before parsing the next one.
+    dropTree();
+    treeArena->release();
+  }
+  parseTree(source);
+}
+
+void YAML_Impl::reparse(ISource &source) {
+  if (treeArena != nullptr) {
+    // As parse() but keep the blocks for the new tree.
+    dropTree();
+    treeArena->reset();
+  }
+  parseTree(source);
+}
+
+void YAML_Impl::copyTree(const YAML_Impl &other) {
+  dropTree();
+  TreeResourceScope scope{memoryResource};
+  yamlTree.reserve(other.yamlTree.size());
+  for (const auto &document : other.yamlTree) {
+    yamlTree.push_back(document.clone());
+  }
+  arenaOnlyTree = treeArena != nullptr;
+}
+
+void YAML_Impl::dropTree() {
+  if (arenaOnlyTree) {
+    // Nothing in the tree owns memory outside the arena, which is about to
+    // be reset or released: let go of each document rather than destroying
+    // its nodes one at a time.
+    for (auto &document : yamlTree) {
+      std::visit(
+          [](auto &value) {
+            if constexpr (requires { value.release(); }) {
+              static_cast<void>(value.release());
+            }
+          },
+          document.getVariant());
     }
-  } scope{memoryResource};
-  yamlTree = yamlParser->parse(source);
+    arenaOnlyTree = false;
+  }
+  yamlTree.clear();
+}
+
+void YAML_Impl::parseTree(ISource &source) {
+  // If the caller supplied a PMR resource, make it this thread's tree
+  // resource for the duration of parse so that every container and string
+  // created during parse (Array/Document entries, Dictionary entries/index,
+  // scalar values, keys and tags) draws from that resource. Other threads
+  // are unaffected.
+  TreeResourceScope scope{memoryResource};
+  // Empty the scratch tree on the way out, whether parse throws or not.
+  struct ParsedTreeGuard {
+    std::vector<Node> &tree_;
+    explicit ParsedTreeGuard(std::vector<Node> &tree) : tree_(tree) {}
+    ~ParsedTreeGuard() { tree_.clear(); }
+  } parsedTreeGuard{parsedTree};
+  yamlParser->parseInto(source, parsedTree);
+  yamlTree.swap(parsedTree);
+  arenaOnlyTree = treeArena != nullptr;
 }
 
 void YAML_Impl::stringify(IDestination &destination) const {
@@ -84,6 +136,7 @@ void YAML_Impl::traverse(IAction &action) {
   if (yamlTree.empty()) {
     YAML_THROW(Error, "No YAML to traverse.");
   }
+  arenaOnlyTree = false;
   traverseNodes(yamlTree[0][0], action);
 }
 void YAML_Impl::traverse(IAction &action) const {
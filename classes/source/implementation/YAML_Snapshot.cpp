@@ -0,0 +1,43 @@
+//
+// Class: Snapshot
+//
+// Description: Immutable YAML tree for sharing between threads.
+//
+// Dependencies: C++20 - Language standard features used.
+//
+
+#include "YAML_Impl.hpp"
+#include "YAML_Snapshot.hpp"
+
+namespace YAML_Lib {
+
+/// <summary>
+/// Parse a source into a new snapshot.
+/// </summary>
+/// <param name="source">YAML source.</param>
+/// <param name="options">Parser, stringifier, memory and limit options.</param>
+/// <returns>Shared pointer to the snapshot.</returns>
+std::shared_ptr<const Snapshot> Snapshot::make(ISource &source,
+                                               const Options &options) {
+  std::shared_ptr<Snapshot> snapshot{new Snapshot(options)};
+  snapshot->tree.parse(source);
+  return snapshot;
+}
+std::shared_ptr<const Snapshot> Snapshot::make(ISource &&source,
+                                               const Options &options) {
+  return make(source, options);
+}
+/// <summary>
+/// Deep copy the documents of a YAML object into a new snapshot.
+/// </summary>
+/// <param name="yaml">YAML object to copy.</param>
+/// <param name="options">Stringifier and memory options of the copy.</param>
+/// <returns>Shared pointer to the snapshot.</returns>
+std::shared_ptr<const Snapshot> Snapshot::make(const YAML &yaml,
+                                               const Options &options) {
+  std::shared_ptr<Snapshot> snapshot{new Snapshot(options)};
+  snapshot->tree.implementation->copyTree(*yaml.implementation);
+  return snapshot;
+}
+
+} // namespace YAML_Lib
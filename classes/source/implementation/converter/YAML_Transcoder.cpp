@@ -0,0 +1,335 @@
+//
+// Class: Transcoder
+//
+// Description: Validating conversion between UTF-8, UTF-16 and UTF-32
+// (in memory or byte encoded in either byte order) with an ASCII fast
+// path. Platform independent.
+//
+// Dependencies: C++20 - Language standard features used.
+//
+
+#include "YAML.hpp"
+#include "YAML_Core.hpp"
+
+namespace YAML_Lib {
+
+static constexpr char32_t kMaximumCodePoint{0x10FFFF};
+
+/// <summary>
+/// Append the UTF-8 encoding of a code point to a string.
+/// </summary>
+/// <param name="utf8">Buffer to append to.</param>
+/// <param name="codePoint">Valid Unicode scalar value.</param>
+void appendUtf8(std::string &utf8, const char32_t codePoint) {
+  if (codePoint < 0x80) {
+    utf8 += static_cast<char>(codePoint);
+  } else if (codePoint < 0x800) {
+    utf8 += static_cast<char>(0xC0 | codePoint >> 6);
+    utf8 += static_cast<char>(0x80 | (codePoint & 0x3F));
+  } else if (codePoint < 0x10000) {
+    utf8 += static_cast<char>(0xE0 | codePoint >> 12);
+    utf8 += static_cast<char>(0x80 | (codePoint >> 6 & 0x3F));
+    utf8 += static_cast<char>(0x80 | (codePoint & 0x3F));
+  } else {
+    utf8 += static_cast<char>(0xF0 | codePoint >> 18);
+    utf8 += static_cast<char>(0x80 | (codePoint >> 12 & 0x3F));
+    utf8 += static_cast<char>(0x80 | (codePoint >> 6 & 0x3F));
+    utf8 += static_cast<char>(0x80 | (codePoint & 0x3F));
+  }
+}
+
+/// <summary>
+/// Append a value to a byte buffer as width bytes in the given byte order.
+/// </summary>
+/// <param name="bytes">Buffer to append to.</param>
+/// <param name="value">Code unit/point.</param>
+/// <param name="width">Number of bytes (2 or 4).</param>
+/// <param name="order">Byte order.</param>
+static void appendUnit(std::string &bytes, const char32_t value,
+                       const int width, const std::endian order) {
+  for (int byte = 0; byte < width; ++byte) {
+    const int shift =
+        order == std::endian::big ? (width - 1 - byte) * 8 : byte * 8;
+    bytes += static_cast<char>(value >> shift & 0xFF);
+  }
+}
+
+/// <summary>
+/// Read a width byte code unit/point from bytes in the given byte order.
+/// </summary>
+/// <param name="bytes">Encoded data.</param>
+/// <param name="index">Offset of first byte.</param>
+/// <param name="width">Number of bytes (2 or 4).</param>
+/// <param name="order">Byte order.</param>
+/// <returns>Code unit/point.</returns>
+static char32_t readUnit(const std::string_view &bytes, const std::size_t index,
+                         const int width, const std::endian order) {
+  char32_t value{};
+  for (int byte = 0; byte < width; ++byte) {
+    const int position = order == std::endian::big ? byte : width - 1 - byte;
+    value = value << 8 | static_cast<unsigned char>(bytes[index + position]);
+  }
+  return value;
+}
+
+/// <summary>
+/// Decode the UTF-8 sequence starting at index, rejecting truncated and
+/// overlong sequences, encoded surrogates and code points above U+10FFFF.
+/// </summary>
+/// <param name="utf8">UTF-8 text.</param>
+/// <param name="index">Position of lead byte; moved past the sequence.</param>
+/// <returns>Code point of UTF-8 sequence.</returns>
+char32_t decodeUtf8(const std::string_view &utf8, std::size_t &index) {
+  const auto lead = static_cast<unsigned char>(utf8[index]);
+  if (lead < 0x80) {
+    ++index;
+    return lead;
+  }
+  std::size_t length{};
+  char32_t codePoint{};
+  char32_t minimum{};
+  if (lead >= 0xC2 && lead <= 0xDF) {
+    length = 2;
+    codePoint = lead & 0x1F;
+    minimum = 0x80;
+  } else if (lead >= 0xE0 && lead <= 0xEF) {
+    length = 3;
+    codePoint = lead & 0x0F;
+    minimum = 0x800;
+  } else if (lead >= 0xF0 && lead <= 0xF4) {
+    length = 4;
+    codePoint = lead & 0x07;
+    minimum = 0x10000;
+  }
+  if (length == 0 || utf8.size() - index < length) {
+    YAML_THROW(Error, "Invalid UTF-8 sequence.");
+  }
+  for (std::size_t trail = 1; trail < length; ++trail) {
+    const auto byte = static_cast<unsigned char>(utf8[index + trail]);
+    if ((byte & 0xC0) != 0x80) {
+      YAML_THROW(Error, "Invalid UTF-8 sequence.");
+    }
+    codePoint = codePoint << 6 | (byte & 0x3F);
+  }
+  if (codePoint < minimum || codePoint > kMaximumCodePoint ||
+      (codePoint >= kHighSurrogatesBegin && codePoint <= kLowSurrogatesEnd)) {
+    YAML_THROW(Error, "Invalid UTF-8 sequence.");
+  }
+  index += length;
+  return codePoint;
+}
+
+/// <summary>
+/// Decode UTF-8 passing each code point to emit. Eight byte blocks of
+/// ASCII are passed through without per byte validation.
+/// </summary>
+/// <param name="utf8">UTF-8 text.</param>
+/// <param name="emit">Called with each code point.</param>
+template <typename Emit>
+static void forEachCodePoint(const std::string_view &utf8, Emit emit) {
+  constexpr uint64_t kHighBits{0x8080808080808080};
+  const auto *bytes = reinterpret_cast<const unsigned char *>(utf8.data());
+  const std::size_t size = utf8.size();
+  std::size_t index{};
+  while (index < size) {
+    if (size - index >= sizeof(uint64_t)) {
+      uint64_t word;
+      std::memcpy(&word, bytes + index, sizeof(word));
+      if ((word & kHighBits) == 0) {
+        for (std::size_t byte = 0; byte < sizeof(word); ++byte) {
+          emit(static_cast<char32_t>(bytes[index + byte]));
+        }
+        index += sizeof(word);
+        continue;
+      }
+    }
+    emit(decodeUtf8(utf8, index));
+  }
+}
+
+/// <summary>
+/// Decode UTF-16 code units to UTF-8.
+/// </summary>
+/// <param name="count">Number of code units available.</param>
+/// <param name="unit">Returns code unit at an index.</param>
+/// <param name="utf8">Buffer to append to.</param>
+/// <param name="final">false if more units may follow.</param>
+/// <returns>Number of code units consumed.</returns>
+template <typename Unit>
+static std::size_t decodeUnits16(const std::size_t count, Unit unit,
+                                 std::string &utf8, const bool final) {
+  std::size_t index{};
+  while (index < count) {
+    const char32_t first = unit(index);
+    // ASCII
+    if (first < 0x80) {
+      utf8 += static_cast<char>(first);
+      ++index;
+      continue;
+    }
+    if (first < kHighSurrogatesBegin || first > kLowSurrogatesEnd) {
+      appendUtf8(utf8, first);
+      ++index;
+      continue;
+    }
+    if (first >= kLowSurrogatesBegin) {
+      YAML_THROW(Error, "Invalid UTF-16 sequence.");
+    }
+    if (index + 1 == count) {
+      if (!final) {
+        break;
+      }
+      YAML_THROW(Error, "Invalid UTF-16 sequence.");
+    }
+    const char32_t second = unit(index + 1);
+    if (second < kLowSurrogatesBegin || second > kLowSurrogatesEnd) {
+      YAML_THROW(Error, "Invalid UTF-16 sequence.");
+    }
+    appendUtf8(utf8, 0x10000 + ((first - kHighSurrogatesBegin) << 10) +
+                         (second - kLowSurrogatesBegin));
+    index += 2;
+  }
+  return index;
+}
+
+/// <summary>
+/// Convert UTF-8 to UTF-16 code units.
+/// </summary>
+/// <param name="utf8">UTF-8 text.</param>
+/// <param name="utf16">Buffer to append to.</param>
+void utf8ToUtf16(const std::string_view &utf8, std::u16string &utf16) {
+  utf16.reserve(utf16.size() + utf8.size());
+  forEachCodePoint(utf8, [&utf16](const char32_t codePoint) {
+    if (codePoint < 0x10000) {
+      utf16 += static_cast<char16_t>(codePoint);
+    } else {
+      utf16 += static_cast<char16_t>(kHighSurrogatesBegin + ((codePoint - 0x10000) >> 10));
+      utf16 += static_cast<char16_t>(kLowSurrogatesBegin + ((codePoint - 0x10000) & 0x3FF));
+    }
+  });
+}
+/// <summary>
+/// Convert UTF-16 code units to UTF-8.
+/// </summary>
+/// <param name="utf16">UTF-16 text.</param>
+/// <param name="utf8">Buffer to append to.</param>
+void utf16ToUtf8(const std::u16string_view &utf16, std::string &utf8) {
+  utf8.reserve(utf8.size() + utf16.size());
+  decodeUnits16(
+      utf16.size(), [&utf16](const std::size_t index) { return utf16[index]; },
+      utf8, true);
+}
+
+/// <summary>
+/// Convert UTF-8 to UTF-32.
+/// </summary>
+/// <param name="utf8">UTF-8 text.</param>
+/// <returns>UTF-32 text.</returns>
+std::u32string toUtf32(const std::string_view &utf8) {
+  std::u32string utf32;
+  utf32.reserve(utf8.size());
+  forEachCodePoint(utf8, [&utf32](const char32_t codePoint) { utf32 += codePoint; });
+  return utf32;
+}
+/// <summary>
+/// Convert UTF-32 to UTF-8.
+/// </summary>
+/// <param name="utf32">UTF-32 text.</param>
+/// <returns>UTF-8 text.</returns>
+std::string toUtf8(const std::u32string_view &utf32) {
+  std::string utf8;
+  utf8.reserve(utf32.size());
+  for (const char32_t codePoint : utf32) {
+    if (codePoint > kMaximumCodePoint ||
+        (codePoint >= kHighSurrogatesBegin && codePoint <= kLowSurrogatesEnd)) {
+      YAML_THROW(Error, "Invalid UTF-32 code point.");
+    }
+    appendUtf8(utf8, codePoint);
+  }
+  return utf8;
+}
+
+/// <summary>
+/// Decode byte encoded UTF-16 to UTF-8.
+/// </summary>
+/// <param name="bytes">UTF-16 data (no byte order mark).</param>
+/// <param name="order">Byte order of data.</param>
+/// <param name="utf8">Buffer to append to.</param>
+/// <param name="final">false if more data may follow.</param>
+/// <returns>Number of bytes consumed.</returns>
+std::size_t decodeUtf16(const std::string_view &bytes, const std::endian order,
+                        std::string &utf8, const bool final) {
+  if (final && bytes.size() % 2 != 0) {
+    YAML_THROW(Error, "Truncated UTF-16 data.");
+  }
+  utf8.reserve(utf8.size() + bytes.size() / 2);
+  return 2 * decodeUnits16(
+                 bytes.size() / 2,
+                 [&bytes, order](const std::size_t index) {
+                   return readUnit(bytes, index * 2, 2, order);
+                 },
+                 utf8, final);
+}
+/// <summary>
+/// Decode byte encoded UTF-32 to UTF-8.
+/// </summary>
+/// <param name="bytes">UTF-32 data (no byte order mark).</param>
+/// <param name="order">Byte order of data.</param>
+/// <param name="utf8">Buffer to append to.</param>
+/// <param name="final">false if more data may follow.</param>
+/// <returns>Number of bytes consumed.</returns>
+std::size_t decodeUtf32(const std::string_view &bytes, const std::endian order,
+                        std::string &utf8, const bool final) {
+  if (final && bytes.size() % 4 != 0) {
+    YAML_THROW(Error, "Truncated UTF-32 data.");
+  }
+  const std::size_t length = bytes.size() - bytes.size() % 4;
+  utf8.reserve(utf8.size() + length / 4);
+  for (std::size_t index = 0; index < length; index += 4) {
+    const char32_t codePoint = readUnit(bytes, index, 4, order);
+    if (codePoint < 0x80) {
+      utf8 += static_cast<char>(codePoint);
+      continue;
+    }
+    if (codePoint > kMaximumCodePoint ||
+        (codePoint >= kHighSurrogatesBegin && codePoint <= kLowSurrogatesEnd)) {
+      YAML_THROW(Error, "Invalid UTF-32 code point.");
+    }
+    appendUtf8(utf8, codePoint);
+  }
+  return length;
+}
+
+/// <summary>
+/// Encode UTF-8 as byte encoded UTF-16.
+/// </summary>
+/// <param name="utf8">UTF-8 text.</param>
+/// <param name="order">Byte order to write.</param>
+/// <param name="bytes">Buffer to append to.</param>
+void encodeUtf16(const std::string_view &utf8, const std::endian order,
+                 std::string &bytes) {
+  bytes.reserve(bytes.size() + utf8.size() * 2);
+  forEachCodePoint(utf8, [&bytes, order](const char32_t codePoint) {
+    if (codePoint < 0x10000) {
+      appendUnit(bytes, codePoint, 2, order);
+    } else {
+      appendUnit(bytes, kHighSurrogatesBegin + ((codePoint - 0x10000) >> 10), 2, order);
+      appendUnit(bytes, kLowSurrogatesBegin + ((codePoint - 0x10000) & 0x3FF), 2, order);
+    }
+  });
+}
+/// <summary>
+/// Encode UTF-8 as byte encoded UTF-32.
+/// </summary>
+/// <param name="utf8">UTF-8 text.</param>
+/// <param name="order">Byte order to write.</param>
+/// <param name="bytes">Buffer to append to.</param>
+void encodeUtf32(const std::string_view &utf8, const std::endian order,
+                 std::string &bytes) {
+  bytes.reserve(bytes.size() + utf8.size() * 4);
+  forEachCodePoint(utf8, [&bytes, order](const char32_t codePoint) {
+    appendUnit(bytes, codePoint, 4, order);
+  });
+}
+
+} // namespace YAML_Lib
@@ -11,9 +11,6 @@
 
 namespace YAML_Lib {
 
-static std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t>
-    utf16Converter;
-
 /// <summary>
 /// Convert utf8 <-> utf16 strings.
 /// </summary>
@@ -21,13 +18,17 @@ std::u16string toUtf16(const std::string_view &utf8) {
   if (utf8.find(kNull) != std::string::npos) {
     YAML_THROW(Error, "Tried to convert a null character.");
   }
-  return utf16Converter.from_bytes(std::string(utf8));
+  std::u16string utf16;
+  utf8ToUtf16(utf8, utf16);
+  return utf16;
 }
 std::string toUtf8(const std::u16string_view &utf16) {
   if (utf16.find(static_cast<char16_t>(kNull)) != std::string::npos) {
     YAML_THROW(Error, "Tried to convert a null character.");
   }
-  return utf16Converter.to_bytes(std::u16string(utf16));
+  std::string utf8;
+  utf16ToUtf8(utf16, utf8);
+  return utf8;
 }
 
 } // namespace YAML_Lib
@@ -17,6 +17,9 @@
 
 namespace YAML_Lib {
 
+// Byte order mark (U+FEFF) encoded as UTF-8.
+constexpr std::string_view kByteOrderMark{"\xEF\xBB\xBF"};
+
 /// <summary>
 /// Write YAML string to a file stream.
 /// </summary>
@@ -24,28 +27,14 @@ namespace YAML_Lib {
 /// <param name="yamlString">YAML string</param>
 void writeYAMLString(std::ofstream &yamlFile, const std::string_view &yamlString) { yamlFile << yamlString; }
 /// <summary>
-/// Write YAML string to a file stream.
+/// Return byte order of a UTF-16/UTF-32 file format.
 /// </summary>
-/// <param name="yamlFile">YAML file stream</param>
-/// <param name="yamlString">YAML string</param>
 /// <param name="format">YAML file format</param>
-void writeYAMLString(std::ofstream &yamlFile, const std::u16string &yamlString, const YAML::Format format)
+/// <returns>Byte order of format.</returns>
+std::endian byteOrder(const YAML::Format format)
 {
-    if (format == YAML::Format::utf16BE) {
-        yamlFile << static_cast<unsigned char>(0xFE) << static_cast<unsigned char>(0xFF);
-        for (const auto ch : yamlString) {
-            yamlFile.put(static_cast<char>(ch >> 8));
-            yamlFile.put(static_cast<char>(ch));
-        }
-    } else if (format == YAML::Format::utf16LE) {
-        yamlFile << static_cast<char>(0xFF) << static_cast<char>(0xFE);
-        for (const auto ch : yamlString) {
-            yamlFile.put(static_cast<char>(ch));
-            yamlFile.put(static_cast<char>(ch >> 8));
-        }
-    } else {
-        YAML_THROW(Error, "Unsupported YAML file format (Byte Order Mark) specified in call to writeYAMLString().");
-    }
+    return format == YAML::Format::utf16BE || format == YAML::Format::utf32BE ? std::endian::big
+                                                                                : std::endian::little;
 }
 
 /// <summary>
@@ -59,29 +48,33 @@ std::string readYAMLString(const std::ifstream &yamlFile)
     yamlFileBuffer << yamlFile.rdbuf();
     return yamlFileBuffer.str();
 }
-std::u16string readYAMLString(std::ifstream &yamlFile, const YAML::Format format)
+
+/// <summary>
+/// Decode a UTF-16/UTF-32 file stream to UTF-8 a block at a time, carrying
+/// any incomplete trailing unit (or unpaired high surrogate) over to the
+/// next block.
+/// </summary>
+/// <param name="yamlFile">YAML file stream (positioned after byte order mark)</param>
+/// <param name="order">Byte order of file data</param>
+/// <param name="decode">decodeUtf16 or decodeUtf32</param>
+/// <returns>YAML string.</returns>
+template<typename Decoder> std::string decodeYAMLFile(std::ifstream &yamlFile, const std::endian order, Decoder decode)
 {
-    std::u16string utf16String;
-    // Move past byte order mark
-    yamlFile.seekg(2);
-    if (format == YAML::Format::utf16BE)
-        while (true) {
-            char16_t ch16 = static_cast<char>(yamlFile.get()) << 8;
-            ch16 |= static_cast<char>(yamlFile.get());
-            if (yamlFile.eof()) break;
-            utf16String.push_back(ch16);
-        }
-    else if (format == YAML::Format::utf16LE) {
-        while (true) {
-            char16_t ch16 = static_cast<char>(yamlFile.get());
-            ch16 |= static_cast<char>(yamlFile.get()) << 8;
-            if (yamlFile.eof()) break;
-            utf16String.push_back(ch16);
-        }
-    } else {
-        YAML_THROW(Error, "Unsupported YAML file format (Byte Order Mark) specified in call to readYAMLString().");
+    constexpr std::size_t kBlockSize{ 64 * 1024 };
+    std::string translated;
+    std::string block;
+    std::size_t pending = 0;
+    bool final = false;
+    while (!final) {
+        block.resize(pending + kBlockSize);
+        yamlFile.read(block.data() + pending, kBlockSize);
+        block.resize(pending + static_cast<std::size_t>(yamlFile.gcount()));
+        final = !yamlFile;
+        const std::size_t consumed = decode(block, order, translated, final);
+        pending = block.size() - consumed;
+        block.erase(0, consumed);
     }
-    return utf16String;
+    return translated;
 }
 
 /// <summary>
@@ -115,7 +108,6 @@ YAML::Format YAML_Impl::getFileFormat(const std::string_view &fileName)
 /// <returns>YAML string.</returns>
 std::string YAML_Impl::fromFile(const std::string_view &fileName)
 {
-    const auto kCRLF = "\x0D\x0A";
     // Get file format
     const YAML::Format format = getFileFormat(fileName);
     // Read in YAML
@@ -129,19 +121,27 @@ std::string YAML_Impl::fromFile(const std::string_view &fileName)
         break;
     case YAML::Format::utf16BE:
     case YAML::Format::utf16LE:
-        translated = toUtf8(readYAMLString(yamlFile, format));
+        yamlFile.seekg(2);// Move past byte order mark
+        translated = decodeYAMLFile(yamlFile, byteOrder(format), decodeUtf16);
+        break;
+    case YAML::Format::utf32BE:
+    case YAML::Format::utf32LE:
+        yamlFile.seekg(4);// Move past byte order mark
+        translated = decodeYAMLFile(yamlFile, byteOrder(format), decodeUtf32);
         break;
     default:
         YAML_THROW(Error, "Unsupported YAML file format (Byte Order Mark) encountered.");
     }
     yamlFile.close();
-    // Translate CRLF -> LF
-    size_t pos = translated.find(kCRLF);
-    while (pos != std::string::npos) {
-        const auto kLF = "\x0A";
-        translated.replace(pos, 2, kLF);
-        pos = translated.find(kCRLF, pos + 1);
+    // Translate CRLF -> LF (in place, one pass)
+    std::size_t out = 0;
+    for (std::size_t in = 0; in < translated.size(); ++in) {
+        if (translated[in] == kCarriageReturn && in + 1 < translated.size() && translated[in + 1] == kLineFeed) {
+            continue;
+        }
+        translated[out++] = translated[in];
     }
+    translated.resize(out);
     return translated;
 }
 
@@ -162,9 +162,21 @@ void YAML_Impl::toFile(const std::string_view &fileName, const std::string_view
         writeYAMLString(yamlFile, yamlString);
         break;
     case YAML::Format::utf16BE:
-    case YAML::Format::utf16LE:
-        writeYAMLString(yamlFile, toUtf16(yamlString), format);
+    case YAML::Format::utf16LE: {
+        std::string encoded;
+        encodeUtf16(kByteOrderMark, byteOrder(format), encoded);
+        encodeUtf16(yamlString, byteOrder(format), encoded);
+        writeYAMLString(yamlFile, encoded);
         break;
+    }
+    case YAML::Format::utf32BE:
+    case YAML::Format::utf32LE: {
+        std::string encoded;
+        encodeUtf32(kByteOrderMark, byteOrder(format), encoded);
+        encodeUtf32(yamlString, byteOrder(format), encoded);
+        writeYAMLString(yamlFile, encoded);
+        break;
+    }
     default:
         YAML_THROW(Error, "Unsupported YAML file format (Byte Order Mark) specified.");
     }
@@ -0,0 +1,106 @@
+//
+// Class: Async_Parser
+//
+// Description: Coroutine awaitable over Incremental_Parser; resumes the
+// waiting coroutine when fed data completes a document.
+//
+// Dependencies: C++20 - Language standard features used.
+//
+
+#include "YAML_Impl.hpp"
+#include "Async_Parser.hpp"
+
+namespace YAML_Lib {
+
+/// <summary>
+/// Pass received bytes to the incremental parser and resume the waiting
+/// coroutine if they completed a document (or failed to parse).
+/// </summary>
+/// <param name="chunk">Bytes received.</param>
+void Async_Parser::feed(const std::span<const char> chunk) {
+  if (finished) {
+    YAML_THROW(IParser::Error, "Async_Parser fed after finish().");
+  }
+#ifndef YAML_LIB_NO_EXCEPTIONS
+  try {
+    parser.feed(chunk);
+  } catch (...) {
+    keepError(std::current_exception());
+  }
+#else
+  // Parse errors go to the panic handler; there is nothing to capture.
+  parser.feed(chunk);
+#endif
+  resumeWaiting();
+}
+/// <summary>
+/// Flush the last document and resume the waiting coroutine, which then
+/// sees std::nullopt once the queued documents are taken.
+/// </summary>
+void Async_Parser::finish() {
+#ifndef YAML_LIB_NO_EXCEPTIONS
+  try {
+    parser.finish();
+  } catch (...) {
+    keepError(std::current_exception());
+  }
+#else
+  parser.finish();
+#endif
+  finished = true;
+  resumeWaiting();
+}
+/// <summary>
+/// Hold a parse error for the coroutine unless an earlier one is still
+/// waiting to be delivered.
+/// </summary>
+/// <param name="failure">Parse error.</param>
+void Async_Parser::keepError(std::exception_ptr failure) {
+  if (!error) {
+    error = std::move(failure);
+  }
+}
+/// <summary>
+/// Incremental_Parser sink: queue a completed document.
+/// </summary>
+/// <param name="document">Completed Document node.</param>
+/// <param name="context">Owning Async_Parser.</param>
+void Async_Parser::queueDocument(Node &&document, void *context) {
+  static_cast<Async_Parser *>(context)->documents.push_back(std::move(document));
+}
+/// <summary>
+/// Resume the waiting coroutine if its co_await can now complete.
+/// </summary>
+void Async_Parser::resumeWaiting() {
+  if (waiting && Awaiter{*this}.await_ready()) {
+    std::exchange(waiting, nullptr).resume();
+  }
+}
+/// <summary>
+/// Park the coroutine until feed()/finish() can complete its co_await.
+/// </summary>
+/// <param name="handle">Suspended coroutine.</param>
+void Async_Parser::Awaiter::await_suspend(const std::coroutine_handle<> handle) {
+  if (parser.waiting) {
+    YAML_THROW(IParser::Error, "Async_Parser already has a waiting coroutine.");
+  }
+  parser.waiting = handle;
+}
+/// <summary>
+/// Take the next document, rethrow a pending parse error, or return
+/// std::nullopt at end of stream.
+/// </summary>
+/// <returns>Next Document node, if any.</returns>
+std::optional<Node> Async_Parser::Awaiter::await_resume() {
+  if (!parser.documents.empty()) {
+    Node document(std::move(parser.documents.front()));
+    parser.documents.pop_front();
+    return document;
+  }
+  if (parser.error) {
+    std::rethrow_exception(std::exchange(parser.error, nullptr));
+  }
+  return std::nullopt;
+}
+
+} // namespace YAML_Lib
@@ -0,0 +1,193 @@
+//
+// Class: Binary_Parser
+//
+// Description: Decode binary snapshot frames (written by Binary_Stringify)
+// back into a Node tree without any text scanning.
+//
+// Dependencies: C++20 - Language standard features used.
+//
+
+#include "YAML_Impl.hpp"
+#include "Binary_Parser.hpp"
+
+namespace YAML_Lib {
+
+/// <summary>
+/// Decode every snapshot frame on the source stream.
+/// </summary>
+/// <param name="source">Source stream (must support raw byte access).</param>
+/// <returns>Array of YAML documents.</returns>
+std::vector<Node> Binary_Parser::parse(ISource &source) {
+  std::vector<Node> yNodeTree;
+  while (source.more()) {
+    const std::string_view bytes{source.remaining()};
+    if (bytes.empty()) {
+      YAML_THROW(Error, "Binary snapshot source must support raw byte access.");
+    }
+    const auto header = binary_format::loadHeader(bytes);
+    Node yNode = decodeFrame(bytes.substr(0, header.frameSize));
+    if (!isA<Document>(yNode)) {
+      Node document = Node::make<Document>();
+      NRef<Document>(document).add(std::move(yNode));
+      yNode = std::move(document);
+    }
+    yNodeTree.push_back(std::move(yNode));
+    source.skip(header.frameSize);
+  }
+  return yNodeTree;
+}
+/// <summary>
+/// Decode a single in-memory snapshot frame.
+/// </summary>
+/// <param name="frame">Frame bytes (header first).</param>
+/// <returns>Root Node of the frame.</returns>
+Node Binary_Parser::decodeFrame(const std::string_view frame) {
+  const auto header = binary_format::loadHeader(frame);
+  const std::string_view body{frame.substr(0, header.frameSize)};
+  return decodeNode(body, header.rootOffset, 0, 0);
+}
+/// <summary>
+/// Decode the node record at offset (and recursively its children).
+/// </summary>
+/// <param name="frame">Frame bytes.</param>
+/// <param name="offset">Offset of node record.</param>
+/// <param name="parent">Offset of parent record (children always follow it).</param>
+/// <param name="depth">Current nesting depth.</param>
+/// <returns>Decoded Node.</returns>
+Node Binary_Parser::decodeNode(const std::string_view frame,
+                               const uint32_t offset, const uint32_t parent,
+                               const unsigned long depth) {
+  using binary_format::Type;
+  if (offset <= parent || depth > binary_format::kMaxNestingDepth) {
+    YAML_THROW(YAML_Lib::Error, "Binary snapshot contains an invalid node offset.");
+  }
+  const auto record = binary_format::load<binary_format::NodeRecord>(frame, offset);
+  Node yNode;
+  switch (record.type) {
+  case Type::hole:
+    yNode = Node::make<Hole>();
+    break;
+  case Type::null:
+    yNode = Node::make<Null>();
+    break;
+  case Type::boolean:
+    if (record.detail >= std::size(Boolean::kForms)) {
+      YAML_THROW(YAML_Lib::Error, "Binary snapshot contains an invalid boolean.");
+    }
+    yNode = Node::make<Boolean>(record.first != 0,
+                                Boolean::kForms[record.detail]);
+    break;
+  case Type::number:
+    yNode = decodeNumber(frame, record);
+    break;
+  case Type::string:
+    yNode = Node::make<String>(binary_format::loadString(frame, record.first),
+                               static_cast<char>(record.detail));
+    break;
+  case Type::timestamp:
+    yNode = Node::make<Timestamp>(binary_format::loadString(frame, record.first));
+    break;
+  case Type::comment:
+    yNode = Node::make<Comment>(binary_format::loadString(frame, record.first));
+    break;
+  case Type::array:
+    yNode = decodeSequence<Array>(frame, record, offset, depth);
+    break;
+  case Type::document:
+    yNode = decodeSequence<Document>(frame, record, offset, depth);
+    break;
+  case Type::dictionary:
+    yNode = decodeDictionary(frame, record, offset, depth);
+    break;
+  default:
+    YAML_THROW(YAML_Lib::Error, "Binary snapshot contains an unknown node type.");
+  }
+  if (record.tag != 0) {
+    yNode.setTag(binary_format::loadString(frame, record.tag));
+  }
+  return yNode;
+}
+/// <summary>
+/// Decode a number record restoring its original numeric type.
+/// </summary>
+/// <param name="frame">Frame bytes.</param>
+/// <param name="record">Number node record.</param>
+/// <returns>Number Node.</returns>
+Node Binary_Parser::decodeNumber(const std::string_view frame,
+                                 const binary_format::NodeRecord &record) {
+  using binary_format::NumberKind;
+  switch (static_cast<NumberKind>(record.detail)) {
+  case NumberKind::intValue:
+    return Node::make<Number>(
+        static_cast<int>(binary_format::load<int64_t>(frame, record.first)));
+  case NumberKind::longValue:
+    return Node::make<Number>(
+        static_cast<long>(binary_format::load<int64_t>(frame, record.first)));
+  case NumberKind::longLongValue:
+    return Node::make<Number>(static_cast<long long>(
+        binary_format::load<int64_t>(frame, record.first)));
+  case NumberKind::floatValue:
+    return Node::make<Number>(
+        static_cast<float>(binary_format::load<double>(frame, record.first)));
+  case NumberKind::doubleValue:
+    return Node::make<Number>(binary_format::load<double>(frame, record.first));
+  case NumberKind::longDoubleValue:
+    return Node::make<Number>(
+        binary_format::load<long double>(frame, record.first));
+  default:
+    return Node::make<Number>();
+  }
+}
+/// <summary>
+/// Decode an Array/Document record from its child offset table.
+/// </summary>
+/// <param name="frame">Frame bytes.</param>
+/// <param name="record">Sequence node record.</param>
+/// <param name="offset">Offset of the sequence record.</param>
+/// <param name="depth">Current nesting depth.</param>
+/// <returns>Array or Document Node.</returns>
+template <typename T>
+Node Binary_Parser::decodeSequence(const std::string_view frame,
+                                   const binary_format::NodeRecord &record,
+                                   const uint32_t offset,
+                                   const unsigned long depth) {
+  binary_format::checkTable(frame, record.second, record.first,
+                            sizeof(uint32_t));
+  Node yNode = Node::make<T>();
+  auto &entries = NRef<T>(yNode).value();
+  entries.reserve(record.first);
+  for (uint32_t index = 0; index < record.first; ++index) {
+    const auto child = binary_format::load<uint32_t>(
+        frame, record.second + index * sizeof(uint32_t));
+    entries.emplace_back(decodeNode(frame, child, offset, depth + 1));
+  }
+  return yNode;
+}
+/// <summary>
+/// Decode a Dictionary record from its entry table (insertion order).
+/// </summary>
+/// <param name="frame">Frame bytes.</param>
+/// <param name="record">Dictionary node record.</param>
+/// <param name="offset">Offset of the dictionary record.</param>
+/// <param name="depth">Current nesting depth.</param>
+/// <returns>Dictionary Node.</returns>
+Node Binary_Parser::decodeDictionary(const std::string_view frame,
+                                     const binary_format::NodeRecord &record,
+                                     const uint32_t offset,
+                                     const unsigned long depth) {
+  binary_format::checkTable(frame, record.second, record.first,
+                            sizeof(binary_format::EntryRecord));
+  Node yNode = Node::make<Dictionary>();
+  auto &dictionary = NRef<Dictionary>(yNode);
+  dictionary.value().reserve(record.first);
+  for (uint32_t index = 0; index < record.first; ++index) {
+    const auto entry = binary_format::load<binary_format::EntryRecord>(
+        frame, record.second + index * sizeof(binary_format::EntryRecord));
+    dictionary.add(DictionaryEntry(binary_format::loadString(frame, entry.key),
+                                   decodeNode(frame, entry.node, offset, depth + 1),
+                                   static_cast<char>(entry.keyQuote)));
+  }
+  return yNode;
+}
+
+} // namespace YAML_Lib
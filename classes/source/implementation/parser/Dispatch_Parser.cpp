@@ -0,0 +1,123 @@
+//
+// Class: Dispatch_Parser
+//
+// Description: Route each payload to JSON_Parser or Default_Parser based on
+// its leading bytes, keeping per-route counters.
+//
+// Dependencies: C++20 - Language standard features used.
+//
+
+#include "YAML_Impl.hpp"
+#include "Dispatch_Parser.hpp"
+
+namespace YAML_Lib {
+
+/// <summary>
+/// Construct with the same options as the parsers routed to.
+/// </summary>
+/// <param name="options">Parser limits.</param>
+Dispatch_Parser::Dispatch_Parser(const Options &options)
+    : defaultParser(std::make_unique<Default_Translator>(), options),
+      jsonParser(options) {}
+/// <summary>
+/// Parse the source using the route chosen from its first bytes.
+/// </summary>
+/// <param name="source">Source stream.</param>
+/// <returns>Array of YAML documents.</returns>
+std::vector<Node> Dispatch_Parser::parse(ISource &source) {
+  Route route = detectRoute(source);
+#ifndef YAML_LIB_NO_EXCEPTIONS
+  if (route == Route::json) {
+    source.save();
+    try {
+      auto yNodeTree = jsonParser.parse(source);
+      if (yNodeTree.size() == 1) {
+        source.discardSave();
+        jsonCount++;
+        return yNodeTree;
+      }
+    } catch ([[maybe_unused]] const SyntaxError &e) {
+    } catch ([[maybe_unused]] const IParser::Error &e) {
+    }
+    source.restore();
+    jsonFallbackCount++;
+    route = Route::flow;
+  }
+#else
+  // A failed JSON attempt cannot be recovered from without exceptions.
+  if (route == Route::json) {
+    route = Route::flow;
+  }
+#endif
+  if (route == Route::flow) {
+    flowCount++;
+  } else {
+    blockCount++;
+  }
+  return defaultParser.parse(source);
+}
+/// <summary>
+/// Return a snapshot of the route counters.
+/// </summary>
+/// <returns>Route statistics.</returns>
+Dispatch_Parser::Statistics Dispatch_Parser::getStatistics() const {
+  return {jsonCount.load(), flowCount.load(), blockCount.load(),
+          jsonFallbackCount.load()};
+}
+/// <summary>
+/// Zero the route counters.
+/// </summary>
+void Dispatch_Parser::resetStatistics() {
+  jsonCount = 0;
+  flowCount = 0;
+  blockCount = 0;
+  jsonFallbackCount = 0;
+}
+/// <summary>
+/// Choose a route from the first kPrefixLength bytes of the source (the
+/// source position is left unchanged).
+/// </summary>
+/// <param name="source">Source stream.</param>
+/// <returns>Route to take.</returns>
+Dispatch_Parser::Route Dispatch_Parser::detectRoute(ISource &source) {
+  std::string buffered;
+  std::string_view prefix{source.remaining()};
+  if (prefix.empty()) {
+    source.save();
+    while (source.more() && buffered.size() < kPrefixLength) {
+      buffered += source.current();
+      source.next();
+    }
+    source.restore();
+    prefix = buffered;
+  }
+  prefix = prefix.substr(0, kPrefixLength);
+  if (prefix.starts_with("\xEF\xBB\xBF")) {
+    prefix.remove_prefix(3);
+  }
+  const auto nonBlank = [&prefix](const std::size_t from) {
+    const auto found = prefix.find_first_not_of(" \t\r\n", from);
+    return found == std::string_view::npos ? kNull : prefix[found];
+  };
+  const auto start = prefix.find_first_not_of(" \t\r\n");
+  if (start == std::string_view::npos) {
+    return Route::block;
+  }
+  const char following = nonBlank(start + 1);
+  if (prefix[start] == kLeftCurlyBrace) {
+    return following == kDoubleQuote || following == kRightCurlyBrace
+               ? Route::json
+               : Route::flow;
+  }
+  if (prefix[start] == kLeftSquareBracket) {
+    const bool jsonValue =
+        following == kDoubleQuote || following == kLeftCurlyBrace ||
+        following == kLeftSquareBracket || following == kRightSquareBracket ||
+        following == '-' || (following >= '0' && following <= '9') ||
+        following == 't' || following == 'f' || following == 'n';
+    return jsonValue ? Route::json : Route::flow;
+  }
+  return Route::block;
+}
+
+} // namespace YAML_Lib
@@ -0,0 +1,143 @@
+//
+// Class: Incremental_Parser
+//
+// Description: Push-style YAML parser; buffers fed chunks up to the next
+// document boundary and parses each completed document with Default_Parser.
+//
+// Dependencies: C++20 - Language standard features used.
+//
+
+#include "YAML_Impl.hpp"
+#include "Incremental_Parser.hpp"
+#include <exception>
+
+namespace YAML_Lib {
+
+/// <summary>
+/// Construct with a document sink and the options passed to Default_Parser.
+/// </summary>
+/// <param name="sink">Receives each completed document.</param>
+/// <param name="context">Opaque pointer passed to every sink call.</param>
+/// <param name="options">Parser limits.</param>
+Incremental_Parser::Incremental_Parser(const DocumentSink sink, void *context,
+                                       const Options &options)
+    : sink(sink), context(context),
+      parser(std::make_unique<Default_Translator>(), options) {
+  if (sink == nullptr) {
+    YAML_THROW(IParser::Error, "Incremental_Parser requires a document sink.");
+  }
+}
+/// <summary>
+/// Append a chunk and emit every document closed by its complete lines.
+/// A document that fails to parse does not stop the scan: the first error
+/// is rethrown once every complete line of the chunk has been classified.
+/// </summary>
+/// <param name="chunk">Next bytes of the stream.</param>
+void Incremental_Parser::feed(const std::span<const char> chunk) {
+  pending.append(chunk.data(), chunk.size());
+#ifndef YAML_LIB_NO_EXCEPTIONS
+  std::exception_ptr error;
+  const auto emitClosed = [this, &error](const std::size_t length) {
+    try {
+      emit(length);
+    } catch (...) {
+      if (!error) {
+        error = std::current_exception();
+      }
+    }
+  };
+#else
+  // Parse errors go to the panic handler; there is nothing to hold.
+  const auto emitClosed = [this](const std::size_t length) { emit(length); };
+#endif
+  for (std::size_t lineFeed = pending.find(kLineFeed, scanned);
+       lineFeed != std::string::npos;
+       lineFeed = pending.find(kLineFeed, scanned)) {
+    const std::size_t lineStart = scanned;
+    scanned = lineFeed + 1;
+    switch (classifyLine(
+        std::string_view(pending).substr(lineStart, lineFeed - lineStart))) {
+    case LineKind::startMarker:
+      // "---" closes the open document and starts the next one.
+      if (inDocument) {
+        emitClosed(lineStart);
+      }
+      inDocument = true;
+      break;
+    case LineKind::endMarker:
+      inDocument = false;
+      emitClosed(scanned);
+      break;
+    case LineKind::directive:
+      // Directives only precede a document; inside one leave it to the parser.
+      break;
+    case LineKind::content:
+      inDocument = true;
+      break;
+    case LineKind::blank:
+      break;
+    }
+  }
+#ifndef YAML_LIB_NO_EXCEPTIONS
+  if (error) {
+    std::rethrow_exception(error);
+  }
+#endif
+}
+/// <summary>
+/// Emit whatever remains buffered and get ready for a new stream.
+/// </summary>
+void Incremental_Parser::finish() {
+  emit(pending.size());
+  inDocument = false;
+  firstLine = 1;
+}
+/// <summary>
+/// Classify a complete line (without its line feed) for boundary detection.
+/// </summary>
+/// <param name="line">Line text.</param>
+/// <returns>Kind of line.</returns>
+Incremental_Parser::LineKind
+Incremental_Parser::classifyLine(const std::string_view line) {
+  const auto isMarker = [&line](const std::string_view marker) {
+    return line.starts_with(marker) &&
+           (line.size() == marker.size() || line[marker.size()] == kSpace ||
+            line[marker.size()] == '\t' ||
+            line[marker.size()] == kCarriageReturn);
+  };
+  if (isMarker(kStartDocument)) {
+    return LineKind::startMarker;
+  }
+  if (isMarker(kEndDocument)) {
+    return LineKind::endMarker;
+  }
+  if (line.starts_with('%')) {
+    return LineKind::directive;
+  }
+  const auto first = line.find_first_not_of(" \t\r");
+  if (first == std::string_view::npos || line[first] == '#') {
+    return LineKind::blank;
+  }
+  return LineKind::content;
+}
+/// <summary>
+/// Remove the first length buffered bytes, parse them and pass the resulting
+/// documents to the sink. The bytes are dropped even if parsing throws, so
+/// feeding can carry on with the next document.
+/// </summary>
+/// <param name="length">Number of buffered bytes to parse.</param>
+void Incremental_Parser::emit(const std::size_t length) {
+  std::string text{pending.substr(length)};
+  text.swap(pending);
+  text.resize(length);
+  scanned -= std::min(scanned, length);
+  const unsigned long line = firstLine;
+  firstLine += static_cast<unsigned long>(std::ranges::count(text, kLineFeed));
+  Segment source{text, line};
+  for (auto &document : parser.parse(source)) {
+    documents++;
+    sink(std::move(document), context);
+  }
+}
+
+} // namespace YAML_Lib
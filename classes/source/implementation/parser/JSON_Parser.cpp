@@ -0,0 +1,371 @@
+//
+// Class: JSON_Parser
+//
+// Description: Single pass JSON parser that builds the same Node tree as
+// Default_Parser does for JSON input.
+//
+// Dependencies: C++20 - Language standard features used.
+//
+
+#include "YAML_Impl.hpp"
+#include "JSON_Parser.hpp"
+
+namespace YAML_Lib {
+
+/// <summary>
+/// Work out the line and column of the cursor (for error reporting).
+/// </summary>
+/// <returns>Line/column pair (both starting at 1).</returns>
+std::pair<unsigned long, unsigned long> JSON_Parser::Cursor::getPosition() const {
+  unsigned long lineNo = 1;
+  unsigned long column = 1;
+  for (std::size_t index = 0; index < offset_ && index < text_.size(); ++index) {
+    if (text_[index] == kLineFeed) {
+      lineNo++;
+      column = 1;
+    } else {
+      column++;
+    }
+  }
+  return {lineNo, column};
+}
+/// <summary>
+/// Parse every top-level JSON value on the source stream into a document.
+/// </summary>
+/// <param name="source">Source stream.</param>
+/// <returns>Array of YAML documents.</returns>
+std::vector<Node> JSON_Parser::parse(ISource &source) {
+  std::string buffered;
+  std::string_view text{source.remaining()};
+  const bool inPlace = !text.empty();
+  if (!inPlace) {
+    while (source.more()) {
+      buffered += source.current();
+      source.next();
+    }
+    text = buffered;
+  }
+  Cursor cursor{text};
+  if (text.starts_with("\xEF\xBB\xBF")) {
+    cursor.next();
+    cursor.next();
+    cursor.next();
+  }
+  std::vector<Node> yNodeTree;
+  for (skipWhiteSpace(cursor); cursor.more(); skipWhiteSpace(cursor)) {
+    if (maxDocuments != 0 && yNodeTree.size() + 1 > maxDocuments) {
+      YAML_THROW_POS(cursor, "YAML document count exceeds configured limit.");
+    }
+    Node document = Node::make<Document>();
+    NRef<Document>(document).add(parseValue(cursor, 1));
+    yNodeTree.push_back(std::move(document));
+  }
+  if (inPlace) {
+    source.skip(text.size());
+  }
+  return yNodeTree;
+}
+/// <summary>
+/// Parse any JSON value at the cursor.
+/// </summary>
+/// <param name="cursor">JSON text cursor.</param>
+/// <param name="depth">Current nesting depth.</param>
+/// <returns>Value Node.</returns>
+Node JSON_Parser::parseValue(Cursor &cursor, const unsigned long depth) {
+  switch (cursor.current()) {
+  case kLeftCurlyBrace:
+    return parseObject(cursor, depth);
+  case kLeftSquareBracket:
+    return parseArray(cursor, depth);
+  case kDoubleQuote:
+    return Node::make<String>(parseString(cursor), kDoubleQuote);
+  case '-':
+  case '0': case '1': case '2': case '3': case '4':
+  case '5': case '6': case '7': case '8': case '9':
+    return parseNumber(cursor);
+  default:
+    return parseLiteral(cursor);
+  }
+}
+/// <summary>
+/// Parse a JSON object into a Dictionary (duplicate keys are an error, as
+/// they are for Default_Parser).
+/// </summary>
+/// <param name="cursor">JSON text cursor.</param>
+/// <param name="depth">Current nesting depth.</param>
+/// <returns>Dictionary Node.</returns>
+Node JSON_Parser::parseObject(Cursor &cursor, const unsigned long depth) {
+  checkDepth(depth);
+  Node yNode = Node::make<Dictionary>();
+  auto &dictionary = NRef<Dictionary>(yNode);
+  cursor.next();
+  skipWhiteSpace(cursor);
+  if (cursor.current() == kRightCurlyBrace) {
+    cursor.next();
+    return yNode;
+  }
+  while (true) {
+    if (cursor.current() != kDoubleQuote) {
+      YAML_THROW_POS(cursor, "Expected a string key in JSON object.");
+    }
+    std::string key{parseString(cursor)};
+    if (dictionary.contains(key)) {
+      YAML_THROW_POS(cursor, "Dictionary already contains key '" + key + "'.");
+    }
+    skipWhiteSpace(cursor);
+    if (cursor.current() != kColon) {
+      YAML_THROW_POS(cursor, "Expected ':' after key in JSON object.");
+    }
+    cursor.next();
+    skipWhiteSpace(cursor);
+    dictionary.add(DictionaryEntry(key, parseValue(cursor, depth + 1),
+                                   kDoubleQuote));
+    skipWhiteSpace(cursor);
+    if (cursor.current() == kComma) {
+      cursor.next();
+      skipWhiteSpace(cursor);
+    } else if (cursor.current() == kRightCurlyBrace) {
+      cursor.next();
+      return yNode;
+    } else {
+      YAML_THROW_POS(cursor, "Expected ',' or '}' in JSON object.");
+    }
+  }
+}
+/// <summary>
+/// Parse a JSON array into an Array.
+/// </summary>
+/// <param name="cursor">JSON text cursor.</param>
+/// <param name="depth">Current nesting depth.</param>
+/// <returns>Array Node.</returns>
+Node JSON_Parser::parseArray(Cursor &cursor, const unsigned long depth) {
+  checkDepth(depth);
+  Node yNode = Node::make<Array>();
+  auto &array = NRef<Array>(yNode);
+  cursor.next();
+  skipWhiteSpace(cursor);
+  if (cursor.current() == kRightSquareBracket) {
+    cursor.next();
+    return yNode;
+  }
+  while (true) {
+    array.add(parseValue(cursor, depth + 1));
+    skipWhiteSpace(cursor);
+    if (cursor.current() == kComma) {
+      cursor.next();
+      skipWhiteSpace(cursor);
+    } else if (cursor.current() == kRightSquareBracket) {
+      cursor.next();
+      return yNode;
+    } else {
+      YAML_THROW_POS(cursor, "Expected ',' or ']' in JSON array.");
+    }
+  }
+}
+/// <summary>
+/// Parse a JSON string (cursor on the opening quote) decoding any escapes.
+/// Runs without escapes are copied in one step.
+/// </summary>
+/// <param name="cursor">JSON text cursor.</param>
+/// <returns>Decoded UTF-8 string.</returns>
+std::string JSON_Parser::parseString(Cursor &cursor) {
+  cursor.next();
+  std::string string;
+  std::size_t start = cursor.offset();
+  while (true) {
+    if (!cursor.more()) {
+      YAML_THROW_POS(cursor, "Unterminated JSON string.");
+    }
+    const auto ch = static_cast<unsigned char>(cursor.current());
+    if (ch == kDoubleQuote) {
+      string += cursor.from(start);
+      cursor.next();
+      return string;
+    }
+    if (ch < 0x20) {
+      YAML_THROW_POS(cursor, "Control character in JSON string.");
+    }
+    if (ch != '\\') {
+      cursor.next();
+      continue;
+    }
+    string += cursor.from(start);
+    cursor.next();
+    switch (cursor.current()) {
+    case '"': string += '"'; break;
+    case '\\': string += '\\'; break;
+    case '/': string += '/'; break;
+    case 'b': string += '\b'; break;
+    case 'f': string += '\f'; break;
+    case 'n': string += '\n'; break;
+    case 'r': string += '\r'; break;
+    case 't': string += '\t'; break;
+    case 'u': {
+      uint32_t codePoint = parseHexQuad(cursor);
+      if (codePoint >= kHighSurrogatesBegin && codePoint <= kHighSurrogatesEnd) {
+        cursor.next();
+        if (cursor.current() != '\\') {
+          YAML_THROW_POS(cursor, "Unpaired surrogate in JSON string.");
+        }
+        cursor.next();
+        if (cursor.current() != 'u') {
+          YAML_THROW_POS(cursor, "Unpaired surrogate in JSON string.");
+        }
+        const uint32_t low = parseHexQuad(cursor);
+        if (low < kLowSurrogatesBegin || low > kLowSurrogatesEnd) {
+          YAML_THROW_POS(cursor, "Unpaired surrogate in JSON string.");
+        }
+        codePoint = 0x10000 + ((codePoint - kHighSurrogatesBegin) << 10) +
+                    (low - kLowSurrogatesBegin);
+      } else if (codePoint >= kLowSurrogatesBegin &&
+                 codePoint <= kLowSurrogatesEnd) {
+        YAML_THROW_POS(cursor, "Unpaired surrogate in JSON string.");
+      }
+      appendUtf8(string, codePoint);
+      break;
+    }
+    default:
+      YAML_THROW_POS(cursor, "Invalid escape sequence in JSON string.");
+    }
+    cursor.next();
+    start = cursor.offset();
+  }
+}
+/// <summary>
+/// Read the four hex digits of a \u escape (cursor on the 'u'); the cursor
+/// is left on the last digit.
+/// </summary>
+/// <param name="cursor">JSON text cursor.</param>
+/// <returns>UTF-16 code unit.</returns>
+uint32_t JSON_Parser::parseHexQuad(Cursor &cursor) {
+  uint32_t value = 0;
+  for (int digit = 0; digit < 4; ++digit) {
+    cursor.next();
+    const char ch = cursor.current();
+    value <<= 4;
+    if (ch >= '0' && ch <= '9') {
+      value |= static_cast<uint32_t>(ch - '0');
+    } else if (ch >= 'a' && ch <= 'f') {
+      value |= static_cast<uint32_t>(ch - 'a' + 10);
+    } else if (ch >= 'A' && ch <= 'F') {
+      value |= static_cast<uint32_t>(ch - 'A' + 10);
+    } else {
+      YAML_THROW_POS(cursor, "Invalid \\u escape in JSON string.");
+    }
+  }
+  return value;
+}
+/// <summary>
+/// Parse a JSON number. Short integers are converted directly; anything else
+/// goes through Number's string conversion so the chosen type matches
+/// Default_Parser.
+/// </summary>
+/// <param name="cursor">JSON text cursor.</param>
+/// <returns>Number Node.</returns>
+Node JSON_Parser::parseNumber(Cursor &cursor) {
+  const auto isDigit = [&cursor] {
+    return cursor.current() >= '0' && cursor.current() <= '9';
+  };
+  const std::size_t start = cursor.offset();
+  const bool negative = cursor.current() == '-';
+  if (negative) {
+    cursor.next();
+  }
+  if (cursor.current() == '0') {
+    cursor.next();
+  } else if (isDigit()) {
+    while (isDigit()) {
+      cursor.next();
+    }
+  } else {
+    YAML_THROW_POS(cursor, "Invalid JSON number.");
+  }
+  bool integer = true;
+  if (cursor.current() == '.') {
+    integer = false;
+    cursor.next();
+    if (!isDigit()) {
+      YAML_THROW_POS(cursor, "Invalid JSON number.");
+    }
+    while (isDigit()) {
+      cursor.next();
+    }
+  }
+  if (cursor.current() == 'e' || cursor.current() == 'E') {
+    integer = false;
+    cursor.next();
+    if (cursor.current() == '+' || cursor.current() == '-') {
+      cursor.next();
+    }
+    if (!isDigit()) {
+      YAML_THROW_POS(cursor, "Invalid JSON number.");
+    }
+    while (isDigit()) {
+      cursor.next();
+    }
+  }
+  const std::string_view number{cursor.from(start)};
+  if (integer && number.size() - (negative ? 1 : 0) <= 9) {
+    int value = 0;
+    for (const char ch : number.substr(negative ? 1 : 0)) {
+      value = value * 10 + (ch - '0');
+    }
+    return Node::make<Number>(negative ? -value : value);
+  }
+  // Out of range for every Number type: Default_Parser keeps it as a string.
+  if (Number value{std::string(number)};
+      value.is<int>() || value.is<long>() || value.is<long long>() ||
+      value.is<float>() || value.is<double>() || value.is<long double>()) {
+    return Node::make<Number>(value);
+  }
+  return Node::make<String>(number, kNull);
+}
+/// <summary>
+/// Parse one of the literals true, false or null.
+/// </summary>
+/// <param name="cursor">JSON text cursor.</param>
+/// <returns>Boolean or Null Node.</returns>
+Node JSON_Parser::parseLiteral(Cursor &cursor) {
+  // Literals start with distinct characters so a mismatch can only occur
+  // before the cursor moves (or is a syntax error anyway).
+  const auto literal = [&cursor](const std::string_view word) {
+    for (const char ch : word) {
+      if (cursor.current() != ch) {
+        return false;
+      }
+      cursor.next();
+    }
+    return true;
+  };
+  if (literal("true")) {
+    return Node::make<Boolean>(true, "true");
+  }
+  if (literal("false")) {
+    return Node::make<Boolean>(false, "false");
+  }
+  if (literal("null")) {
+    return Node::make<Null>();
+  }
+  YAML_THROW_POS(cursor, "Invalid JSON value.");
+}
+/// <summary>
+/// Skip JSON insignificant white space (space, tab, line feed, return).
+/// </summary>
+/// <param name="cursor">JSON text cursor.</param>
+void JSON_Parser::skipWhiteSpace(Cursor &cursor) {
+  while (cursor.current() == kSpace || cursor.current() == '\t' ||
+         cursor.current() == kLineFeed || cursor.current() == kCarriageReturn) {
+    cursor.next();
+  }
+}
+/// <summary>
+/// Enforce the configured maximum nesting depth.
+/// </summary>
+/// <param name="depth">Depth of the collection being opened.</param>
+void JSON_Parser::checkDepth(const unsigned long depth) const {
+  if (maxParseDepth != 0 && depth > maxParseDepth) {
+    YAML_THROW(Error, "YAML parse nesting depth limit exceeded.");
+  }
+}
+
+} // namespace YAML_Lib
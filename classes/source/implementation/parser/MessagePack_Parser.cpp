@@ -0,0 +1,378 @@
+//
+// Class: MessagePack_Parser
+//
+// Description: Decode MessagePack into a Node tree.
+//
+// Dependencies: C++20 - Language standard features used.
+//
+
+#include "YAML_Impl.hpp"
+#include "MessagePack_Parser.hpp"
+
+namespace YAML_Lib {
+
+/// <summary>
+/// Format seconds/nanoseconds since the Unix epoch as an RFC 3339 UTC
+/// timestamp (fraction only when non-zero, trailing zeros removed).
+/// </summary>
+/// <param name="seconds">Seconds since the epoch.</param>
+/// <param name="nanoseconds">Nanoseconds (< 1e9).</param>
+/// <returns>Timestamp text.</returns>
+static std::string formatTimestamp(const int64_t seconds,
+                                   const uint32_t nanoseconds) {
+  // Civil date from days (proleptic Gregorian calendar).
+  const int64_t days = (seconds >= 0 ? seconds : seconds - 86399) / 86400;
+  const int64_t secondOfDay = seconds - days * 86400;
+  const int64_t shifted = days + 719468;
+  const int64_t era = (shifted >= 0 ? shifted : shifted - 146096) / 146097;
+  const int64_t dayOfEra = shifted - era * 146097;
+  const int64_t yearOfEra =
+      (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+  const int64_t dayOfYear =
+      dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+  const int64_t monthIndex = (5 * dayOfYear + 2) / 153;
+  const int64_t day = dayOfYear - (153 * monthIndex + 2) / 5 + 1;
+  const int64_t month = monthIndex < 10 ? monthIndex + 3 : monthIndex - 9;
+  const int64_t year = yearOfEra + era * 400 + (month <= 2 ? 1 : 0);
+  const auto append = [](std::string &text, const int64_t value,
+                          const std::size_t width) {
+    const std::string digits{std::to_string(value)};
+    if (digits.size() < width) {
+      text.append(width - digits.size(), '0');
+    }
+    text += digits;
+  };
+  std::string timestamp;
+  append(timestamp, year, 4);
+  timestamp += '-';
+  append(timestamp, month, 2);
+  timestamp += '-';
+  append(timestamp, day, 2);
+  timestamp += 'T';
+  append(timestamp, secondOfDay / 3600, 2);
+  timestamp += ':';
+  append(timestamp, secondOfDay / 60 % 60, 2);
+  timestamp += ':';
+  append(timestamp, secondOfDay % 60, 2);
+  if (nanoseconds != 0) {
+    std::string fraction;
+    append(fraction, nanoseconds, 9);
+    while (fraction.back() == '0') {
+      fraction.pop_back();
+    }
+    timestamp += '.' + fraction;
+  }
+  return timestamp + "Z";
+}
+/// <summary>
+/// Read a width byte big-endian unsigned integer.
+/// </summary>
+/// <param name="width">Number of bytes (1, 2, 4 or 8).</param>
+/// <returns>Value read.</returns>
+uint64_t MessagePack_Parser::Reader::readBigEndian(const unsigned width) {
+  uint64_t value = 0;
+  for (const char byte : readBytes(width)) {
+    value = value << 8 | static_cast<unsigned char>(byte);
+  }
+  return value;
+}
+/// <summary>
+/// Return a view of the next length bytes and move past them.
+/// </summary>
+/// <param name="length">Number of bytes.</param>
+/// <returns>View of the bytes read.</returns>
+std::string_view MessagePack_Parser::Reader::readBytes(const uint64_t length) {
+  if (length > available()) {
+    YAML_THROW(Error, "MessagePack data is truncated.");
+  }
+  const auto bytes = bytes_.substr(offset_, static_cast<std::size_t>(length));
+  offset_ += static_cast<std::size_t>(length);
+  return bytes;
+}
+/// <summary>
+/// Decode every top-level MessagePack object on the source into a document.
+/// </summary>
+/// <param name="source">Source stream (must support raw byte access).</param>
+/// <returns>Array of YAML documents.</returns>
+std::vector<Node> MessagePack_Parser::parse(ISource &source) {
+  std::vector<Node> yNodeTree;
+  if (!source.more()) {
+    return yNodeTree;
+  }
+  const std::string_view bytes{source.remaining()};
+  if (bytes.empty()) {
+    YAML_THROW(Error, "MessagePack source must support raw byte access.");
+  }
+  Reader reader{bytes};
+  while (reader.more()) {
+    if (maxDocuments != 0 && yNodeTree.size() + 1 > maxDocuments) {
+      YAML_THROW(Error, "YAML document count exceeds configured limit.");
+    }
+    Node document = Node::make<Document>();
+    NRef<Document>(document).add(decodeNode(reader, 1));
+    yNodeTree.push_back(std::move(document));
+  }
+  source.skip(reader.offset());
+  return yNodeTree;
+}
+/// <summary>
+/// Decode the next MessagePack object.
+/// </summary>
+/// <param name="reader">Byte reader.</param>
+/// <param name="depth">Current nesting depth.</param>
+/// <returns>Decoded Node.</returns>
+Node MessagePack_Parser::decodeNode(Reader &reader, const unsigned long depth) {
+  const auto type = static_cast<uint8_t>(reader.readBigEndian(1));
+  if (type <= 0x7f) {
+    return makeInteger(type);
+  }
+  if (type >= 0xe0) {
+    return makeInteger(static_cast<int8_t>(type));
+  }
+  if ((type & 0xf0) == 0x80) {
+    return decodeMap(reader, type & 0x0f, depth);
+  }
+  if ((type & 0xf0) == 0x90) {
+    return decodeArray(reader, type & 0x0f, depth);
+  }
+  if ((type & 0xe0) == 0xa0) {
+    return Node::make<String>(reader.readBytes(type & 0x1f), kDoubleQuote);
+  }
+  switch (type) {
+  case 0xc0:
+    return Node::make<Null>();
+  case 0xc2:
+    return Node::make<Boolean>(false, "false");
+  case 0xc3:
+    return Node::make<Boolean>(true, "true");
+  case 0xc4:
+  case 0xc5:
+  case 0xc6:
+    return makeBinary(reader.readBytes(
+        reader.readBigEndian(1U << (type - 0xc4))));
+  case 0xc7:
+  case 0xc8:
+  case 0xc9:
+    return decodeExtension(reader, reader.readBigEndian(1U << (type - 0xc7)));
+  case 0xca:
+    return Node::make<Number>(
+        std::bit_cast<float>(static_cast<uint32_t>(reader.readBigEndian(4))));
+  case 0xcb:
+    return Node::make<Number>(std::bit_cast<double>(reader.readBigEndian(8)));
+  case 0xcc:
+  case 0xcd:
+  case 0xce:
+  case 0xcf:
+    return makeUnsigned(reader.readBigEndian(1U << (type - 0xcc)));
+  case 0xd0:
+    return makeInteger(static_cast<int8_t>(reader.readBigEndian(1)));
+  case 0xd1:
+    return makeInteger(static_cast<int16_t>(reader.readBigEndian(2)));
+  case 0xd2:
+    return makeInteger(static_cast<int32_t>(reader.readBigEndian(4)));
+  case 0xd3:
+    return makeInteger(static_cast<int64_t>(reader.readBigEndian(8)));
+  case 0xd4:
+  case 0xd5:
+  case 0xd6:
+  case 0xd7:
+  case 0xd8:
+    return decodeExtension(reader, 1U << (type - 0xd4));
+  case 0xd9:
+  case 0xda:
+  case 0xdb:
+    return Node::make<String>(
+        reader.readBytes(reader.readBigEndian(1U << (type - 0xd9))),
+        kDoubleQuote);
+  case 0xdc:
+  case 0xdd:
+    return decodeArray(reader, reader.readBigEndian(type == 0xdc ? 2 : 4),
+                       depth);
+  case 0xde:
+  case 0xdf:
+    return decodeMap(reader, reader.readBigEndian(type == 0xde ? 2 : 4), depth);
+  default:
+    YAML_THROW(Error, "MessagePack data contains an invalid type byte.");
+  }
+}
+/// <summary>
+/// Decode count array elements.
+/// </summary>
+/// <param name="reader">Byte reader.</param>
+/// <param name="count">Number of elements.</param>
+/// <param name="depth">Current nesting depth.</param>
+/// <returns>Array Node.</returns>
+Node MessagePack_Parser::decodeArray(Reader &reader, const uint64_t count,
+                                     const unsigned long depth) {
+  if (maxParseDepth != 0 && depth > maxParseDepth) {
+    YAML_THROW(Error, "YAML parse nesting depth limit exceeded.");
+  }
+  Node yNode = Node::make<Array>();
+  auto &entries = NRef<Array>(yNode).value();
+  entries.reserve(checkedCount(reader, count));
+  for (uint64_t index = 0; index < count; ++index) {
+    entries.emplace_back(decodeNode(reader, depth + 1));
+  }
+  return yNode;
+}
+/// <summary>
+/// Decode count map entries (duplicate keys are an error, as they are for
+/// Default_Parser).
+/// </summary>
+/// <param name="reader">Byte reader.</param>
+/// <param name="count">Number of key/value pairs.</param>
+/// <param name="depth">Current nesting depth.</param>
+/// <returns>Dictionary Node.</returns>
+Node MessagePack_Parser::decodeMap(Reader &reader, const uint64_t count,
+                                   const unsigned long depth) {
+  if (maxParseDepth != 0 && depth > maxParseDepth) {
+    YAML_THROW(Error, "YAML parse nesting depth limit exceeded.");
+  }
+  Node yNode = Node::make<Dictionary>();
+  auto &dictionary = NRef<Dictionary>(yNode);
+  dictionary.value().reserve(checkedCount(reader, count * 2) / 2);
+  for (uint64_t index = 0; index < count; ++index) {
+    std::string key{decodeKey(reader)};
+    if (dictionary.contains(key)) {
+      YAML_THROW(Error, "Dictionary already contains key '" + key + "'.");
+    }
+    dictionary.add(
+        DictionaryEntry(key, decodeNode(reader, depth + 1), kDoubleQuote));
+  }
+  return yNode;
+}
+/// <summary>
+/// Decode an extension object; only the timestamp extension (type -1) is
+/// supported.
+/// </summary>
+/// <param name="reader">Byte reader.</param>
+/// <param name="length">Length of the extension data.</param>
+/// <returns>Timestamp Node.</returns>
+Node MessagePack_Parser::decodeExtension(Reader &reader, const uint64_t length) {
+  const auto type = static_cast<int8_t>(reader.readBigEndian(1));
+  if (type != -1) {
+    YAML_THROW(Error, "MessagePack extension type is not supported.");
+  }
+  int64_t seconds{};
+  uint32_t nanoseconds{};
+  if (length == 4) {
+    seconds = static_cast<int64_t>(reader.readBigEndian(4));
+  } else if (length == 8) {
+    const uint64_t packed = reader.readBigEndian(8);
+    nanoseconds = static_cast<uint32_t>(packed >> 34);
+    seconds = static_cast<int64_t>(packed & 0x3ffffffffULL);
+  } else if (length == 12) {
+    nanoseconds = static_cast<uint32_t>(reader.readBigEndian(4));
+    seconds = static_cast<int64_t>(reader.readBigEndian(8));
+  } else {
+    YAML_THROW(Error, "MessagePack timestamp has an invalid length.");
+  }
+  if (nanoseconds > 999999999) {
+    YAML_THROW(Error, "MessagePack timestamp has an invalid length.");
+  }
+  return Node::make<Timestamp>(formatTimestamp(seconds, nanoseconds));
+}
+/// <summary>
+/// Make a Number holding a signed integer in the smallest type that fits
+/// (int, then long, then long long; as Number's string conversion).
+/// </summary>
+/// <param name="value">Integer value.</param>
+/// <returns>Number Node.</returns>
+Node MessagePack_Parser::makeInteger(const int64_t value) {
+  if (value >= std::numeric_limits<int>::min() &&
+      value <= std::numeric_limits<int>::max()) {
+    return Node::make<Number>(static_cast<int>(value));
+  }
+  if (value >= std::numeric_limits<long>::min() &&
+      value <= std::numeric_limits<long>::max()) {
+    return Node::make<Number>(static_cast<long>(value));
+  }
+  return Node::make<Number>(static_cast<long long>(value));
+}
+/// <summary>
+/// Make a Number holding an unsigned integer; values beyond long long are
+/// converted exactly as their decimal text would be.
+/// </summary>
+/// <param name="value">Integer value.</param>
+/// <returns>Number Node.</returns>
+Node MessagePack_Parser::makeUnsigned(const uint64_t value) {
+  if (value <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+    return makeInteger(static_cast<int64_t>(value));
+  }
+  return Node::make<Number>(Number{std::to_string(value)});
+}
+/// <summary>
+/// Make a !!binary String holding the base64 encoding of bytes.
+/// </summary>
+/// <param name="bytes">Binary data.</param>
+/// <returns>Tagged String Node.</returns>
+Node MessagePack_Parser::makeBinary(const std::string_view bytes) {
+  static constexpr char kBase64[] =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::string encoded;
+  encoded.reserve((bytes.size() + 2) / 3 * 4);
+  for (std::size_t index = 0; index < bytes.size(); index += 3) {
+    uint32_t group = static_cast<unsigned char>(bytes[index]) << 16;
+    if (index + 1 < bytes.size()) {
+      group |= static_cast<unsigned char>(bytes[index + 1]) << 8;
+    }
+    if (index + 2 < bytes.size()) {
+      group |= static_cast<unsigned char>(bytes[index + 2]);
+    }
+    encoded += kBase64[group >> 18 & 0x3f];
+    encoded += kBase64[group >> 12 & 0x3f];
+    encoded += index + 1 < bytes.size() ? kBase64[group >> 6 & 0x3f] : '=';
+    encoded += index + 2 < bytes.size() ? kBase64[group & 0x3f] : '=';
+  }
+  Node yNode = Node::make<String>(encoded, kNull);
+  yNode.setTag("tag:yaml.org,2002:binary");
+  return yNode;
+}
+/// <summary>
+/// Decode a map key; strings are used as is and integers as their decimal
+/// text.
+/// </summary>
+/// <param name="reader">Byte reader.</param>
+/// <returns>Key string.</returns>
+std::string MessagePack_Parser::decodeKey(Reader &reader) {
+  const auto type = static_cast<uint8_t>(reader.readBigEndian(1));
+  if ((type & 0xe0) == 0xa0) {
+    return std::string(reader.readBytes(type & 0x1f));
+  }
+  if (type >= 0xd9 && type <= 0xdb) {
+    return std::string(
+        reader.readBytes(reader.readBigEndian(1U << (type - 0xd9))));
+  }
+  if (type <= 0x7f) {
+    return std::to_string(type);
+  }
+  if (type >= 0xe0) {
+    return std::to_string(static_cast<int8_t>(type));
+  }
+  if (type >= 0xcc && type <= 0xcf) {
+    return std::to_string(reader.readBigEndian(1U << (type - 0xcc)));
+  }
+  if (type >= 0xd0 && type <= 0xd3) {
+    const unsigned width = 1U << (type - 0xd0);
+    const uint64_t raw = reader.readBigEndian(width);
+    const unsigned shift = 64 - 8 * width;
+    return std::to_string(static_cast<int64_t>(raw << shift) >> shift);
+  }
+  YAML_THROW(Error, "MessagePack map key must be a string or integer.");
+}
+/// <summary>
+/// Reject element counts that cannot fit in the remaining data (each
+/// element takes at least one byte) before reserving space for them.
+/// </summary>
+/// <param name="reader">Byte reader.</param>
+/// <param name="count">Declared number of elements.</param>
+/// <returns>count.</returns>
+uint64_t MessagePack_Parser::checkedCount(const Reader &reader,
+                                          const uint64_t count) {
+  if (count > reader.available()) {
+    YAML_THROW(Error, "MessagePack data is truncated.");
+  }
+  return count;
+}
+
+} // namespace YAML_Lib
@@ -0,0 +1,76 @@
+//
+// Class: DocumentReader
+//
+// Description: Document-at-a-time reader over a multi-document YAML source.
+//
+// Dependencies: C++20 - Language standard features used.
+//
+
+#include "YAML_Impl.hpp"
+#include "YAML_Document_Reader.hpp"
+
+namespace YAML_Lib {
+
+/// <summary>
+/// Release the current document and read on until the next one is parsed.
+/// </summary>
+/// <returns>True if a document is available, false at end of stream.</returns>
+bool DocumentReader::next() {
+  current = Node();
+  while (documents.empty() && !finished) {
+    readBlock();
+  }
+  if (documents.empty()) {
+    return false;
+  }
+  current = std::move(documents.front());
+  documents.pop_front();
+  count++;
+  return true;
+}
+/// <summary>
+/// Get the root node of the current document.
+/// </summary>
+/// <returns>Document root Node.</returns>
+Node &DocumentReader::document() {
+  if (current.isEmpty()) {
+    YAML_THROW(IParser::Error, "Document does not exist.");
+  }
+  return current[0];
+}
+/// <summary>
+/// Incremental_Parser sink: queue a completed document.
+/// </summary>
+/// <param name="document">Completed Document node.</param>
+/// <param name="context">Owning DocumentReader.</param>
+void DocumentReader::queueDocument(Node &&document, void *context) {
+  static_cast<DocumentReader *>(context)->documents.push_back(
+      std::move(document));
+}
+/// <summary>
+/// Feed the next block of the source to the incremental parser (finishing
+/// it at end of source), with the caller's memory resource as tree resource.
+/// The block is consumed before it is fed, so a parse error is not fed again
+/// by the next call.
+/// </summary>
+void DocumentReader::readBlock() {
+  TreeResourceScope scope{memoryResource};
+  if (!source.more()) {
+    finished = true;
+    parser.finish();
+    return;
+  }
+  if (const auto bytes = source.remaining(); !bytes.empty()) {
+    const auto length = std::min(bytes.size(), kReadBlockSize);
+    source.skip(length);
+    parser.feed(bytes.substr(0, length));
+    return;
+  }
+  block.clear();
+  while (source.more() && block.size() < kReadBlockSize) {
+    block += source.append();
+  }
+  parser.feed(block);
+}
+
+} // namespace YAML_Lib
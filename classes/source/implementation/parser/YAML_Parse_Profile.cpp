@@ -0,0 +1,90 @@
+//
+// Class: ParseProfile
+//
+// Description: Default_Parser instrumentation counters and their report
+// (text table or JSON). Only built with YAML_LIB_PROFILE=ON.
+//
+// Dependencies: C++20 - Language standard features used.
+//
+
+#include <iomanip>
+
+#include "YAML_Impl.hpp"
+
+#ifdef YAML_LIB_PROFILE
+
+namespace YAML_Lib {
+
+/// <summary>
+/// Zero every counter, keeping the production names.
+/// </summary>
+void ParseProfile::reset() {
+  for (auto &production : productions) {
+    production = Production{production.name};
+  }
+  parses = 0;
+  restores = 0;
+  backtrackBytes = 0;
+  reparses = 0;
+  reparseBytes = 0;
+  aliasExpansions = 0;
+  flowElements = 0;
+}
+/// <summary>
+/// Format the profile as a text table with the productions ordered by
+/// time spent (most expensive first).
+/// </summary>
+/// <returns>Report text.</returns>
+std::string ParseProfile::report() const {
+  std::vector<const Production *> ordered;
+  for (const auto &production : productions) {
+    ordered.push_back(&production);
+  }
+  std::ranges::stable_sort(ordered, [](const auto *lhs, const auto *rhs) {
+    return lhs->nanoseconds > rhs->nanoseconds;
+  });
+  std::ostringstream text;
+  text << "Parses: " << parses << "\n";
+  text << std::left << std::setw(18) << "Production" << std::right
+       << std::setw(12) << "Probes" << std::setw(12) << "Matches"
+       << std::setw(10) << "Misses" << std::setw(14) << "Time (us)"
+       << std::setw(14) << "Bytes" << "\n";
+  for (const auto *production : ordered) {
+    text << std::left << std::setw(18) << production->name << std::right
+         << std::setw(12) << production->probes << std::setw(12)
+         << production->matches << std::setw(10) << production->misses
+         << std::setw(14) << production->nanoseconds / 1000 << std::setw(14)
+         << production->bytes << "\n";
+  }
+  text << "Restores: " << restores << " (" << backtrackBytes
+       << " bytes backtracked)\n";
+  text << "Re-parses: " << reparses << " (" << reparseBytes << " bytes)\n";
+  text << "Alias expansions: " << aliasExpansions << "\n";
+  text << "Flow elements: " << flowElements << "\n";
+  return text.str();
+}
+/// <summary>
+/// Format the profile as a single JSON object.
+/// </summary>
+/// <returns>JSON text.</returns>
+std::string ParseProfile::toJSON() const {
+  std::ostringstream json;
+  json << R"({"parses":)" << parses << R"(,"productions":[)";
+  for (std::size_t index = 0; index < productions.size(); ++index) {
+    const auto &production = productions[index];
+    json << (index != 0 ? "," : "") << R"({"name":")" << production.name
+         << R"(","probes":)" << production.probes << R"(,"matches":)"
+         << production.matches << R"(,"misses":)" << production.misses
+         << R"(,"nanoseconds":)" << production.nanoseconds << R"(,"bytes":)"
+         << production.bytes << "}";
+  }
+  json << R"(],"restores":)" << restores << R"(,"backtrackBytes":)"
+       << backtrackBytes << R"(,"reparses":)" << reparses
+       << R"(,"reparseBytes":)" << reparseBytes << R"(,"aliasExpansions":)"
+       << aliasExpansions << R"(,"flowElements":)" << flowElements << "}";
+  return json.str();
+}
+
+} // namespace YAML_Lib
+
+#endif // YAML_LIB_PROFILE
@@ -27,7 +27,17 @@ Node Default_Parser::parseDocument(ISource &source,
   if (isInsideFlowContext() && isDocumentBoundary(source)) {
     YAML_THROW_POS(source, "Document marker not permitted inside flow collection.");
   }
-  for (std::size_t i = 0; i < parsers_.size(); ++i) {
+  for (auto productions =
+           kFirstByteProductions[static_cast<unsigned char>(source.current())];
+       productions != 0; productions &= productions - 1) {
+    const auto i = static_cast<std::size_t>(std::countr_zero(productions));
+#ifdef YAML_LIB_PROFILE
+    if (Node yNode = parseProduction(i, source, delimiters, indentation);
+        !yNode.isEmpty()) {
+      moveToNextIndent(source);
+      return yNode;
+    }
+#else
     const auto &[fst, snd] = parsers_[i];
     if ((this->*fst)(source)) {
       if (Node yNode = (this->*snd)(source, delimiters, indentation); !yNode.isEmpty()) {
@@ -35,9 +45,45 @@ Node Default_Parser::parseDocument(ISource &source,
         return yNode;
       }
     }
+#endif
   }
   YAML_THROW_POS(source, "Invalid YAML encountered.");
 }
+#ifdef YAML_LIB_PROFILE
+/// <summary>
+/// Run one parsers_ entry (probe then parse) recording its invocation,
+/// time and consumed bytes in the profile.
+/// </summary>
+/// <param name="index">Index of the entry in parsers_.</param>
+/// <param name="source">Source stream.</param>
+/// <param name="delimiters">Delimiters used to parse document.</param>
+/// <param name="indentation">Parent indentation.</param>
+/// <returns>Parsed Node; empty if the entry did not apply.</returns>
+Node Default_Parser::parseProduction(const std::size_t index, ISource &source,
+                                     const Delimiters &delimiters,
+                                     const unsigned long indentation) {
+  auto &production = profile_.productions[index];
+  const auto &[isA, parseFn] = parsers_[index];
+  const auto start = std::chrono::steady_clock::now();
+  production.probes++;
+  Node yNode;
+  if ((this->*isA)(source)) {
+    production.matches++;
+    const std::size_t before = source.position();
+    yNode = (this->*parseFn)(source, delimiters, indentation);
+    if (yNode.isEmpty()) {
+      production.misses++;
+    } else {
+      production.bytes += source.position() - before;
+    }
+  }
+  production.nanoseconds += static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - start)
+          .count());
+  return yNode;
+}
+#endif
 /// <summary>
 /// Parse YAML documents on source stream.
 /// </summary>
@@ -45,19 +91,37 @@ Node Default_Parser::parseDocument(ISource &source,
 /// <returns>Array of YAML documents.</returns>
 std::vector<Node> Default_Parser::parse(ISource &source) {
   std::vector<Node> yNodeTree;
-  ctx_.arrayIndentLevel = 0;
-  ctx_.inlineArrayDepth = 0;
-  ctx_.inlineDictionaryDepth = 0;
-  ctx_.blockFlowValueIndent = 0;
-  ctx_.yamlAliasMap.clear();
-  ctx_.yamlAliasMap.reserve(16);
-  ctx_.yamlTagPrefixes.clear();
-  ctx_.activeAliasExpansions.clear();
-  ctx_.yamlDirectiveMinor = 2;
-  ctx_.yamlDirectiveSeen = false;
+  parseInto(source, yNodeTree);
+  return yNodeTree;
+}
+/// <summary>
+/// Parse YAML documents on source stream into a vector.
+/// </summary>
+/// <param name="source">Source stream.</param>
+/// <param name="yNodeTree">Vector of YAML documents to append to.</param>
+void Default_Parser::parseInto(ISource &source, std::vector<Node> &yNodeTree) {
+  // Alias and tag tables take their storage from this parse's tree
+  // resource: start with empty ones and leave nothing behind that
+  // outlives the parse.
+  struct FreshContext {
+    ParseContext &ctx;
+    explicit FreshContext(ParseContext &context) : ctx(context) { ctx = ParseContext{}; }
+    ~FreshContext() { ctx = ParseContext{}; }
+    FreshContext(const FreshContext &) = delete;
+    FreshContext &operator=(const FreshContext &) = delete;
+  } freshContext{ctx_};
+#ifdef YAML_LIB_PROFILE
+  struct ActiveProfile {
+    ParseProfile *previous;
+    explicit ActiveProfile(ParseProfile &profile) : previous(activeProfile) {
+      activeProfile = &profile;
+    }
+    ~ActiveProfile() { activeProfile = previous; }
+  } activeProfileGuard{profile_};
+  profile_.parses++;
+#endif
   const auto resetDocumentState = [&]() {
     ctx_.yamlAliasMap.clear();
-    ctx_.yamlAliasMap.reserve(16);
     ctx_.activeAliasExpansions.clear();
     ctx_.yamlTagPrefixes.clear();
     ctx_.yamlDirectiveMinor = 2;
@@ -150,8 +214,6 @@ std::vector<Node> Default_Parser::parse(ISource &source) {
       YAML_THROW_POS(source, "Directive must be followed by a document.");
     }
   }
-
-  return yNodeTree;
 }
 /// <summary>
 /// Parse a single YAML directive line (%YAML or %TAG).
@@ -165,20 +227,20 @@ void Default_Parser::parseDirective(ISource &source, const bool inDocument) {
   source.next(); // consume '%'
   // Extract the full directive name so we don't mistake "%YAMLL" for "%YAML"
   // (source.match does a prefix-match that would consume "YAML" from "YAMLL").
-  const std::string directiveName{
+  const ScratchString directiveName{
       extractToNext(source, {kLineFeed, kSpace, '\t'})};
   if (directiveName == "YAML") {
     // %YAML major.minor
     source.ignoreWS();
-    std::string version{extractToNext(source, {kLineFeed, ' '})};
+    ScratchString version{extractToNext(source, {kLineFeed, ' '})};
     const auto dot = version.find('.');
-    if (dot == std::string::npos) {
+    if (dot == ScratchString::npos) {
       YAML_THROW_POS(source, "%YAML directive missing version number.");
     }
     // Validate: version must be all-digit . all-digit (no stray chars like '#')
-    const std::string majorStr = version.substr(0, dot);
-    const std::string minorStr = version.substr(dot + 1);
-    const auto isAllDigits = [](const std::string &s) {
+    const ScratchString majorStr = version.substr(0, dot);
+    const ScratchString minorStr = version.substr(dot + 1);
+    const auto isAllDigits = [](const ScratchString &s) {
       return !s.empty() && std::all_of(s.begin(), s.end(), [](unsigned char c) {
         return std::isdigit(c) != 0;
       });
@@ -187,8 +249,8 @@ void Default_Parser::parseDirective(ISource &source, const bool inDocument) {
       YAML_THROW_POS(source, "%YAML directive has invalid version number '" +
                             version + "'.");
     }
-    const int major = std::stoi(majorStr);
-    const int minor = std::stoi(minorStr);
+    const int major = std::stoi(std::string(majorStr));
+    const int minor = std::stoi(std::string(minorStr));
     if (major != 1) {
       YAML_THROW_POS(source, "%YAML directive: unsupported major version " +
                             std::to_string(major) + ".");
@@ -203,13 +265,13 @@ void Default_Parser::parseDirective(ISource &source, const bool inDocument) {
         source.current() != '#') {
       // Allow one extra version-looking token such as "1.2" in weird but
       // valid legacy directive forms (e.g. ZYU8/2).
-      const std::string trailing{extractToNext(source, {kLineFeed, ' '})};
+      const ScratchString trailing{extractToNext(source, {kLineFeed, ' '})};
       const auto dot2 = trailing.find('.');
-      if (dot2 == std::string::npos) {
+      if (dot2 == ScratchString::npos) {
         YAML_THROW_POS(source, "%YAML directive has unexpected content after version.");
       }
-      const std::string majorSuffix = trailing.substr(0, dot2);
-      const std::string minorSuffix = trailing.substr(dot2 + 1);
+      const ScratchString majorSuffix = trailing.substr(0, dot2);
+      const ScratchString minorSuffix = trailing.substr(dot2 + 1);
       if (!isAllDigits(majorSuffix) || !isAllDigits(minorSuffix)) {
         YAML_THROW_POS(source, "%YAML directive has unexpected content after version.");
       }
@@ -222,9 +284,9 @@ void Default_Parser::parseDirective(ISource &source, const bool inDocument) {
   } else if (directiveName == "TAG") {
     // %TAG handle prefix
     source.ignoreWS();
-    std::string handle{extractToNext(source, {' '})};
+    ScratchString handle{extractToNext(source, {' '})};
     source.ignoreWS();
-    std::string prefix{extractToNext(source, {kLineFeed, ' '})};
+    ScratchString prefix{extractToNext(source, {kLineFeed, ' '})};
     ctx_.yamlTagPrefixes[handle] = prefix;
   } else {
     // Unknown directive — YAML spec says warn and ignore
@@ -111,7 +111,12 @@ Node Default_Parser::parseInlineArray(
                             "beyond its parent block context.");
         }
       }
-      yamlArray.add(parseDocument(source, inLineArrayDelimiters, indentation));
+      Node element = parseFlowElement(source, inLineArrayDelimiters, indentation,
+                                      kRightSquareBracket);
+      if (element.isEmpty()) {
+        element = parseDocument(source, inLineArrayDelimiters, indentation);
+      }
+      yamlArray.add(std::move(element));
       // YAML 1.2 §7.3.3: A plain scalar consisting of only '-' is not allowed in flow context
       if (!yamlArray.value().empty()) {
         const auto &element = yamlArray.value().back();
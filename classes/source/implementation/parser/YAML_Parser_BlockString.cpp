@@ -11,6 +11,43 @@
 
 namespace YAML_Lib {
 
+namespace {
+
+/// <summary>
+/// Size of a block scalar's content: the rest of the current line then
+/// each following line, less its indentation, up to the first non-blank
+/// line indented less than blockIndent or a document marker. Used to size
+/// the result string once.
+/// </summary>
+/// <param name="rest">Unread source text (empty if not contiguous).</param>
+/// <param name="blockIndent">Column of the block scalar content.</param>
+/// <returns>Estimated block scalar length in bytes.</returns>
+std::size_t blockScalarExtent(const std::string_view rest,
+                              const unsigned long blockIndent) {
+  const std::size_t indent = blockIndent > 0 ? blockIndent - 1 : 0;
+  std::size_t end = rest.find(kLineFeed);
+  std::size_t extent = std::min(end, rest.size()) + 1;
+  while (end != std::string_view::npos) {
+    const std::size_t lineStart = end + 1;
+    end = rest.find(kLineFeed, lineStart);
+    const std::string_view line{
+        rest.substr(lineStart, end == std::string_view::npos ? end : end - lineStart)};
+    const std::size_t content = line.find_first_not_of(kSpace);
+    if (content == std::string_view::npos) {
+      extent++;
+      continue;
+    }
+    if (content + 1 < blockIndent || line.starts_with("---") ||
+        line.starts_with("...")) {
+      break;
+    }
+    extent += line.size() - indent + 1;
+  }
+  return extent;
+}
+
+} // namespace
+
 /// <summary>
 /// Parse any block string chomping and optional explicit indentation indicator.
 /// Handles either order: digit-then-chomping (|2-) or chomping-then-digit
@@ -96,7 +133,7 @@ unsigned long Default_Parser::scanToFirstBlockContent(ISource &source) {
 /// <param name="indentation">Parent indentation.</param>
 /// <param name="fillerDefault">Default filler.</param>
 /// <returns>Block string parsed.</returns>
-std::string Default_Parser::parseBlockString(ISource &source,
+ScratchString Default_Parser::parseBlockString(ISource &source,
                                              const Delimiters &delimiters,
                                              unsigned long indentation,
                                              const char fillerDefault) {
@@ -158,17 +195,21 @@ std::string Default_Parser::parseBlockString(ISource &source,
     YAML_THROW_POS(source, "Block scalar blank line has more leading spaces than "
                       "block indentation level.");
   }
-  std::string yamlString{};
+  // Each line is appended straight from the source (one span copy per line
+  // when it is contiguous) into a string sized for the whole block.
+  ScratchString yamlString{};
+  yamlString.reserve(blockScalarExtent(source.remaining(), blockIndent));
+  const auto isDelimiter = [&](const char ch) { return delimiters.contains(ch); };
   do {
     char filler{fillerDefault};
     if (blockIndent < source.getPosition().second) {
       if (!yamlString.empty() && yamlString.back() != kLineFeed) {
         yamlString += kLineFeed;
       }
-      yamlString += std::string(source.getPosition().second - 1, kSpace);
+      yamlString.append(source.getPosition().second - 1, kSpace);
       filler = kLineFeed;
     }
-    yamlString += extractToNext(source, delimiters);
+    source.appendUntil(yamlString, isDelimiter);
     yamlString += filler;
     if (source.more()) {
       source.next();
@@ -29,7 +29,7 @@ void Default_Parser::addUniqueDictEntry(Node &dictionaryNode,
       return;
     }
     YAML_THROW_POS(source, "Dictionary already contains key '" +
-                          std::string(entry.getKey()) + "'.");
+                          ScratchString(entry.getKey()) + "'.");
   }
   NRef<Dictionary>(dictionaryNode).add(std::move(entry));
 }
@@ -43,7 +43,7 @@ void Default_Parser::addUniqueDictEntry(Node &dictionaryNode,
 /// <param name="source">Source stream (used for error position).</param>
 void Default_Parser::addInlineDictEntry(Dictionary &dict, DictionaryEntry entry,
                                         ISource &source) {
-  const std::string keyStr{entry.getKey()};
+  const ScratchString keyStr{entry.getKey()};
   const bool isComplexKey =
       !keyStr.empty() && (keyStr.front() == kLeftSquareBracket ||
                           keyStr.front() == kLeftCurlyBrace);
@@ -61,7 +61,7 @@ void Default_Parser::addInlineDictEntry(Dictionary &dict, DictionaryEntry entry,
 /// </summary>
 /// <param name="source">Source stream.</param>
 /// <returns>The raw collection text including its brackets.</returns>
-std::string Default_Parser::extractInlineCollectionAt(ISource &source) {
+ScratchString Default_Parser::extractInlineCollectionAt(ISource &source) {
   const char start = source.current();
   const char end =
       (start == kLeftCurlyBrace) ? kRightCurlyBrace : kRightSquareBracket;
@@ -77,43 +77,129 @@ Node Default_Parser::convertYAMLToStringNode(
 }
 Node Default_Parser::convertYAMLToStringNode(const std::string_view &yamlString,
                                              unsigned long indentation) {
-  auto keyNode = parseFromBuffer(std::string(yamlString) + kLineFeed,
-                                 {kLineFeed}, indentation);
-  std::string keyString{keyNode.toKey()};
-  char quote = '\"';
+  Node keyNode;
+  if (decodeKey(yamlString, keyNode) == KeyDecode::decoded) {
+    return keyNode;
+  }
+  keyNode = parseFromBuffer(ScratchString(yamlString) + kLineFeed, {kLineFeed},
+                            indentation);
   if (isA<String>(keyNode)) {
-    quote = NRef<String>(keyNode).getQuote();
-    if (keyString.empty()) {
-      quote = kDoubleQuote;
+    const auto &key = NRef<String>(keyNode);
+    return Node::make<String>(key.value(),
+                              key.value().empty() ? kDoubleQuote : key.getQuote());
+  }
+  return Node::make<String>(keyNode.toKey(), kDoubleQuote);
+}
+/// <summary>
+/// Decode a single line key in place, without the parseFromBuffer round trip.
+/// Handles a quoted key whose only quotes are its delimiters (and '' pairs
+/// when single quoted) and a plain key made of word characters that is not a
+/// boolean or null. Anything else (multi-line, anchors, tags, inline
+/// collections, escaped closing quotes) is left to the re-parse.
+/// </summary>
+/// <param name="key">Right-trimmed key text as extracted.</param>
+/// <param name="keyNode">Decoded String node (when decoded).</param>
+/// <returns>decoded, invalid (a malformed quoted key) or reparse.</returns>
+Default_Parser::KeyDecode
+Default_Parser::decodeKey(const std::string_view &key, Node &keyNode) {
+  if (key.empty() || key.find(kLineFeed) != std::string_view::npos) {
+    return KeyDecode::reparse;
+  }
+  const char quote = key.front();
+  if (quote == kDoubleQuote || quote == kApostrophe) {
+    if (key.size() < 2 || key.back() != quote) {
+      return KeyDecode::reparse;
+    }
+    const std::string_view content{key.substr(1, key.size() - 2)};
+    ScratchString decoded;
+    if (quote == kDoubleQuote) {
+      if (content.find(kDoubleQuote) != std::string_view::npos) {
+        return KeyDecode::reparse;
+      }
+      // An odd run of trailing backslashes escapes the closing quote, which
+      // leaves the string unterminated.
+      const auto lastText = content.find_last_not_of('\\');
+      const auto backslashes =
+          content.size() -
+          (lastText == std::string_view::npos ? 0 : lastText + 1);
+      if (backslashes % 2 != 0) {
+        return KeyDecode::invalid;
+      }
+      if (!yamlTranslator_->tryFrom(content, translated_)) {
+        return KeyDecode::invalid;
+      }
+      decoded = translated_;
+    } else {
+      decoded.reserve(content.size());
+      for (std::size_t index = 0; index < content.size(); ++index) {
+        if (content[index] == kApostrophe) {
+          if (index + 1 == content.size() || content[index + 1] != kApostrophe) {
+            return KeyDecode::reparse;
+          }
+          ++index; // '' is an escaped quote
+        }
+        decoded += content[index];
+      }
     }
+    // An empty key is always reported as double quoted.
+    keyNode = Node::make<String>(decoded,
+                                 decoded.empty() ? kDoubleQuote : quote);
+    return KeyDecode::decoded;
   }
-  return Node::make<String>(keyString, quote);
+  const auto isWordCharacter = [](const unsigned char ch) {
+    return std::isalnum(ch) || ch == '_' || ch == '-' || ch == '.' ||
+           ch == '/' || ch == kSpace;
+  };
+  if (!(std::isalpha(static_cast<unsigned char>(quote)) || quote == '_') ||
+      !std::ranges::all_of(key, isWordCharacter)) {
+    return KeyDecode::reparse;
+  }
+  const ScratchString plain{key};
+  if (!booleanFromToken(plain).isEmpty() || !noneFromToken(plain).isEmpty()) {
+    return KeyDecode::reparse;
+  }
+  keyNode = Node::make<String>(plain, kNull);
+  return KeyDecode::decoded;
 }
 /// <summary>
 /// Does the string constitute a valid dictionary key?
 /// Empty / whitespace-only strings map to YAML null keys (valid).
 /// A key whose first non-whitespace character is '#' is a comment (invalid).
 /// Plain scalar keys are accepted directly (fast path, no allocation).
-/// Quoted-string extractions are re-validated via parseFromBuffer because
-/// extractString() does not process escape sequences: "foo\": bar" is
-/// extracted raw as "foo\" (stopping at the wrong "), and only the
-/// mini-parse can tell that the result is not a well-formed YAML value.
+/// Quoted-string extractions are decoded in place where possible; the rest
+/// are re-scanned because extractString() does not process escape
+/// sequences: "foo\": bar" is extracted raw as "foo\" (stopping at the
+/// wrong "), and only a scan of the whole scalar can tell that the result
+/// is not a well-formed YAML value. The scan reports failure as a status,
+/// so rejecting a key never throws.
 /// </summary>
 /// <param name="key">Candidate key string.</param>
 /// <returns>True if key is valid.</returns>
-bool Default_Parser::isValidKey(const std::string_view &key) noexcept {
+bool Default_Parser::isValidKey(const std::string_view &key) {
   const auto first = key.find_first_not_of(" \t");
   if (first == std::string_view::npos) return true; // null/empty key
   if (key[first] == '#') return false;              // comment
   if (key[first] == kDoubleQuote || key[first] == kApostrophe) {
-    // Slow path: re-parse to catch truncated quoted-string extractions.
-    try {
-      const Node keyNode =
-          parseFromBuffer(std::string(key) + kLineFeed, {kLineFeed}, 0);
-      return !keyNode.isEmpty() && !isA<Comment>(keyNode);
-    } catch ([[maybe_unused]] const std::exception &e) {
+    if (first == 0) {
+      Node keyNode;
+      if (const auto decode = decodeKey(key, keyNode);
+          decode != KeyDecode::reparse) {
+        return decode == KeyDecode::decoded;
+      }
+    }
+    // Slow path: scan the whole quoted scalar to catch truncated
+    // extractions. A leading tab is block indentation, which is invalid. A
+    // ':' after the scalar makes the key a mapping, which is only judged
+    // when convertYAMLToStringNode parses it.
+    if (key.front() == '\t') {
       return false;
     }
+    const ScratchString text{ScratchString(key) + kLineFeed};
+    BufferSource keySource{text};
+    for (std::size_t skipped = 0; skipped < first; ++skipped) {
+      keySource.next();
+    }
+    return probeQuotedFlowString(keySource, {kLineFeed, kColon}, 0);
   }
   return true; // fast path: plain scalar, anchor, tag, inline collection, etc.
 }
@@ -122,8 +208,8 @@ bool Default_Parser::isValidKey(const std::string_view &key) noexcept {
 /// </summary>
 /// <param name="source">Source stream.</param>
 /// <returns>Extracted mapping/.</returns>
-std::string Default_Parser::extractMapping(ISource &source) {
-  std::string key;
+ScratchString Default_Parser::extractMapping(ISource &source) {
+  ScratchString key;
   // Save the column of the '?' indicator so we know how deep the block key
   // content must be indented when capturing continuation lines.
   const auto questionCol = source.getPosition().second;
@@ -143,7 +229,7 @@ std::string Default_Parser::extractMapping(ISource &source) {
   // Capture lines up to a ':' at the same column as the '?' indicator.
   if (ctx_.inlineDictionaryDepth == 0 && source.current() == kLineFeed) {
     source.next(); // first line of key node content (or ':' line)
-    std::string multilineKey;
+    ScratchString multilineKey;
     while (source.more()) {
       if (source.getPosition().second == questionCol &&
           source.current() == kColon) {
@@ -170,7 +256,7 @@ std::string Default_Parser::extractMapping(ISource &source) {
   } else if (isArray(source)) {
     key += extractToNext(source, {kLineFeed});
     if (source.more() && source.current() == kLineFeed) {
-      std::string multilineKey;
+      ScratchString multilineKey;
       multilineKey += kLineFeed;
       source.next();
       while (source.more()) {
@@ -229,7 +315,7 @@ std::string Default_Parser::extractMapping(ISource &source) {
           break;
         }
         // Line is sufficiently indented: re-read and append to key.
-        std::string lineContent;
+        ScratchString lineContent;
         while (source.more() && source.current() == kSpace) {
           lineContent += source.current();
           source.next();
@@ -244,8 +330,8 @@ std::string Default_Parser::extractMapping(ISource &source) {
     }
     key += kColon;
   } else {
-    std::string text = extractToNext(source, {kLineFeed});
-    std::string multilineKey;
+    ScratchString text = extractToNext(source, {kLineFeed});
+    ScratchString multilineKey;
     bool multiline = false;
     if (source.more() && source.current() == kLineFeed) {
       source.next();
@@ -272,10 +358,10 @@ std::string Default_Parser::extractMapping(ISource &source) {
         if (lineTooShallow) {
           break;
         }
-        std::size_t separatorPos = std::string::npos;
+        std::size_t separatorPos = ScratchString::npos;
         {
           SourceGuard lineGuard(source);
-          const std::string line = extractToNext(source, {kLineFeed});
+          const ScratchString line = extractToNext(source, {kLineFeed});
           for (std::size_t pos = 0; pos < line.size(); ++pos) {
             if (line[pos] != kColon) {
               continue;
@@ -288,8 +374,8 @@ std::string Default_Parser::extractMapping(ISource &source) {
             }
           }
         }
-        if (separatorPos != std::string::npos) {
-          std::string linePrefix;
+        if (separatorPos != ScratchString::npos) {
+          ScratchString linePrefix;
           for (std::size_t i = 0; i < separatorPos; ++i) {
             linePrefix += source.append();
           }
@@ -331,12 +417,12 @@ std::string Default_Parser::extractMapping(ISource &source) {
 /// </summary>
 /// <param name="source">Source stream.</param>
 /// <returns>YAML for key value.</returns>
-std::string Default_Parser::extractKey(ISource &source,
+ScratchString Default_Parser::extractKey(ISource &source,
                                        unsigned long *quoteIndent) {
   const auto extractPlainKeyTail = [this, &source]() {
     const Delimiters plainKeyDelimiters = keyStopDelimiters();
     const Delimiters delimitersWithComment = withExtras(plainKeyDelimiters, {'#'});
-    std::string keyTail;
+    ScratchString keyTail;
     while (source.more()) {
       keyTail += extractToNext(source, delimitersWithComment);
       if (!source.more())
@@ -381,7 +467,7 @@ std::string Default_Parser::extractKey(ISource &source,
   // inside the inline collection; the anchor branch handles it bracket-aware
   // instead.
   if (source.current() == '&') {
-    std::string result{"&"};
+    ScratchString result{"&"};
     source.next();
     result += extractToNext(source, {kSpace, '\t', kLineFeed});
     result += ' ';
@@ -400,7 +486,7 @@ std::string Default_Parser::extractKey(ISource &source,
   // "!<tag:yaml.org,2002:str> foo : ..."). The tag token may contain ':'
   // characters, so plain-scalar key extraction cannot start at the tag.
   if (source.current() == '!') {
-    std::string result{"!"};
+    ScratchString result{"!"};
     source.next();
     if (!source.more()) {
       return result;
@@ -481,13 +567,61 @@ std::string Default_Parser::extractKey(ISource &source,
   return extractPlainKeyTail();
 }
 /// <summary>
+/// Decode a flow mapping key directly from a contiguous source: a plain
+/// word or a quoted scalar with no escapes, immediately followed by ": ".
+/// The key text is handed to decodeKey in place rather than extracted; any
+/// other key is left untouched for parseKey.
+/// </summary>
+/// <param name="source">Source stream (at the start of the key).</param>
+/// <returns>Key Node with ':' consumed (empty if parseKey is needed).</returns>
+Node Default_Parser::parseFlowKey(ISource &source) {
+  const std::string_view rest{source.remaining()};
+  if (rest.empty()) {
+    return {};
+  }
+  const char first = rest.front();
+  std::size_t end = 1;
+  if (first == kDoubleQuote || first == kApostrophe) {
+    while (end < rest.size() && rest[end] != first && rest[end] != '\\' &&
+           static_cast<unsigned char>(rest[end]) >= kSpace &&
+           rest[end] != '\x7f') {
+      ++end;
+    }
+    if (end == rest.size() || rest[end] != first) {
+      return {};
+    }
+    ++end;
+  } else if (std::isalpha(static_cast<unsigned char>(first)) != 0 ||
+             first == '_') {
+    while (end < rest.size() &&
+           (std::isalnum(static_cast<unsigned char>(rest[end])) != 0 ||
+            rest[end] == '_' || rest[end] == '-' || rest[end] == '.' ||
+            rest[end] == '/')) {
+      ++end;
+    }
+  } else {
+    return {};
+  }
+  Node keyNode;
+  if (end + 1 >= rest.size() || rest[end] != kColon ||
+      rest[end + 1] != kSpace ||
+      decodeKey(rest.substr(0, end), keyNode) != KeyDecode::decoded) {
+    return {};
+  }
+  source.skip(end + 1);
+#ifdef YAML_LIB_PROFILE
+  profile_.flowElements++;
+#endif
+  return keyNode;
+}
+/// <summary>
 /// Parse dictionary key on source stream.
 /// </summary>
 /// <param name="source">Source stream.</param>
 /// <returns>Dictionary entry key.</returns>
 Node Default_Parser::parseKey(ISource &source) {
   unsigned long keyQuoteIndent = 0;
-  std::string key{extractKey(source, &keyQuoteIndent)};
+  ScratchString key{extractKey(source, &keyQuoteIndent)};
   // Patch: In flow context, allow multi-line explicit keys (e.g., '? foo\n bar
   // : baz')
   if (isInsideFlowContext()) {
@@ -522,6 +656,14 @@ Node Default_Parser::parseKey(ISource &source) {
     source.next();
   }
   rightTrim(key);
+  // Single line keys are validated and decoded in one step.
+  Node keyNode;
+  if (const auto decode = decodeKey(key, keyNode);
+      decode == KeyDecode::decoded) {
+    return keyNode;
+  } else if (decode == KeyDecode::invalid) {
+    YAML_THROW_POS(source, "Invalid key '" + key + "' specified.");
+  }
   if (!isValidKey(key)) {
     YAML_THROW_POS(source, "Invalid key '" + key + "' specified.");
   }
@@ -617,7 +759,10 @@ DictionaryEntry
 Default_Parser::parseInlineKeyValue(ISource &source,
                                     const Delimiters &delimiters,
                                     const unsigned long indentation) {
-  Node keyNode = parseKey(source);
+  Node keyNode = parseFlowKey(source);
+  if (keyNode.isEmpty()) {
+    keyNode = parseKey(source);
+  }
   Node dictionaryNode = Node::make<Null>();
   // In a single-line flow mapping ({k: v}), parseKey already consumed ':'
   // when it was the next token. In multi-line flow mappings, comments or a
@@ -632,7 +777,11 @@ Default_Parser::parseInlineKeyValue(ISource &source,
   }
   if (source.more() && source.current() != kComma &&
       source.current() != kRightCurlyBrace) {
-    dictionaryNode = parseDocument(source, delimiters, indentation);
+    dictionaryNode = parseFlowElement(source, delimiters, indentation,
+                                      kRightCurlyBrace);
+    if (dictionaryNode.isEmpty()) {
+      dictionaryNode = parseDocument(source, delimiters, indentation);
+    }
   }
   return {keyNode, std::move(dictionaryNode)};
 }
@@ -22,10 +22,10 @@ Node Default_Parser::mergeOverrides(Node &overrideRoot) {
       NRef<Dictionary>(overrideRoot).contains(kOverride)) {
     auto &dictionary = NRef<Dictionary>(overrideRoot);
     // Collect explicit (non-override) keys for later merging.
-    std::set<std::string> overrideKeys;
+    ScratchSet overrideKeys;
     for (auto &entry : dictionary.value()) {
       if (entry.getKey() != kOverride) {
-        overrideKeys.insert(std::string(entry.getKey()));
+        overrideKeys.insert(ScratchString(entry.getKey()));
       }
     }
     // Apply explicit outer keys on top of a base dictionary (shared by both
@@ -53,7 +53,7 @@ Node Default_Parser::mergeOverrides(Node &overrideRoot) {
               "Merge key '<<' sequence must contain only mappings.");
         }
         for (auto &entry : NRef<Dictionary>(element).value()) {
-          const std::string key{entry.getKey()};
+          const ScratchString key{entry.getKey()};
           if (!mergedDict.contains(key)) {
             mergedDict.add(DictionaryEntry(key, std::move(entry.getNode())));
           }
@@ -73,7 +73,7 @@ Node Default_Parser::mergeOverrides(Node &overrideRoot) {
 /// <param name="name">Alias name to resolve.</param>
 /// <param name="source">Source stream (used only for error position).</param>
 /// <returns>Reference to the stored unparsed alias value.</returns>
-const std::string &Default_Parser::resolveAlias(const std::string &name,
+const ScratchString &Default_Parser::resolveAlias(const ScratchString &name,
                                                 ISource &source) {
   if (!ctx_.yamlAliasMap.count(name)) {
     YAML_THROW_POS(source, "Undefined alias '" + name + "'.");
@@ -89,7 +89,7 @@ const std::string &Default_Parser::resolveAlias(const std::string &name,
 Node Default_Parser::parseComment(
     ISource &source, [[maybe_unused]] const Delimiters &delimiters) {
   source.next();
-  std::string comment{extractToNext(source, {kLineFeed})};
+  ScratchString comment{extractToNext(source, {kLineFeed})};
   if (source.more()) {
     source.next();
   }
@@ -106,29 +106,29 @@ Node Default_Parser::parseComment(
 Node Default_Parser::parseAnchor(ISource &source, const Delimiters &delimiters,
                                  const unsigned long indentation) {
   source.next();
-  const std::string name{extractToNext(source, {kLineFeed, kSpace})};
+  const ScratchString name{extractToNext(source, {kLineFeed, kSpace})};
   source.ignoreWS();
-  const auto isStandaloneTagToken = [](const std::string &text) {
+  const auto isStandaloneTagToken = [](const ScratchString &text) {
     const auto first = text.find_first_not_of(" \t");
-    if (first == std::string::npos || text[first] != '!') {
+    if (first == ScratchString::npos || text[first] != '!') {
       return false;
     }
-    return text.find_first_of(" \t", first) == std::string::npos;
+    return text.find_first_of(" \t", first) == ScratchString::npos;
   };
-  const auto isStandaloneFlowCollectionStart = [](const std::string &text) {
+  const auto isStandaloneFlowCollectionStart = [](const ScratchString &text) {
     const auto first = text.find_first_not_of(" \t");
-    if (first == std::string::npos) {
+    if (first == ScratchString::npos) {
       return false;
     }
     const char firstChar = text[first];
     if (firstChar != kLeftSquareBracket && firstChar != kLeftCurlyBrace) {
       return false;
     }
-    return text.find_first_not_of(" \t", first + 1) == std::string::npos;
+    return text.find_first_not_of(" \t", first + 1) == ScratchString::npos;
   };
-  const auto closingFlowCollectionChar = [](const std::string &text) {
+  const auto closingFlowCollectionChar = [](const ScratchString &text) {
     const auto first = text.find_first_not_of(" \t");
-    if (first == std::string::npos) {
+    if (first == ScratchString::npos) {
       return '\0';
     }
     return text[first] == kLeftSquareBracket
@@ -136,7 +136,7 @@ Node Default_Parser::parseAnchor(ISource &source, const Delimiters &delimiters,
                : (text[first] == kLeftCurlyBrace ? kRightCurlyBrace : '\0');
   };
   bool inlineValue = false;
-  std::string unparsed{};
+  ScratchString unparsed{};
   if (source.current() != kLineFeed && !isComment(source)) {
     inlineValue = true;
     // In flow context the caller's delimiters include ']', '}', ',' etc.
@@ -181,7 +181,7 @@ Node Default_Parser::parseAnchor(ISource &source, const Delimiters &delimiters,
   // node → reject.
   {
     const auto firstContent = unparsed.find_first_not_of(" \t\n\r");
-    if (firstContent != std::string::npos) {
+    if (firstContent != ScratchString::npos) {
       if (inlineValue && unparsed[firstContent] == '-' &&
           firstContent + 1 < unparsed.size() &&
           (unparsed[firstContent + 1] == ' ' ||
@@ -226,7 +226,7 @@ Node Default_Parser::parseAlias(ISource &source, const Delimiters &delimiters,
   // Stop alias-name extraction at flow separators as well as space/linefeed.
   Delimiters nameDelimiters{kLineFeed, kSpace, kComma, kRightSquareBracket,
                             kRightCurlyBrace};
-  const std::string name{extractToNext(source, nameDelimiters)};
+  const ScratchString name{extractToNext(source, nameDelimiters)};
   // Advance past trailing spaces; consume a terminating linefeed in block
   // context only (flow terminators such as ',' or ']' must not be consumed).
   source.ignoreWS();
@@ -239,16 +239,19 @@ Node Default_Parser::parseAlias(ISource &source, const Delimiters &delimiters,
   if (maxAliasExpansions != 0 && ++aliasExpansionCount > maxAliasExpansions) {
     YAML_THROW_POS(source, "YAML alias expansion limit exceeded.");
   }
-  const std::string &unparsed = resolveAlias(name, source);
+#ifdef YAML_LIB_PROFILE
+  profile_.aliasExpansions++;
+#endif
+  const ScratchString &unparsed = resolveAlias(name, source);
   if (unparsed.empty()) {
     return Node::make<Null>();
   }
   ctx_.activeAliasExpansions.insert(name);
   auto &activeExps = ctx_.activeAliasExpansions;
   struct AliasGuard {
-    std::set<std::string> &set_;
-    const std::string &name_;
-    AliasGuard(std::set<std::string> &s, const std::string &n) : set_(s), name_(n) {}
+    ScratchSet &set_;
+    const ScratchString &name_;
+    AliasGuard(ScratchSet &s, const ScratchString &n) : set_(s), name_(n) {}
     ~AliasGuard() { set_.erase(name_); }
   } aliasGuard{activeExps, name};
   return parseFromBuffer(unparsed, delimiters, indentation);
@@ -269,9 +272,12 @@ Node Default_Parser::parseOverride(ISource &source,
     YAML_THROW_POS(source, "Missing '*' from alias.");
   }
   source.next();
-  const std::string name{extractToNext(source, {kLineFeed, kSpace})};
+  const ScratchString name{extractToNext(source, {kLineFeed, kSpace})};
   source.next();
-  const std::string &unparsed = resolveAlias(name, source);
+  const ScratchString &unparsed = resolveAlias(name, source);
+#ifdef YAML_LIB_PROFILE
+  profile_.aliasExpansions++;
+#endif
   return parseFromBuffer(unparsed, delimiters, indentation);
 }
 
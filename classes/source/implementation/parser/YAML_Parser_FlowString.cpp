@@ -13,23 +13,26 @@ namespace YAML_Lib {
 
 namespace {
 
-void prepareQuotedContinuationLine(ISource &source,
-                                   const unsigned long minIndent) {
+// Skip the indentation of a quoted scalar continuation line, returning an
+// error message if it is not valid (nullptr when it is).
+const char *prepareQuotedContinuationLine(ISource &source,
+                                          const unsigned long minIndent) {
   if (minIndent > 0 && source.more() && source.current() == '\t') {
-    YAML_THROW_POS(source, "Tab character not allowed in YAML block indentation.");
+    return "Tab character not allowed in YAML block indentation.";
   }
   source.ignoreWS();
   if (minIndent > 0 && source.more() && source.current() != kLineFeed &&
       source.getPosition().second <= minIndent) {
-    YAML_THROW_POS(source, "Multiline quoted scalar continuation must be indented beyond its "
-        "parent context.");
+    return "Multiline quoted scalar continuation must be indented beyond its "
+           "parent context.";
   }
+  return nullptr;
 }
 
 } // namespace
 
 bool Default_Parser::isInlineComment(const ISource &source,
-                                     const std::string &yamlString) {
+                                     const ScratchString &yamlString) {
   return source.current() == '#' && !yamlString.empty() &&
          (yamlString.back() == ' ' || yamlString.back() == '\t');
 }
@@ -42,13 +45,16 @@ bool Default_Parser::isInlineComment(const ISource &source,
 /// </summary>
 /// <param name="source">Source stream.</param>
 /// <param name="yamlString">YAML string appended too.</param>
-void Default_Parser::appendCharacterToString(ISource &source,
-                                             std::string &yamlString,
-                                             const bool escapeAware,
-                                             const unsigned long minIndent) {
+/// <returns>Error message for an invalid continuation line (only possible
+/// when minIndent is non-zero), otherwise nullptr.</returns>
+const char *Default_Parser::appendCharacterToString(
+    ISource &source, ScratchString &yamlString, const bool escapeAware,
+    const unsigned long minIndent) {
   if (source.current() == kLineFeed) {
     source.next();
-    prepareQuotedContinuationLine(source, minIndent);
+    if (const char *error = prepareQuotedContinuationLine(source, minIndent)) {
+      return error;
+    }
     // Strip trailing whitespace from the current line before folding.
     // In escape-aware mode (double-quoted strings) do not strip a space or tab
     // that is the second byte of an escape sequence (e.g. \<TAB> or \ ).
@@ -69,6 +75,7 @@ void Default_Parser::appendCharacterToString(ISource &source,
   } else {
     yamlString += source.append();
   }
+  return nullptr;
 }
 /// <summary>
 /// Parse plain flow string on source stream.
@@ -84,7 +91,7 @@ Node Default_Parser::parsePlainFlowString(ISource &source,
   // all trailing whitespace + the sentinel space.  For multi-line scalars we
   // must strip trailing whitespace from the first line BEFORE adding the
   // fold-space, so that "hello   \nworld" → "hello world" (YAML 1.2 §6.5).
-  std::string yamlString{extractToNext(source, delimiters)};
+  ScratchString yamlString{extractToNext(source, delimiters)};
   // YAML 1.2 §6.8: '#' introduces a comment ONLY when preceded by whitespace.
   // If extraction stopped at '#' but the preceding character is NOT whitespace,
   // '#' is a literal — consume it and continue extracting to the next
@@ -230,18 +237,19 @@ Node Default_Parser::parsePlainFlowString(ISource &source,
   return Node::make<String>(yamlString, kNull);
 }
 /// <summary>
-/// Parse quoted flow string on source stream.
+/// Scan a quoted scalar from its opening to its closing quote, collecting
+/// its content with line folding applied but escapes (double quoted) not
+/// yet translated. Errors are returned rather than thrown so that a
+/// speculative probe can reject the scalar with a branch.
 /// </summary>
-/// <param name="source">Source stream.</param>
-/// <param name="delimiters">Delimiters used to parse string.</param>
+/// <param name="source">Source stream (at the opening quote).</param>
 /// <param name="indentation">Parent indentation.</param>
-/// <returns>String Node.</returns>
-Node Default_Parser::parseQuotedFlowString(ISource &source,
-                                           const Delimiters &delimiters,
-                                           const unsigned long indentation) {
+/// <param name="yamlString">Scalar content.</param>
+/// <returns>Error message, or nullptr if the scalar is well formed.</returns>
+const char *Default_Parser::scanQuotedScalar(ISource &source,
+                                             const unsigned long indentation,
+                                             ScratchString &yamlString) {
   const char quote = source.append();
-  std::string yamlString;
-  bool closedQuote = false;
   if (quote == kDoubleQuote) {
     while (source.more() && source.current() != quote) {
       // YAML 1.2: document-start (---) and document-end (...) markers at
@@ -252,15 +260,13 @@ Node Default_Parser::parseQuotedFlowString(ISource &source,
       // whitespace or EOF ('...x' without space is valid literal content).
       if (source.getPosition().second == 1) {
         if (isDocumentStart(source)) {
-          YAML_THROW_POS(source, "Document start marker inside double-quoted "
-                            "string.");
+          return "Document start marker inside double-quoted string.";
         }
         {
           SourceGuard guard(source);
           if (source.match("...") && (!source.more() || source.isWS() ||
                                       source.current() == kLineFeed)) {
-            YAML_THROW_POS(source, "Document end marker inside double-quoted "
-                              "string.");
+            return "Document end marker inside double-quoted string.";
           }
         }
       }
@@ -271,72 +277,79 @@ Node Default_Parser::parseQuotedFlowString(ISource &source,
           // the backslash, the newline, and all leading white space on the
           // continuation line.
           source.next(); // consume LF
-          prepareQuotedContinuationLine(source, indentation);
+          if (const char *error =
+                  prepareQuotedContinuationLine(source, indentation)) {
+            return error;
+          }
         } else {
           yamlString += '\\';
           if (source.more()) {
             yamlString += source.append();
           }
         }
-      } else {
-        appendCharacterToString(source, yamlString, true, indentation);
+      } else if (const char *error = appendCharacterToString(
+                     source, yamlString, true, indentation)) {
+        return error;
       }
     }
     if (!source.more() || source.current() != quote) {
-      YAML_THROW_POS(source, "Missing closing quote.");
+      return "Missing closing quote.";
     }
     source.next(); // consume closing quote
-    closedQuote = true;
-    yamlString = yamlTranslator_->from(yamlString);
-  } else {
-    bool isKeyContext = false;
-    // Heuristic: If the next non-whitespace after the quoted string is ':', assume key context.
-    // Save position for lookahead.
-    {
-      SourceGuard guard(source);
-      // Skip the opening quote
-      // (already consumed above)
-      // Look ahead for ':' after closing quote
-      while (source.more() && (source.current() == ' ' || source.current() == '\t')) source.next();
-      if (source.more() && source.current() == ':') isKeyContext = true;
-    }
-    while (source.more()) {
-      // YAML 1.2: document-start (---) and document-end (...) markers at
-      // column 1 terminate a flow scalar. Inside a single-quoted string that
-      // is a syntax error (RXY3).
-      if (source.getPosition().second == 1) {
-        if (isDocumentStart(source)) {
-          YAML_THROW_POS(source, "Document start marker inside single-quoted "
-                            "string.");
-        }
-        {
-          SourceGuard guard(source);
-          if (source.match("...") && (!source.more() || source.isWS() ||
-                                      source.current() == kLineFeed)) {
-            YAML_THROW_POS(source, "Document end marker inside single-quoted "
-                              "string.");
-          }
+    return nullptr;
+  }
+  bool isKeyContext = false;
+  // Heuristic: If the next non-whitespace after the quoted string is ':', assume key context.
+  // Save position for lookahead.
+  {
+    SourceGuard guard(source);
+    // Skip the opening quote
+    // (already consumed above)
+    // Look ahead for ':' after closing quote
+    while (source.more() && (source.current() == ' ' || source.current() == '\t')) source.next();
+    if (source.more() && source.current() == ':') isKeyContext = true;
+  }
+  while (source.more()) {
+    // YAML 1.2: document-start (---) and document-end (...) markers at
+    // column 1 terminate a flow scalar. Inside a single-quoted string that
+    // is a syntax error (RXY3).
+    if (source.getPosition().second == 1) {
+      if (isDocumentStart(source)) {
+        return "Document start marker inside single-quoted string.";
+      }
+      {
+        SourceGuard guard(source);
+        if (source.match("...") && (!source.more() || source.isWS() ||
+                                    source.current() == kLineFeed)) {
+          return "Document end marker inside single-quoted string.";
         }
       }
+    }
+    if (source.current() == quote) {
+      source.next();
       if (source.current() == quote) {
-        source.next();
-        if (source.current() == quote) {
-          yamlString += source.append();
-        } else {
-          closedQuote = true;
-          break;
-        }
-      } else if (source.current() == kLineFeed && isKeyContext) {
-        // Disallow multi-line single-quoted string as mapping key (YAML 1.2)
-        YAML_THROW_POS(source, "Multi-line single-quoted string is not allowed as a mapping key.");
+        yamlString += source.append();
       } else {
-        appendCharacterToString(source, yamlString);
+        return nullptr;
       }
+    } else if (source.current() == kLineFeed && isKeyContext) {
+      // Disallow multi-line single-quoted string as mapping key (YAML 1.2)
+      return "Multi-line single-quoted string is not allowed as a mapping key.";
+    } else {
+      appendCharacterToString(source, yamlString);
     }
   }
-  if (!closedQuote) {
-    YAML_THROW_POS(source, "Missing closing quote.");
-  }
+  return "Missing closing quote.";
+}
+/// <summary>
+/// Check what follows the closing quote of a quoted scalar: white space
+/// then a comment, line break or delimiter.
+/// </summary>
+/// <param name="source">Source stream (just past the closing quote).</param>
+/// <param name="delimiters">Delimiters used to parse string.</param>
+/// <returns>Error message, or nullptr if the scalar ends cleanly.</returns>
+const char *Default_Parser::scanQuotedScalarEnd(ISource &source,
+                                                const Delimiters &delimiters) {
   bool sawTrailingWhitespace = false;
   while (source.more() &&
          (source.current() == kSpace || source.current() == '\t')) {
@@ -346,14 +359,72 @@ Node Default_Parser::parseQuotedFlowString(ISource &source,
   // YAML 1.2 §6.6: comments must be separated from scalars by whitespace.
   if (source.more() && source.current() == '#') {
     if (!sawTrailingWhitespace) {
-      YAML_THROW_POS(source, "Comment must be preceded by whitespace.");
+      return "Comment must be preceded by whitespace.";
     }
   } else if (source.more() && source.current() != kLineFeed &&
              !delimiters.contains(source.current())) {
-    YAML_THROW_POS(source, "Invalid trailing content after quoted scalar.");
+    return "Invalid trailing content after quoted scalar.";
+  }
+  return nullptr;
+}
+/// <summary>
+/// Translate the escapes of a double quoted scalar into a buffer kept by the
+/// parser, so that steady state parsing allocates nothing for them.
+/// </summary>
+/// <param name="escapedString">Scalar text between the quotes.</param>
+/// <returns>Translated text (valid until the next translation).</returns>
+std::string_view
+Default_Parser::translateEscapes(const std::string_view &escapedString) {
+  if (!yamlTranslator_->tryFrom(escapedString, translated_)) {
+    // Let from() report why.
+    translated_ = yamlTranslator_->from(escapedString);
+  }
+  return translated_;
+}
+/// <summary>
+/// Parse quoted flow string on source stream.
+/// </summary>
+/// <param name="source">Source stream.</param>
+/// <param name="delimiters">Delimiters used to parse string.</param>
+/// <param name="indentation">Parent indentation.</param>
+/// <returns>String Node.</returns>
+Node Default_Parser::parseQuotedFlowString(ISource &source,
+                                           const Delimiters &delimiters,
+                                           const unsigned long indentation) {
+  const char quote = source.current();
+  ScratchString yamlString;
+  if (const char *error = scanQuotedScalar(source, indentation, yamlString)) {
+    YAML_THROW_POS(source, error);
+  }
+  const std::string_view value{quote == kDoubleQuote ? translateEscapes(yamlString)
+                                                     : std::string_view{yamlString}};
+  if (const char *error = scanQuotedScalarEnd(source, delimiters)) {
+    YAML_THROW_POS(source, error);
   }
   moveToNext(source, delimiters);
-  return Node::make<String>(yamlString, quote);
+  return Node::make<String>(value, quote);
+}
+/// <summary>
+/// Would a quoted scalar parse cleanly? The same scan as
+/// parseQuotedFlowString, with escapes checked through tryFrom, so a
+/// malformed scalar costs a failed status instead of an exception.
+/// </summary>
+/// <param name="source">Source stream (at the opening quote).</param>
+/// <param name="delimiters">Delimiters used to parse string.</param>
+/// <param name="indentation">Parent indentation.</param>
+/// <returns>True if the quoted scalar is well formed.</returns>
+bool Default_Parser::probeQuotedFlowString(ISource &source,
+                                           const Delimiters &delimiters,
+                                           const unsigned long indentation) {
+  const char quote = source.current();
+  ScratchString yamlString;
+  if (scanQuotedScalar(source, indentation, yamlString) != nullptr) {
+    return false;
+  }
+  if (quote == kDoubleQuote && !yamlTranslator_->tryFrom(yamlString, translated_)) {
+    return false;
+  }
+  return scanQuotedScalarEnd(source, delimiters) == nullptr;
 }
 
 } // namespace YAML_Lib
\ No newline at end of file
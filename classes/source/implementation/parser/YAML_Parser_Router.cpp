@@ -19,15 +19,63 @@ namespace YAML_Lib {
 bool Default_Parser::isOverride(ISource &source) {
   return matchesMarker(source, "<<:");
 }
+/// <summary>
+/// Could a key start at the current position? A plain key runs to the first
+/// key-stop delimiter (a line feed, and in flow context ',', ']' or '}'), and
+/// it is only a key if a ':' comes before that. Finding that ':' in the
+/// buffer lets isKey reject a plain scalar line without the extractKey
+/// lookahead. Quoted, bracketed, '?', '&' and '!' keys may span lines, so
+/// they are always probed. So are sources without a contiguous buffer, and
+/// text containing characters that extractKey would reject.
+/// </summary>
+/// <param name="source">Source stream.</param>
+/// <returns>False only if isKey would certainly return false.</returns>
+bool Default_Parser::hasKeyColon(ISource &source) {
+  const std::string_view rest{source.remaining()};
+  if (rest.empty()) {
+    return true;
+  }
+  switch (rest.front()) {
+  case kDoubleQuote:
+  case kApostrophe:
+  case kLeftSquareBracket:
+  case kLeftCurlyBrace:
+  case '?':
+  case '&':
+  case '!':
+    return true;
+  default:
+    break;
+  }
+  const bool inFlow = isInsideFlowContext();
+  for (const char ch : rest) {
+    if (ch == kColon) {
+      return true;
+    }
+    if (ch == kLineFeed ||
+        (inFlow && (ch == kComma || ch == kRightSquareBracket ||
+                    ch == kRightCurlyBrace))) {
+      return false;
+    }
+    if ((static_cast<unsigned char>(ch) < kSpace && ch != '\t' && ch != '\r') ||
+        ch == '\x7f') {
+      return true;
+    }
+  }
+  return true;
+}
 // <summary>
 // Has a dictionary key been found in the source stream?
 // </summary>
 // <param name="source">Source stream.</param>
 // <returns>== true if a dictionary key has been found.</returns>
 bool Default_Parser::isKey(ISource &source) {
+  if (!hasKeyColon(source)) {
+    return false;
+  }
   SourceGuard guard(source);
   bool keyPresent{false};
-  if (std::string key{extractKey(source)};
+  if (ScratchString key{extractKey(source)};
       source.current() == kColon || (!key.empty() && key.back() == kColon)) {
     const bool nonPlainFlowKey =
         !key.empty() &&
@@ -36,11 +84,11 @@ bool Default_Parser::isKey(ISource &source) {
          key.front() == '&' || key.front() == '!');
     if (ctx_.inlineDictionaryDepth == 0 && !key.empty() &&
         (key.front() == kDoubleQuote || key.front() == kApostrophe) &&
-        key.find('\n') != std::string::npos) {
+        key.find('\n') != ScratchString::npos) {
       YAML_THROW_POS(source, "Implicit quoted keys must be on a single line.");
     }
     if (key[0] == kLeftCurlyBrace || key[0] == kLeftSquareBracket) {
-      if (key.find('\n') != std::string::npos) {
+      if (key.find('\n') != ScratchString::npos) {
         if (key[0] == kLeftCurlyBrace) {
           YAML_THROW_POS(source, "Inline dictionary used as key is meant to be on one line.");
         }
@@ -114,7 +162,7 @@ bool Default_Parser::isArray(ISource &source) {
 /// <returns>If true, a boolean value has been found.</returns>
 bool Default_Parser::isBoolean(ISource &source) {
   const auto ch = source.current();
-  if (strictBooleans || ctx_.yamlDirectiveMinor >= 2) {
+  if (strictBooleanMode()) {
     // YAML 1.2 strict: only 'true' and 'false'
     return ch == 't' || ch == 'f';
   }
@@ -260,7 +308,7 @@ bool Default_Parser::isDictionary(ISource &source) {
     source.next();
     const Delimiters aliasStop{kLineFeed, kSpace, kComma, kRightSquareBracket,
                                kRightCurlyBrace};
-    const std::string aliasName = extractToNext(source, aliasStop);
+    const ScratchString aliasName = extractToNext(source, aliasStop);
     if (!aliasName.empty() && aliasName.back() == kColon &&
         ctx_.yamlAliasMap.count(aliasName)) {
       return false;
@@ -10,26 +10,244 @@
 
 namespace YAML_Lib {
 
-void Default_Parser::convertOctalToDecimal(std::string &numeric,
-                                           const std::string &digits) {
-  try {
-    std::size_t end = 0;
-    const long long val = std::stoll(digits, &end, 8);
-    if (end == digits.size()) {
-      numeric = std::to_string(val);
-    } else {
-      numeric.clear();
-    }
-  } catch (...) {
+/// <summary>
+/// Replace numeric with the decimal form of octal digits, or clear it if
+/// they are not a valid (in range) octal number. Leading white space and a
+/// '+' sign are accepted as std::stoll would, without its exceptions.
+/// </summary>
+/// <param name="numeric">Number token (result).</param>
+/// <param name="digits">Octal digits.</param>
+void Default_Parser::convertOctalToDecimal(ScratchString &numeric,
+                                           const ScratchString &digits) {
+  std::string_view octal{digits};
+  while (!octal.empty() && std::isspace(static_cast<unsigned char>(octal.front()))) {
+    octal.remove_prefix(1);
+  }
+  if (octal.size() > 1 && octal[0] == '+' && octal[1] != '-') {
+    octal.remove_prefix(1);
+  }
+  long long value{};
+  if (const auto [end, error] =
+          std::from_chars(octal.data(), octal.data() + octal.size(), value, 8);
+      error == std::errc{} && end == octal.data() + octal.size()) {
+    numeric = std::to_string(value);
+  } else {
     numeric.clear();
   }
 }
 
 /// <summary>
-/// Parse a numeric value on source stream.
+/// Convert a numeric token to a Number.
 /// Supports standard integers/floats, YAML 1.2 hex (0x), octal (0o),
 /// and special float values .inf, -.inf, .nan (case-insensitive).
 /// </summary>
+/// <param name="numeric">Right-trimmed token.</param>
+/// <returns>Number Node (empty if the token is not a number).</returns>
+Node Default_Parser::numberFromToken(ScratchString numeric) {
+  // YAML 1.2 special float literals (case-insensitive).
+  // Only tokens starting with '.', '+', or '-' can be .inf/+.inf/-.inf/.nan.
+  if (!numeric.empty() &&
+      (numeric[0] == '.' || numeric[0] == '+' || numeric[0] == '-')) {
+    ScratchString lower = numeric;
+    std::transform(
+        lower.begin(), lower.end(), lower.begin(),
+        [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    if (lower == ".inf" || lower == "+.inf") {
+      return Node::make<Number>(std::numeric_limits<double>::infinity());
+    } else if (lower == "-.inf") {
+      return Node::make<Number>(-std::numeric_limits<double>::infinity());
+    } else if (lower == ".nan") {
+      return Node::make<Number>(std::numeric_limits<double>::quiet_NaN());
+    }
+  }
+  // YAML 1.2 octal "0o<digits>" (or "0O<digits>"): convert the octal digits
+  // to their decimal string equivalent so that Number parses them as base 10.
+  // This avoids relying on C-style "0NNN" leading-zero octal interpretation.
+  if (numeric.size() >= 3 && numeric[0] == '0' &&
+      (numeric[1] == 'o' || numeric[1] == 'O')) {
+    const ScratchString octalDigits = numeric.substr(2);
+    convertOctalToDecimal(numeric, octalDigits);
+  } else if (ctx_.yamlDirectiveMinor == 1 && numeric.size() >= 2 &&
+             numeric[0] == '0' &&
+             std::all_of(
+                 numeric.begin() + 1, numeric.end(),
+                 [](unsigned char c) { return c >= '0' && c <= '7'; })) {
+    // YAML 1.1: C-style octal "0NNN" (leading zero, digits 0-7 only)
+    convertOctalToDecimal(numeric, numeric);
+  }
+  if (!numeric.empty()) {
+    if (Number number{numeric}; number.is<int>() || number.is<long>() ||
+                                number.is<long long>() ||
+                                number.is<float>() || number.is<double>() ||
+                                number.is<long double>()) {
+      return Node::make<Number>(number);
+    }
+  }
+  return {};
+}
+/// <summary>
+/// Convert a null token ("null" or "~") to a Null.
+/// </summary>
+/// <param name="token">Right-trimmed token.</param>
+/// <returns>Null Node (empty if the token is not null).</returns>
+Node Default_Parser::noneFromToken(const ScratchString &token) {
+  if (token == "null" || token == "~")
+    return Node::make<Null>();
+  return {};
+}
+/// <summary>
+/// Convert a boolean token to a Boolean. Only true/false are accepted under
+/// strict booleans or a %YAML 1.2 directive, otherwise the YAML 1.1 words.
+/// </summary>
+/// <param name="token">Right-trimmed token.</param>
+/// <returns>Boolean Node (empty if the token is not a boolean).</returns>
+Node Default_Parser::booleanFromToken(const ScratchString &token) {
+  static const std::set<std::string_view> strict12True{"true"};
+  static const std::set<std::string_view> strict12False{"false"};
+  const bool strictMode = strictBooleanMode();
+  const auto &trueSet = strictMode ? strict12True : Boolean::isTrue;
+  const auto &falseSet = strictMode ? strict12False : Boolean::isFalse;
+  if (trueSet.contains(token))
+    return Node::make<Boolean>(true, token);
+  if (falseSet.contains(token))
+    return Node::make<Boolean>(false, token);
+  return {};
+}
+/// <summary>
+/// Parse a flow collection element directly from a contiguous source in
+/// one pass, without routing it through parseDocument's productions:
+/// <list type="bullet">
+/// <item>a number, boolean or null token, or a quoted scalar with no
+/// escapes, on one line and followed (after spaces) by ',' or the closing
+/// bracket, is converted in place (the productions would only reach
+/// parseNumber, parseBoolean, parseNone or parseQuotedFlowString after
+/// ruling out a key);</item>
+/// <item>a nested '[...]' or '{...}' that is not followed by ':' goes
+/// straight to parseInlineArray or parseInlineDictionary, its closing bracket
+/// located in the buffer (with extractInLine's matching rule) instead of
+/// copied out by the isKey lookahead.</item>
+/// </list>
+/// Anything else is left untouched for parseDocument.
+/// </summary>
+/// <param name="source">Source stream (just past '[', ',' or ': ').</param>
+/// <param name="delimiters">Delimiters used to parse the element.</param>
+/// <param name="indentation">Parent indentation.</param>
+/// <param name="close">Closing bracket of the enclosing flow collection.</param>
+/// <returns>Element Node (empty if it needs the full parser).</returns>
+Node Default_Parser::parseFlowElement(ISource &source,
+                                      const Delimiters &delimiters,
+                                      const unsigned long indentation,
+                                      const char close) {
+  // The depth limit error is parseDocument's to report.
+  if (maxParseDepth != 0 &&
+      static_cast<unsigned long>(parseDepth) + 1 > maxParseDepth) {
+    return {};
+  }
+  const std::string_view rest{source.remaining()};
+  std::size_t start = 0;
+  while (start < rest.size() && rest[start] == kSpace) {
+    ++start;
+  }
+  if (start == rest.size()) {
+    return {};
+  }
+  const char first = rest[start];
+  std::size_t end = start + 1;
+  if (first == kLeftSquareBracket || first == kLeftCurlyBrace) {
+    const char last =
+        first == kLeftCurlyBrace ? kRightCurlyBrace : kRightSquareBracket;
+    for (unsigned long depth{1}; depth > 0; ++end) {
+      if (end == rest.size() ||
+          (static_cast<unsigned char>(rest[end]) < kSpace &&
+           rest[end] != '\t' && rest[end] != kLineFeed) ||
+          rest[end] == '\x7f') {
+        return {};
+      }
+      if (rest[end] == first) {
+        depth++;
+      } else if (rest[end] == last) {
+        depth--;
+      }
+    }
+    while (end < rest.size() && (rest[end] == kSpace || rest[end] == '\t')) {
+      ++end;
+    }
+    if (end == rest.size() || rest[end] == kColon) {
+      return {};
+    }
+    source.skip(start);
+    Node collection;
+    {
+      DepthGuard depthGuard(parseDepth, maxParseDepth);
+      collection = first == kLeftCurlyBrace
+                       ? parseInlineDictionary(source, delimiters, indentation)
+                       : parseInlineArray(source, delimiters, indentation);
+    }
+    moveToNextIndent(source);
+#ifdef YAML_LIB_PROFILE
+    profile_.flowElements++;
+#endif
+    return collection;
+  }
+  if (first == kDoubleQuote || first == kApostrophe) {
+    while (end < rest.size() && rest[end] != first &&
+           static_cast<unsigned char>(rest[end]) >= kSpace &&
+           rest[end] != '\x7f' &&
+           (first == kApostrophe || rest[end] != '\\')) {
+      ++end;
+    }
+    if (end == rest.size() || rest[end] != first ||
+        (first == kApostrophe && end + 1 < rest.size() &&
+         rest[end + 1] == kApostrophe)) {
+      return {};
+    }
+    ++end;
+  } else {
+    while (end < rest.size() &&
+           (std::isalnum(static_cast<unsigned char>(rest[end])) != 0 ||
+            rest[end] == '.' || rest[end] == '+' || rest[end] == '-')) {
+      ++end;
+    }
+  }
+  std::size_t next = end;
+  while (next < rest.size() && rest[next] == kSpace) {
+    ++next;
+  }
+  if (next == rest.size() || (rest[next] != kComma && rest[next] != close)) {
+    return {};
+  }
+  Node scalar;
+  if (first == kDoubleQuote) {
+    scalar = Node::make<String>(
+        translateEscapes(rest.substr(start + 1, end - start - 2)), first);
+  } else if (first == kApostrophe) {
+    scalar = Node::make<String>(
+        ScratchString(rest.substr(start + 1, end - start - 2)), first);
+  } else if (const ScratchString token{rest.substr(start, end - start)};
+             std::isdigit(static_cast<unsigned char>(first)) != 0 ||
+             ((first == '-' || first == '+') && token.size() > 1 &&
+              std::isdigit(static_cast<unsigned char>(token[1])) != 0)) {
+    if (!looksLikeIso8601Date(token)) {
+      scalar = numberFromToken(token);
+    }
+  } else if (std::isalpha(static_cast<unsigned char>(first)) != 0 ||
+             token == "~") {
+    scalar = booleanFromToken(token);
+    if (scalar.isEmpty()) {
+      scalar = noneFromToken(token);
+    }
+  }
+  if (!scalar.isEmpty()) {
+    source.skip(next);
+#ifdef YAML_LIB_PROFILE
+    profile_.flowElements++;
+#endif
+  }
+  return scalar;
+}
+/// <summary>
+/// Parse a numeric value on source stream.
+/// </summary>
 /// <param name="source">Source stream.</param>
 /// <param name="delimiters">Delimiters used to parse number./param>
 /// <param name="indentation">Parent indentation.</param>
@@ -37,48 +255,9 @@ void Default_Parser::convertOctalToDecimal(std::string &numeric,
 Node Default_Parser::parseNumber(ISource &source, const Delimiters &delimiters,
                                  [[maybe_unused]] unsigned long indentation) {
   return tryParseToken(source, delimiters, indentation,
-                       [this](std::string numeric) -> Node {
-    // YAML 1.2 special float literals (case-insensitive).
-    // Only tokens starting with '.', '+', or '-' can be .inf/+.inf/-.inf/.nan.
-    if (!numeric.empty() &&
-        (numeric[0] == '.' || numeric[0] == '+' || numeric[0] == '-')) {
-      std::string lower = numeric;
-      std::transform(
-          lower.begin(), lower.end(), lower.begin(),
-          [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
-      if (lower == ".inf" || lower == "+.inf") {
-        return Node::make<Number>(std::numeric_limits<double>::infinity());
-      } else if (lower == "-.inf") {
-        return Node::make<Number>(-std::numeric_limits<double>::infinity());
-      } else if (lower == ".nan") {
-        return Node::make<Number>(std::numeric_limits<double>::quiet_NaN());
-      }
-    }
-    // YAML 1.2 octal "0o<digits>" (or "0O<digits>"): convert the octal digits
-    // to their decimal string equivalent so that Number parses them as base 10.
-    // This avoids relying on C-style "0NNN" leading-zero octal interpretation.
-    if (numeric.size() >= 3 && numeric[0] == '0' &&
-        (numeric[1] == 'o' || numeric[1] == 'O')) {
-      const std::string octalDigits = numeric.substr(2);
-      convertOctalToDecimal(numeric, octalDigits);
-    } else if (ctx_.yamlDirectiveMinor == 1 && numeric.size() >= 2 &&
-               numeric[0] == '0' &&
-               std::all_of(
-                   numeric.begin() + 1, numeric.end(),
-                   [](unsigned char c) { return c >= '0' && c <= '7'; })) {
-      // YAML 1.1: C-style octal "0NNN" (leading zero, digits 0-7 only)
-      convertOctalToDecimal(numeric, numeric);
-    }
-    if (!numeric.empty()) {
-      if (Number number{numeric}; number.is<int>() || number.is<long>() ||
-                                  number.is<long long>() ||
-                                  number.is<float>() || number.is<double>() ||
-                                  number.is<long double>()) {
-        return Node::make<Number>(number);
-      }
-    }
-    return {};
-  });
+                       [this](const ScratchString &token) {
+                         return numberFromToken(token);
+                       });
 }
 /// <summary>
 /// Parse None/Null on source stream.
@@ -90,11 +269,9 @@ Node Default_Parser::parseNumber(ISource &source, const Delimiters &delimiters,
 Node Default_Parser::parseNone(ISource &source, const Delimiters &delimiters,
                                [[maybe_unused]] unsigned long indentation) {
   return tryParseToken(source, delimiters, indentation,
-                       [](const std::string &tok) -> Node {
-    if (tok == "null" || tok == "~")
-      return Node::make<Null>();
-    return {};
-  });
+                       [this](const ScratchString &token) {
+                         return noneFromToken(token);
+                       });
 }
 /// <summary>
 /// Parse boolean value on source stream.
@@ -105,19 +282,10 @@ Node Default_Parser::parseNone(ISource &source, const Delimiters &delimiters,
 /// <returns>Boolean Node.</returns>
 Node Default_Parser::parseBoolean(ISource &source, const Delimiters &delimiters,
                                   [[maybe_unused]] unsigned long indentation) {
-  static const std::set<std::string_view> strict12True{"true"};
-  static const std::set<std::string_view> strict12False{"false"};
   return tryParseToken(source, delimiters, indentation,
-                       [&](const std::string &tok) -> Node {
-    const bool strictMode = strictBooleans || ctx_.yamlDirectiveMinor >= 2;
-    const auto &trueSet = strictMode ? strict12True : Boolean::isTrue;
-    const auto &falseSet = strictMode ? strict12False : Boolean::isFalse;
-    if (trueSet.contains(tok))
-      return Node::make<Boolean>(true, tok);
-    if (falseSet.contains(tok))
-      return Node::make<Boolean>(false, tok);
-    return {};
-  });
+                       [this](const ScratchString &token) {
+                         return booleanFromToken(token);
+                       });
 }
 
 bool Default_Parser::hasPlainScalarContinuation(ISource &source,
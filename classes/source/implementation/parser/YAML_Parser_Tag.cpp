@@ -35,8 +35,8 @@ Node Default_Parser::parseTagged(ISource &source, const Delimiters &delimiters,
   // Consume first '!'
   source.next();
   bool isVerbatim = false;
-  std::string tagHandle;
-  std::string tagSuffix;
+  ScratchString tagHandle;
+  ScratchString tagSuffix;
 
   if (!source.more()) {
     YAML_THROW_POS(source, "Incomplete tag.");
@@ -61,7 +61,7 @@ Node Default_Parser::parseTagged(ISource &source, const Delimiters &delimiters,
   } else {
     // Could be primary !suffix or named handle !ns!suffix.
     // Scan ahead: if we find a second '!' before space/LF it is a named handle.
-    std::string preExcl;
+    ScratchString preExcl;
     preExcl = extractToNext(source, {'!', kSpace, kLineFeed});
     if (source.more() && source.current() == '!') {
       source.next(); // consume second '!'
@@ -100,17 +100,17 @@ Node Default_Parser::parseTagged(ISource &source, const Delimiters &delimiters,
   // malformed; reject by throwing.
   static constexpr std::string_view kInvalidTagChars{",[]{}"};
   if (!tagSuffix.empty() &&
-      tagSuffix.find_first_of(kInvalidTagChars) != std::string::npos) {
+      tagSuffix.find_first_of(kInvalidTagChars) != ScratchString::npos) {
     YAML_THROW_POS(source, "Invalid character in tag suffix '" + tagSuffix + "'.");
   }
 
   // Build full tag name
-  std::string fullTag;
+  ScratchString fullTag;
   if (isVerbatim) {
     fullTag = "!<" + tagHandle + ">";
   } else if (tagHandle == "!!") {
     // Expand using registered prefix or default yaml.org
-    const std::string defaultPrefix{"tag:yaml.org,2002:"};
+    const ScratchString defaultPrefix{"tag:yaml.org,2002:"};
     auto it = ctx_.yamlTagPrefixes.find("!!");
     fullTag =
         (it != ctx_.yamlTagPrefixes.end() ? it->second : defaultPrefix) + tagSuffix;
@@ -128,7 +128,7 @@ Node Default_Parser::parseTagged(ISource &source, const Delimiters &delimiters,
 
   // Standard YAML core schema tags cause type coercion
   // Helper: extract the raw scalar value (unquoting if quoted) as a string.
-  auto extractRawScalar = [&]() -> std::string {
+  auto extractRawScalar = [&]() -> ScratchString {
     if (isQuotedString(source)) {
       return extractRawQuotedScalar(source);
     }
@@ -136,9 +136,9 @@ Node Default_Parser::parseTagged(ISource &source, const Delimiters &delimiters,
   };
 
   Node result;
-  static const std::string kCoreTagPrefix{"tag:yaml.org,2002:"};
-  static const std::unordered_set<std::string> passthroughTags{"seq", "map",
-                                                               "omap", "pairs"};
+  static constexpr std::string_view kCoreTagPrefix{"tag:yaml.org,2002:"};
+  static const std::unordered_set<std::string_view> passthroughTags{
+      "seq", "map", "omap", "pairs"};
   const auto valueRequiresNodeParse = [&]() {
     return valueStartsOnNextLine ||
            (source.more() &&
@@ -150,7 +150,7 @@ Node Default_Parser::parseTagged(ISource &source, const Delimiters &delimiters,
       fullTag.size() == kCoreTagPrefix.size() + tagSuffix.size();
   if (isCoreSecondaryTag && !tagSuffix.empty()) {
     if (tagSuffix == "str") {
-      std::string value;
+      ScratchString value;
       const bool needsNodeParse = valueRequiresNodeParse();
       if (isEmptyScalar) {
         value = "";
@@ -170,41 +170,35 @@ Node Default_Parser::parseTagged(ISource &source, const Delimiters &delimiters,
       result = Node::make<String>(value, kNull);
     } else if (tagSuffix == "int" || tagSuffix == "float" ||
                tagSuffix == "bool" || tagSuffix == "null") {
-      // Dispatch table for the four core type-coercion tags.
-      using CoerceFunc =
-          std::function<Node(ISource &, const Delimiters &, unsigned long)>;
-      const std::unordered_map<std::string, std::pair<CoerceFunc, const char *>>
-          coercions{
-              {"int",
-               {[this](ISource &s, const Delimiters &d, unsigned long i) {
-                  return parseNumber(s, d, i);
-                },
-                "!!int"}},
-              {"float",
-               {[this](ISource &s, const Delimiters &d, unsigned long i) {
-                  return parseNumber(s, d, i);
-                },
-                "!!float"}},
-              {"bool",
-               {[this](ISource &s, const Delimiters &d, unsigned long i) {
-                  return parseBoolean(s, d, i);
-                },
-                "!!bool"}},
-              {"null",
-               {[this](ISource &s, const Delimiters &d, unsigned long i) {
-                  return parseNone(s, d, i);
-                },
-                "!!null"}}};
-      const auto &[fn, tagName] = coercions.at(tagSuffix);
+      // Coerce a token with the scalar parser's own conversion, and text
+      // already in hand (a quoted value or a parsed node) directly when it is
+      // a single line; only multi-line text goes back through a buffer.
+      const auto coerceToken = [&](const ScratchString &token) -> Node {
+        if (tagSuffix == "bool") {
+          return booleanFromToken(token);
+        }
+        if (tagSuffix == "null") {
+          return noneFromToken(token);
+        }
+        return numberFromToken(token);
+      };
+      const auto coerceText = [&](const std::string_view raw) -> Node {
+        ScratchString text{raw};
+        if (text.find_first_of("\r\n") == ScratchString::npos) {
+          rightTrim(text);
+          return coerceToken(text);
+        }
+        text += kLineFeed;
+        BufferSource bs{text};
+        return tryParseToken(bs, {kLineFeed}, indentation, coerceToken);
+      };
       const bool needsNodeParse = valueRequiresNodeParse();
       if (isEmptyScalar && tagSuffix == "null") {
         result = Node::make<Null>();
       } else if (!needsNodeParse && isQuotedString(source)) {
-        const std::string raw = extractRawScalar();
-        BufferSource bs{raw + "\n"};
-        result = fn(bs, {kLineFeed}, indentation);
+        result = coerceText(extractRawScalar());
       } else if (!needsNodeParse) {
-        result = fn(source, delimiters, indentation);
+        result = tryParseToken(source, delimiters, indentation, coerceToken);
       } else {
         Node parsed = parseDocument(source, delimiters, indentation);
         if (isA<Number>(parsed) &&
@@ -215,13 +209,11 @@ Node Default_Parser::parseTagged(ISource &source, const Delimiters &delimiters,
         } else if (isA<Null>(parsed) && tagSuffix == "null") {
           result = std::move(parsed);
         } else {
-          const std::string raw = parsed.toString();
-          BufferSource bs{raw + "\n"};
-          result = fn(bs, {kLineFeed}, indentation);
+          result = coerceText(parsed.toString());
         }
       }
       if (result.isEmpty()) {
-        YAML_THROW_POS(source, std::string("Value cannot be parsed as ") + tagName +
+        YAML_THROW_POS(source, "Value cannot be parsed as !!" + tagSuffix +
                               ".");
       }
     } else if (passthroughTags.count(tagSuffix)) {
@@ -230,7 +222,7 @@ Node Default_Parser::parseTagged(ISource &source, const Delimiters &delimiters,
       // Try to parse as a native timestamp; fall back to string
       result = parseTimestamp(source, delimiters, indentation);
       if (result.isEmpty()) {
-        std::string value{extractTrimmed(source, delimiters)};
+        ScratchString value{extractTrimmed(source, delimiters)};
         result = Node::make<String>(value, kNull);
       }
     } else if (tagSuffix == "binary") {
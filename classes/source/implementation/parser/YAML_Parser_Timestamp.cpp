@@ -15,7 +15,7 @@ namespace YAML_Lib {
 /// Return true if the first 10 characters of s match the ISO 8601 date prefix
 /// YYYY-MM-DD (4 digits, '-', 2 digits, '-', 2 digits).
 /// </summary>
-bool Default_Parser::looksLikeIso8601Date(const std::string &s) {
+bool Default_Parser::looksLikeIso8601Date(const ScratchString &s) {
   if (s.size() < 10) return false;
   const auto dig = [&](int i) {
     return std::isdigit(static_cast<unsigned char>(s[i])) != 0;
@@ -35,7 +35,7 @@ bool Default_Parser::isTimestamp(ISource &source) {
   SourceGuard guard(source);
   bool result = false;
   // Read up to 10 chars to check the DDDD-DD-DD pattern
-  std::string sample;
+  ScratchString sample;
   sample.reserve(11);
   int i = 0;
   while (source.more() && i < 10) {
@@ -68,7 +68,7 @@ Node Default_Parser::parseTimestamp(
     [[maybe_unused]] unsigned long indentation) {
 #ifdef YAML_LIB_TIMESTAMP_PARSE
   return tryParseToken(source, delimiters, indentation,
-                       [this](const std::string &tok) -> Node {
+                       [this](const ScratchString &tok) -> Node {
     if (looksLikeIso8601Date(tok))
       return Node::make<Timestamp>(tok);
     return {};
@@ -80,7 +80,7 @@ Node Default_Parser::parseTimestamp(
   // force.
   const unsigned long tokenIndent = source.getPosition().second;
   SourceGuard guard(source);
-  std::string token{extractToNext(source, delimiters)};
+  ScratchString token{extractToNext(source, delimiters)};
   rightTrim(token);
   if (source.more() && source.current() == kLineFeed &&
       hasPlainScalarContinuation(source, tokenIndent)) {
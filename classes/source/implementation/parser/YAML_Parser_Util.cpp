@@ -30,7 +30,7 @@ bool Default_Parser::endsWith(const std::string_view &str,
 /// Remove any spaces at the end of str.
 /// </summary>
 /// <param name="str">Target string.</param>
-void Default_Parser::rightTrim(std::string &str) {
+void Default_Parser::rightTrim(ScratchString &str) {
   str.erase(
       std::find_if(str.rbegin(), str.rend(),
                    [](const unsigned char ch) { return !std::isspace(ch); })
@@ -132,18 +132,18 @@ void Default_Parser::moveToNextIndent(ISource &source) {
 /// <param name="source">Source stream.</param>
 /// <returns>Extracted characters (uses source.current() as the quote
 /// character).</returns>
-std::string Default_Parser::extractString(ISource &source) {
+ScratchString Default_Parser::extractString(ISource &source) {
   return extractString(source, source.current());
 }
-std::string Default_Parser::extractString(ISource &source, const char quote) {
+ScratchString Default_Parser::extractString(ISource &source, const char quote) {
   return extractString(source, quote, nullptr);
 }
-std::string Default_Parser::extractString(ISource &source, const char quote,
+ScratchString Default_Parser::extractString(ISource &source, const char quote,
                                           unsigned long *quoteColumn) {
   if (quoteColumn) {
     *quoteColumn = source.getPosition().second;
   }
-  std::string extracted{quote};
+  ScratchString extracted{quote};
   source.next(); // skip opening quote
   bool foundClosing = false;
   while (source.more()) {
@@ -187,8 +187,8 @@ std::string Default_Parser::extractString(ISource &source, const char quote,
 /// </summary>
 /// <param name="source">Source stream.</param>
 /// <returns>Unquoted, right-trimmed scalar value.</returns>
-std::string Default_Parser::extractRawQuotedScalar(ISource &source) {
-  std::string raw = extractString(source);
+ScratchString Default_Parser::extractRawQuotedScalar(ISource &source) {
+  ScratchString raw = extractString(source);
   if (raw.size() >= 2) {
     raw = raw.substr(1, raw.size() - 2);
   }
@@ -208,19 +208,18 @@ std::string Default_Parser::extractRawQuotedScalar(ISource &source) {
 /// </summary>
 /// <param name="source">Source stream.</param>
 /// <returns>Extracted tag suffix string.</returns>
-std::string Default_Parser::extractTagSuffix(ISource &source) {
+ScratchString Default_Parser::extractTagSuffix(ISource &source) {
   if (isInsideFlowContext()) {
     return extractToNext(source, {kSpace, kLineFeed, ',', ']', '}'});
   }
   return extractToNext(source, {kSpace, kLineFeed});
 }
-std::string Default_Parser::extractToNext(ISource &source,
+ScratchString Default_Parser::extractToNext(ISource &source,
                                           const Delimiters &delimiters) {
-  std::string extracted;
+  ScratchString extracted;
   if (!delimiters.empty()) {
-    while (source.more() && !delimiters.contains(source.current())) {
-      extracted += source.append();
-    }
+    source.appendUntil(extracted,
+                       [&](const char ch) { return delimiters.contains(ch); });
   }
   return extracted;
 }
@@ -230,9 +229,9 @@ std::string Default_Parser::extractToNext(ISource &source,
 /// <param name="source">Source stream.</param>
 /// <param name="delimiters">Delimiter set.</param>
 /// <returns>Extracted and right-trimmed string.</returns>
-std::string Default_Parser::extractTrimmed(ISource &source,
+ScratchString Default_Parser::extractTrimmed(ISource &source,
                                            const Delimiters &delimiters) {
-  std::string s{extractToNext(source, delimiters)};
+  ScratchString s{extractToNext(source, delimiters)};
   rightTrim(s);
   return s;
 }
@@ -243,9 +242,9 @@ std::string Default_Parser::extractTrimmed(ISource &source,
 /// <param name="start">Start character.</param>
 /// <param name="end">End character.</param>
 /// <returns>Extracted characters.</returns>
-std::string Default_Parser::extractInLine(ISource &source, const char start,
+ScratchString Default_Parser::extractInLine(ISource &source, const char start,
                                           const char end) {
-  std::string extracted;
+  ScratchString extracted;
   unsigned long depth{1};
   extracted += start;
   source.next();
@@ -268,7 +267,7 @@ std::string Default_Parser::extractInLine(ISource &source, const char start,
 /// <param name="end">End character.</param>
 void Default_Parser::checkForEnd(ISource &source, const char end) {
   if (source.current() != end) {
-    YAML_THROW_POS(source, std::string("Missing closing ") + end + ".");
+    YAML_THROW_POS(source, ScratchString("Missing closing ") + end + ".");
   }
   source.next();
 }
@@ -279,9 +278,13 @@ void Default_Parser::checkForEnd(ISource &source, const char end) {
 /// <param name="delimiters">Delimiters used to parse the document.</param>
 /// <param name="indentation">Parent indentation.</param>
 /// <returns>Parsed Node.</returns>
-Node Default_Parser::parseFromBuffer(const std::string &text,
+Node Default_Parser::parseFromBuffer(const ScratchString &text,
                                      const Delimiters &delimiters,
                                      const unsigned long indentation) {
+#ifdef YAML_LIB_PROFILE
+  profile_.reparses++;
+  profile_.reparseBytes += text.size();
+#endif
   BufferSource src{text}; // string_view into text — no copy; text outlives src
   return parseDocument(src, delimiters, indentation);
 }
@@ -292,16 +295,17 @@ Node Default_Parser::parseFromBuffer(const std::string &text,
 /// <param name="source">Source stream.</param>
 /// <param name="minIndent">Minimum column for inclusion.</param>
 /// <returns>Captured block text.</returns>
-std::string
+ScratchString
 Default_Parser::captureIndentedBlock(ISource &source,
                                      const unsigned long minIndent) {
-  std::string text;
+  ScratchString text;
   while (source.more() && source.getPosition().second >= minIndent) {
     if (isDocumentBoundary(source)) {
       break;
     }
-    const std::string indent(source.getPosition().second, kSpace);
-    text += indent + extractToNext(source, {kLineFeed}) + "\n";
+    text.append(source.getPosition().second, kSpace);
+    source.appendUntil(text, [](const char ch) { return ch == kLineFeed; });
+    text += kLineFeed;
     moveToNextIndent(source);
   }
   return text;
@@ -314,7 +318,7 @@ Default_Parser::captureIndentedBlock(ISource &source,
 /// <param name="dict">Target dictionary.</param>
 /// <param name="key">Key string.</param>
 /// <param name="value">Value node (moved in).</param>
-void Default_Parser::upsertDictEntry(Dictionary &dict, const std::string &key,
+void Default_Parser::upsertDictEntry(Dictionary &dict, const ScratchString &key,
                                      Node value) {
   if (dict.contains(key)) {
     dict[key] = std::move(value);
@@ -332,7 +336,7 @@ void Default_Parser::checkFlowDelimiter(ISource &source,
                                         const Delimiters &delimiters) {
   if (source.more() && !delimiters.contains(source.current())) {
     YAML_THROW(SyntaxError, "Unexpected flow sequence token '" +
-                      std::string(1, source.current()) + "'.");
+                      ScratchString(1, source.current()) + "'.");
   }
 }
 /// <summary>
@@ -375,12 +379,14 @@ Default_Parser::withExtras(const Delimiters &base,
 /// Return the delimiter set that terminates plain-scalar key extraction,
 /// taking the current flow context into account.
 /// In block context only ':' and '\n' stop extraction; inside a flow
-/// collection '{', '}', and ',' are also stop characters.
+/// collection ',', '}' and ']' are also stop characters (so a key probe on
+/// "[1, {a: b}]" cannot run on into a later entry).
 /// </summary>
 /// <returns>Appropriate Delimiters set for the current parser depth.</returns>
 Default_Parser::Delimiters Default_Parser::keyStopDelimiters() {
-  return ctx_.inlineDictionaryDepth > 0
-             ? Delimiters{kColon, kComma, kRightCurlyBrace, kLineFeed}
+  return isInsideFlowContext()
+             ? Delimiters{kColon, kComma, kRightCurlyBrace, kRightSquareBracket,
+                          kLineFeed}
              : Delimiters{kColon, kLineFeed};
 }
 /// <summary>
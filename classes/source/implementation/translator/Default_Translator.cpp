@@ -4,6 +4,9 @@
 // Description: Translate to/from YAML string escapes within source
 // strings. This is the default translator but is possible to write
 // a custom one and pass it to the YAML class constructor to be used.
+// Runs of characters that need no translation are located (a word at a
+// time when escaping) and copied in bulk; escapes are decoded/encoded
+// straight to/from UTF-8 using constant lookup tables.
 //
 // Dependencies: C++20 - Language standard features used.
 //
@@ -12,195 +15,284 @@
 
 namespace YAML_Lib {
 
-static const std::vector<std::pair<const char, const char>> escapeSequences{
-    {'\\', '\\'},
-    {'t', '\t'},
-    {kDoubleQuote, '\"'},
-    {'b', '\b'},
-    {'f', '\f'},
-    {'n', '\n'},
-    {'r', '\r'},
-    // YAML 1.2 spec additional control-char escape sequences
-    {'a', '\a'},
-    {'v', '\v'},
-    {'e', '\x1b'}};
+// Marks a character that is not a single character escape.
+static constexpr char32_t kNotEscape{0xFFFFFFFF};
+// Marks a character that is not a hex digit.
+static constexpr uint8_t kNotHexDigit{0xFF};
+
+// Character following '\' -> code point it decodes to.
+static constexpr auto fromEscape = [] {
+  std::array<char32_t, 256> table{};
+  table.fill(kNotEscape);
+  table['\\'] = '\\';
+  table['t'] = '\t';
+  table[kDoubleQuote] = '\"';
+  table['b'] = '\b';
+  table['f'] = '\f';
+  table['n'] = '\n';
+  table['r'] = '\r';
+  // YAML 1.2 spec additional control-char escape sequences
+  table['a'] = '\a';
+  table['v'] = '\v';
+  table['e'] = '\x1b';
+  // YAML 1.2 read-only single-char escapes (no output escaping needed)
+  table['0'] = '\0'; // \0 -> null char (rejected when the string is built)
+  table[' '] = ' ';  // \  -> space
+  table['/'] = '/';  // \/ -> slash
+  table['\t'] = '\t'; // \<TAB> -> tab (YAML 1.2 §7.3.2 #x9 alias)
+  // YAML 1.2 multi-byte Unicode escape sequences (bidirectional)
+  table['N'] = 0x0085; // Next Line
+  table['_'] = 0x00A0; // NBSP
+  table['L'] = 0x2028; // Line Separator
+  table['P'] = 0x2029; // Para Separator
+  return table;
+}();
+
+// ASCII character -> character written after '\' (kNull = no short form).
+static constexpr auto toEscape = [] {
+  std::array<char, 128> table{};
+  table['\\'] = '\\';
+  table['\t'] = 't';
+  table[kDoubleQuote] = '\"';
+  table['\b'] = 'b';
+  table['\f'] = 'f';
+  table['\n'] = 'n';
+  table['\r'] = 'r';
+  table['\a'] = 'a';
+  table['\v'] = 'v';
+  table['\x1b'] = 'e';
+  return table;
+}();
+
+// Characters copied to a YAML string as is (printable ASCII bar '"' and '\').
+static constexpr auto isPlain = [] {
+  std::array<bool, 256> table{};
+  for (unsigned character = 0x20; character < 0x7F; ++character) {
+    table[character] = true;
+  }
+  table['\\'] = false;
+  table[kDoubleQuote] = false;
+  return table;
+}();
+
+// Hex digit -> value.
+static constexpr auto hexValue = [] {
+  std::array<uint8_t, 256> table{};
+  table.fill(kNotHexDigit);
+  for (uint8_t digit = 0; digit < 10; ++digit) {
+    table['0' + digit] = digit;
+  }
+  for (uint8_t digit = 0; digit < 6; ++digit) {
+    table['a' + digit] = 10 + digit;
+    table['A' + digit] = 10 + digit;
+  }
+  return table;
+}();
 
 /// <summary>
-/// Convert \Uxxxxxxxx escape sequences (8 hex digits) to a UTF-16 surrogate
-/// pair (for code points above U+FFFF) or single char16_t.
+/// Return true if a code point is an upper (high) UTF-16 surrogate.
 /// </summary>
-/// <param name="current">Current character position.</param>
-/// <param name="numberOfCharacters">Number of characters left in
-/// source.</param> <param name="utf16Buffer">Buffer to append UTF-16 characters
-/// to.</param>
-void decodeUTF32(std::string_view::const_iterator &current,
-                 const ptrdiff_t numberOfCharacters,
-                 std::u16string &utf16Buffer) {
-  if (numberOfCharacters >= 8) {
-    const std::array hexDigits{(current[1]), (current[2]), (current[3]),
-                               (current[4]), (current[5]), (current[6]),
-                               (current[7]), (current[8]), kNull};
-    char *end;
-    const uint32_t codePoint =
-        static_cast<uint32_t>(std::strtoul(hexDigits.data(), &end, 16));
-    if (*end == kNull) {
-      current += hexDigits.size();
-      if (codePoint <= 0xFFFF) {
-        utf16Buffer += static_cast<char16_t>(codePoint);
-      } else if (codePoint <= 0x10FFFF) {
-        // Encode as UTF-16 surrogate pair
-        const uint32_t code = codePoint - 0x10000;
-        utf16Buffer += static_cast<char16_t>(0xD800 + (code >> 10));
-        utf16Buffer += static_cast<char16_t>(0xDC00 + (code & 0x3FF));
-      } else {
-        YAML_THROW(Default_Translator::Error, "Unicode code point out of range.");
-      }
-      return;
-    }
-  }
-  YAML_THROW(Default_Translator::Error, "Syntax error detected.");
+/// <param name="codePoint">Code point.</param>
+/// <returns>true if valid upper surrogate.</returns>
+static bool isValidSurrogateUpper(const char32_t codePoint) {
+  return codePoint >= kHighSurrogatesBegin && codePoint <= kHighSurrogatesEnd;
 }
+/// <summary>
+/// Return true if a code point is a lower (low) UTF-16 surrogate.
+/// </summary>
+/// <param name="codePoint">Code point.</param>
+/// <returns>true if valid lower surrogate.</returns>
+static bool isValidSurrogateLower(const char32_t codePoint) {
+  return codePoint >= kLowSurrogatesBegin && codePoint <= kLowSurrogatesEnd;
+}
+
+// Why decoding an escaped string failed (none when it succeeded).
+enum class DecodeFailure : uint8_t {
+  none,
+  syntax,
+  outOfRange,
+  invalidEscape,
+  prematureEnd,
+  unpairedSurrogate,
+  nullCharacter
+};
 
 /// <summary>
-/// Convert \uxxxx escape sequences in a string to their correct sequence
-///  of UTF-8 characters.
+/// Decode the fixed number of hex digits following an 'x', 'u' or 'U'
+/// escape character.
 /// </summary>
-/// <param name="current">Current character position.</param>
-/// <param name="numberOfCharacters">Number of characters left in source
-/// string.</param> <returns>UTF16 character for "\uxxxx".</returns>
-char16_t decodeUTF16(std::string_view::const_iterator &current,
-                     const ptrdiff_t numberOfCharacters) {
-  if (numberOfCharacters >= 4) {
-    char16_t utf16value{};
-    // Hex digits will be ascii so can throw away high order byte of char
-    const std::array hexDigits{(current[1]), (current[2]), (current[3]),
-                               (current[4]), kNull};
-    char *end;
-    utf16value +=
-        static_cast<char16_t>(std::strtol(hexDigits.data(), &end, 16));
-    if (*end == kNull) {
-      current += hexDigits.size();
-      return utf16value;
+/// <param name="escapedString">String being translated.</param>
+/// <param name="current">Position of escape character; moved past the
+/// digits.</param>
+/// <param name="numberOfDigits">Number of hex digits expected.</param>
+/// <param name="value">Value of hex digits.</param>
+/// <returns>DecodeFailure::none or why the digits are invalid.</returns>
+static DecodeFailure decodeHex(const std::string_view &escapedString,
+                               std::size_t &current,
+                               const std::size_t numberOfDigits,
+                               char32_t &value) {
+  if (escapedString.size() - current <= numberOfDigits) {
+    return DecodeFailure::syntax;
+  }
+  value = 0;
+  for (std::size_t digit = 1; digit <= numberOfDigits; ++digit) {
+    const auto nibble =
+        hexValue[static_cast<unsigned char>(escapedString[current + digit])];
+    if (nibble == kNotHexDigit) {
+      return DecodeFailure::syntax;
     }
+    value = value << 4 | nibble;
   }
-  YAML_THROW(Default_Translator::Error, "Syntax error detected.");
+  current += numberOfDigits + 1;
+  return DecodeFailure::none;
 }
+
 /// <summary>
-/// Convert "\x00" escape sequences in a string to their correct sequence
-/// of UTF-8 characters.
+/// Decode the escape sequence starting at current (just past its '\').
+/// \uxxxx and \Uxxxxxxxx may yield a single UTF-16 surrogate which the
+/// caller pairs up.
 /// </summary>
-/// <param name="current">Current character position.</param>
-/// <param name="numberOfCharacters">Number of characters left in source
-/// string.</param> <returns>UTF16 character for ""\x00"".</returns>
-char16_t decodeUTF8(std::string_view::const_iterator &current,
-                    const ptrdiff_t numberOfCharacters) {
-  if (numberOfCharacters >= 3) {
-    char16_t utf16value{};
-    // Hex digits will be ascii so can throw away high order byte of char
-    const std::array hexDigits{(current[1]), (current[2]), kNull};
-    char *end;
-    utf16value +=
-        static_cast<char16_t>(std::strtol(hexDigits.data(), &end, 16));
-    if (*end == kNull) {
-      current += hexDigits.size();
-      return utf16value;
+/// <param name="escapedString">String being translated.</param>
+/// <param name="current">Position of escape character; moved past the
+/// sequence.</param>
+/// <param name="codePoint">Code point of escape sequence.</param>
+/// <returns>DecodeFailure::none or why the sequence is invalid.</returns>
+static DecodeFailure decodeEscape(const std::string_view &escapedString,
+                                  std::size_t &current, char32_t &codePoint) {
+  const auto escape = static_cast<unsigned char>(escapedString[current]);
+  // Single character
+  if (fromEscape[escape] != kNotEscape) {
+    ++current;
+    codePoint = fromEscape[escape];
+    return DecodeFailure::none;
+  }
+  // UTF16 "\uxxxx"
+  if (escape == 'u') {
+    return decodeHex(escapedString, current, 4, codePoint);
+  }
+  // UTF32 "\Uxxxxxxxx"
+  if (escape == 'U') {
+    if (const auto failure = decodeHex(escapedString, current, 8, codePoint);
+        failure != DecodeFailure::none) {
+      return failure;
     }
+    return codePoint > 0x10FFFF ? DecodeFailure::outOfRange
+                                : DecodeFailure::none;
   }
-  YAML_THROW(Default_Translator::Error, "Syntax error detected.");
+  // UTF8 "\x00"
+  if (escape == 'x') {
+    return decodeHex(escapedString, current, 2, codePoint);
+  }
+  // Invalid escaped character — only the sequences listed in YAML 1.2
+  // §7.3.1 are valid; anything else (e.g. \. or \%) must be rejected.
+  return DecodeFailure::invalidEscape;
 }
 
 /// <summary>
-/// Convert UTF16 character into its \uxxxx encoded escape sequence.
+/// Append UTF16 character as its \uxxxx encoded escape sequence.
 /// </summary>
+/// <param name="escapedString">Buffer to append to.</param>
 /// <param name="utf16Char">UTF16 encode character.</param>
-/// <returns>Escape sequence "\uxxxx" for utf16 character.</returns>
-std::string encodeUTF16(const char16_t utf16Char) {
-  std::string utf8Buffer;
+static void encodeUTF16(std::string &escapedString, const char16_t utf16Char) {
   const auto digits = "0123456789ABCDEF";
-  utf8Buffer += "\\u";
-  utf8Buffer += digits[utf16Char >> 12 & 0x0f];
-  utf8Buffer += digits[utf16Char >> 8 & 0x0f];
-  utf8Buffer += digits[utf16Char >> 4 & 0x0f];
-  utf8Buffer += digits[utf16Char & 0x0f];
-  return utf8Buffer;
+  escapedString += "\\u";
+  escapedString += digits[utf16Char >> 12 & 0x0f];
+  escapedString += digits[utf16Char >> 8 & 0x0f];
+  escapedString += digits[utf16Char >> 4 & 0x0f];
+  escapedString += digits[utf16Char & 0x0f];
 }
 
 /// <summary>
-/// Return true if a character is a valid upper surrogate.
-/// </summary>
-/// <param name="utf16Char">UTF16 character.</param>
-/// <returns>true if valid upper surrogate.</returns>
-bool isValidSurrogateUpper(const char16_t utf16Char) {
-  return utf16Char >= static_cast<char16_t>(kHighSurrogatesBegin) &&
-         utf16Char <= static_cast<char16_t>(kHighSurrogatesEnd);
-}
-/// <summary>
-/// Return true if a character is a valid lower surrogate.
+/// Return the length of the run of plain characters starting at current,
+/// testing eight bytes at a time until a word contains a control,
+/// non-ASCII, '"' or '\' character.
 /// </summary>
-/// <param name="utf16Char">UTF16 character.</param>
-/// <returns>true if valid lower surrogate.</returns>
-bool isValidSurrogateLower(const char16_t utf16Char) {
-  return utf16Char >= static_cast<char16_t>(kLowSurrogatesBegin) &&
-         utf16Char <= static_cast<char16_t>(kLowSurrogatesEnd);
-}
-
-/// <summary>
-/// Check that there are no single unpaired UTF-16 surrogates.From what I see
-/// this is meant to be an error but from searching the web I have not found a
-/// definitive answer.
-/// </summary>
-/// <param name="utf16Buffer">UTF16 string.</param>
-/// <returns>false if string contains an unpaired surrogate.</returns>
-bool unpairedSurrogatesInBuffer(const std::u16string &utf16Buffer) {
-  int index = 0;
-  while (index <= static_cast<int>(utf16Buffer.size()) - 1) {
-    if (isValidSurrogateUpper(utf16Buffer[index]) &&
-        isValidSurrogateLower(utf16Buffer[index + 1])) {
-      index++;
-    } else if (isValidSurrogateUpper(utf16Buffer[index]) ||
-               isValidSurrogateLower(utf16Buffer[index + 1])) {
-      return true;
+/// <param name="rawString">String being translated.</param>
+/// <param name="current">Start of run.</param>
+/// <returns>Number of characters that can be copied unchanged.</returns>
+static std::size_t plainRunLength(const std::string_view &rawString,
+                                  const std::size_t current) {
+  constexpr uint64_t kOnes{0x0101010101010101};
+  constexpr uint64_t kHighBits{0x8080808080808080};
+  const auto hasZeroByte = [](const uint64_t word) {
+    return (word - kOnes) & ~word & kHighBits;
+  };
+  std::size_t end = current;
+  for (; rawString.size() - end >= sizeof(uint64_t); end += sizeof(uint64_t)) {
+    uint64_t word;
+    std::memcpy(&word, rawString.data() + end, sizeof(word));
+    if ((word & kHighBits) || ((word - kOnes * 0x20) & kHighBits) ||
+        hasZeroByte(word ^ kOnes * kDoubleQuote) ||
+        hasZeroByte(word ^ kOnes * '\\') || hasZeroByte(word ^ kOnes * 0x7F)) {
+      break;
     }
-    index++;
   }
-  return false;
-}
-
-/// <summary>
-/// Determine whether passed in character is vaid ASCII
-/// </summary>
-/// <param name="utf16Char">UTF16 character.</param>
-/// <returns>true if valid ASCII.</returns>
-bool isASCII(const char16_t utf16Char) {
-  return utf16Char > 0x001F && utf16Char < 0x0080;
+  while (end < rawString.size() &&
+         isPlain[static_cast<unsigned char>(rawString[end])]) {
+    ++end;
+  }
+  return end - current;
 }
 
 /// <summary>
-/// YAML translator constructor.
+/// Translate escape sequences to UTF-8 without throwing. Unpaired surrogates
+/// and null characters are failures, as is any malformed escape.
 /// </summary>
-Default_Translator::Default_Translator() {
-  // Initialise tables used to convert to/from single character
-  // escape sequences within a YAML string.
-  for (const auto &[key, value] : escapeSequences) {
-    fromEscape[key] = value;
-    toEscape[value] = key;
+/// <param name="escapedString">YAML string to process.</param>
+/// <param name="translated">String with escapes translated.</param>
+/// <returns>DecodeFailure::none or why the string could not be
+/// translated.</returns>
+static DecodeFailure decodeEscapes(const std::string_view &escapedString,
+                                   std::string &translated) {
+  translated.clear();
+  translated.reserve(escapedString.size());
+  char32_t upperSurrogate{};
+  bool unpairedSurrogate{false};
+  for (std::size_t current = 0; current < escapedString.size();) {
+    // Normal characters up to next escape
+    const auto escape = escapedString.find('\\', current);
+    if (escape != current) {
+      translated.append(escapedString.substr(current, escape - current));
+      unpairedSurrogate |= upperSurrogate != 0;
+      upperSurrogate = 0;
+      if (escape == std::string_view::npos) {
+        break;
+      }
+    }
+    current = escape + 1;
+    if (current == escapedString.size()) {
+      return DecodeFailure::prematureEnd;
+    }
+    char32_t codePoint{};
+    if (const auto failure = decodeEscape(escapedString, current, codePoint);
+        failure != DecodeFailure::none) {
+      return failure;
+    }
+    if (upperSurrogate != 0) {
+      if (isValidSurrogateLower(codePoint)) {
+        appendUtf8(translated, 0x10000 + ((upperSurrogate - kHighSurrogatesBegin) << 10) +
+                                   (codePoint - kLowSurrogatesBegin));
+        upperSurrogate = 0;
+        continue;
+      }
+      unpairedSurrogate = true;
+      upperSurrogate = 0;
+    }
+    if (isValidSurrogateUpper(codePoint)) {
+      upperSurrogate = codePoint;
+    } else if (isValidSurrogateLower(codePoint)) {
+      unpairedSurrogate = true;
+    } else {
+      appendUtf8(translated, codePoint);
+    }
   }
-  // YAML 1.2 read-only single-char escapes (no output escaping needed)
-  fromEscape['0'] =
-      '\0'; // \0 -> null char (read-only; converter rejects null output)
-  fromEscape[' '] = ' '; // \  -> space (read-only; spaces don't need escaping)
-  fromEscape['/'] = '/'; // \/ -> slash (read-only; slashes don't need escaping)
-  fromEscape['\t'] =
-      '\t'; // \<TAB> -> tab (read-only; YAML 1.2 §7.3.2 #x9 alias)
-  // YAML 1.2 multi-byte Unicode escape sequences (bidirectional)
-  fromEscape['N'] = 0x0085;
-  toEscape[0x0085] = 'N'; // \N -> Next Line (U+0085)
-  fromEscape['_'] = 0x00A0;
-  toEscape[0x00A0] = '_'; // \_ -> NBSP (U+00A0)
-  fromEscape['L'] = 0x2028;
-  toEscape[0x2028] = 'L'; // \L -> Line Separator (U+2028)
-  fromEscape['P'] = 0x2029;
-  toEscape[0x2029] = 'P'; // \P -> Para Separator (U+2029)
+  if (unpairedSurrogate || upperSurrogate != 0) {
+    return DecodeFailure::unpairedSurrogate;
+  }
+  if (translated.find(kNull) != std::string::npos) {
+    return DecodeFailure::nullCharacter;
+  }
+  return DecodeFailure::none;
 }
 
 /// <summary>
@@ -212,70 +304,97 @@ Default_Translator::Default_Translator() {
 /// <returns>String with escapes translated.</returns>
 std::string
 Default_Translator::from(const std::string_view &escapedString) const {
-  std::u16string utf16Buffer;
-  for (auto current = escapedString.begin(); current != escapedString.end();) {
-    // Normal character
-    if (*current != '\\') {
-      utf16Buffer += *current++;
-      continue;
-    }
-    ++current;
-    // Check an escape sequence if characters to process
-    if (current != escapedString.end()) {
-      // Single character
-      if (fromEscape.contains(*current)) {
-        utf16Buffer += fromEscape[static_cast<char>(*current)];
-        ++current;
-      }
-      // UTF16 "\uxxxx"
-      else if (*current == 'u') {
-        utf16Buffer +=
-            decodeUTF16(current, std::distance(current, escapedString.end()));
-        // UTF32 "\Uxxxxxxxx"
-      } else if (*current == 'U') {
-        decodeUTF32(current, std::distance(current, escapedString.end()),
-                    utf16Buffer);
-        // UTF8 "\x00"
-      } else if (*current == 'x') {
-        utf16Buffer +=
-            decodeUTF8(current, std::distance(current, escapedString.end()));
-      }
-      // Invalid escaped character — only the sequences listed in YAML 1.2
-      // §7.3.1 are valid; anything else (e.g. \. or \%) must be rejected.
-      else {
-        YAML_THROW(Error, "Invalid escaped character.");
-      }
-    } else {
-      YAML_THROW(Error, "Premature and of character escape sequence.");
-    }
-  }
-  if (unpairedSurrogatesInBuffer(utf16Buffer)) {
+  std::string translated;
+  switch (decodeEscapes(escapedString, translated)) {
+  case DecodeFailure::none:
+    return translated;
+  case DecodeFailure::outOfRange:
+    YAML_THROW(Error, "Unicode code point out of range.");
+  case DecodeFailure::invalidEscape:
+    YAML_THROW(Error, "Invalid escaped character.");
+  case DecodeFailure::prematureEnd:
+    YAML_THROW(Error, "Premature and of character escape sequence.");
+  case DecodeFailure::unpairedSurrogate:
     YAML_THROW(Error, "Unpaired surrogate found.");
+  case DecodeFailure::nullCharacter:
+    YAML_THROW(YAML_Lib::Error, "Tried to convert a null character.");
+  case DecodeFailure::syntax:
+    break;
   }
-  return toUtf8(utf16Buffer);
+  YAML_THROW(Error, "Syntax error detected.");
+}
+
+/// <summary>
+/// Convert escape sequences as from() does, reporting failure instead of
+/// throwing so that speculative parses can probe a quoted scalar.
+/// </summary>
+/// <param name="escapedString">YAML string to process.</param>
+/// <param name="translated">String with escapes translated.</param>
+/// <returns>true if the string was translated.</returns>
+bool Default_Translator::tryFrom(const std::string_view &escapedString,
+                                 std::string &translated) const {
+  return decodeEscapes(escapedString, translated) == DecodeFailure::none;
 }
 
 /// <summary>
 /// Convert a string from raw charater values (UTF8) so that it has character
-/// escapes where applicable for its YAML form.
+/// escapes where applicable for its YAML form. Characters outside printable
+/// ASCII without a short escape are written as \uxxxx (a surrogate pair of
+/// them above U+FFFF).
 /// </summary>
 /// <param name="rawString">String to convert.</param>
 /// <returns>YAML string with escapes.</returns>
 std::string Default_Translator::to(const std::string_view &rawString) const {
   std::string escapedString;
-  for (char16_t utf16Char : toUtf16(std::string(rawString))) {
-    // Control characters
-    if (toEscape.contains(utf16Char)) {
-      escapedString += '\\';
-      escapedString += toEscape[utf16Char];
-    }
+  escapedString.reserve(rawString.size());
+  for (std::size_t current = 0; current < rawString.size();) {
     // ASCII
-    else if (isASCII(utf16Char) && std::isprint(utf16Char)) {
-      escapedString += static_cast<char>(utf16Char);
+    const auto plain = plainRunLength(rawString, current);
+    escapedString.append(rawString.substr(current, plain));
+    current += plain;
+    if (current == rawString.size()) {
+      break;
+    }
+    // Control characters
+    if (const auto character = static_cast<unsigned char>(rawString[current]);
+        character < 0x80) {
+      if (character == kNull) {
+        YAML_THROW(YAML_Lib::Error, "Tried to convert a null character.");
+      }
+      if (toEscape[character] != kNull) {
+        escapedString += '\\';
+        escapedString += toEscape[character];
+      } else {
+        encodeUTF16(escapedString, character);
+      }
+      ++current;
+      continue;
     }
     // UTF8 escaped
-    else {
-      escapedString += encodeUTF16(utf16Char);
+    switch (const char32_t codePoint = decodeUtf8(rawString, current)) {
+    case 0x0085:
+      escapedString += "\\N";
+      break;
+    case 0x00A0:
+      escapedString += "\\_";
+      break;
+    case 0x2028:
+      escapedString += "\\L";
+      break;
+    case 0x2029:
+      escapedString += "\\P";
+      break;
+    default:
+      if (codePoint < 0x10000) {
+        encodeUTF16(escapedString, static_cast<char16_t>(codePoint));
+      } else {
+        // Encode as UTF-16 surrogate pair
+        const char32_t code = codePoint - 0x10000;
+        encodeUTF16(escapedString,
+                    static_cast<char16_t>(kHighSurrogatesBegin + (code >> 10)));
+        encodeUTF16(escapedString,
+                    static_cast<char16_t>(kLowSurrogatesBegin + (code & 0x3FF)));
+      }
     }
   }
   return escapedString;
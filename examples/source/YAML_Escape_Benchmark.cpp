@@ -0,0 +1,112 @@
+//
+// Program: YAML_Escape_Benchmark
+//
+// Description: Time Default_Translator escaping (to) and unescaping (from)
+// on escape-free and escape-heavy strings, the path every double-quoted
+// YAML scalar and every JSON key and value goes through.
+//
+// Dependencies: C++20, PLOG, YAML_Lib.
+//
+
+#include "YAML_Utility.hpp"
+#include "Default_Translator.hpp"
+
+namespace yl = YAML_Lib;
+namespace chrono = std::chrono;
+
+static constexpr int kStringLength = 64;
+static constexpr int kStrings = 20000;
+static constexpr int kIterations = 10;
+
+/// <summary>
+/// Create strings of plain printable ASCII that need no escaping.
+/// </summary>
+/// <returns>Vector of raw strings.</returns>
+std::vector<std::string> createEscapeFree() {
+  std::vector<std::string> strings;
+  for (int index = 0; index < kStrings; ++index) {
+    std::string text{"user" + std::to_string(index) + " lives at "};
+    while (text.size() < kStringLength) {
+      text += "1 Main Street, Springfield ";
+    }
+    strings.push_back(text.substr(0, kStringLength));
+  }
+  return strings;
+}
+/// <summary>
+/// Create strings mixing control characters, quotes and non-ASCII text
+/// (two, three and four byte UTF-8) so most characters need escaping.
+/// </summary>
+/// <returns>Vector of raw strings.</returns>
+std::vector<std::string> createEscapeHeavy() {
+  std::vector<std::string> strings;
+  for (int index = 0; index < kStrings; ++index) {
+    std::string text{std::to_string(index)};
+    while (text.size() < kStringLength) {
+      text += "\t\"caf\xC3\xA9\"\n\\\xE2\x82\xAC\r\xF0\x9F\x98\x80\x1b";
+    }
+    strings.push_back(text);
+  }
+  return strings;
+}
+/// <summary>
+/// Run a translation over all strings kIterations times and log the
+/// average time and throughput.
+/// </summary>
+/// <param name="name">Benchmark name for the log.</param>
+/// <param name="strings">Strings to translate.</param>
+/// <param name="translate">Translation to time.</param>
+template <typename Translate>
+void timeTranslation(const std::string &name,
+                     const std::vector<std::string> &strings,
+                     Translate translate) {
+  std::size_t bytes{};
+  for (const auto &string : strings) {
+    bytes += string.size();
+    translate(string); // warm up
+  }
+  std::size_t checksum{};
+  const auto start = chrono::high_resolution_clock::now();
+  for (int iteration = 0; iteration < kIterations; ++iteration) {
+    for (const auto &string : strings) {
+      checksum += translate(string).size();
+    }
+  }
+  const auto stop = chrono::high_resolution_clock::now();
+  const auto microseconds =
+      chrono::duration_cast<chrono::microseconds>(stop - start).count() /
+      kIterations;
+  PLOG_INFO << name << ": " << microseconds << " microseconds per pass of "
+            << bytes << " bytes ("
+            << (microseconds != 0 ? bytes / static_cast<std::size_t>(microseconds) : 0)
+            << " MB/s, checksum " << checksum / kIterations << ").";
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char **argv) {
+  try {
+    // Initialise logging.
+    init(plog::debug, "YAML_Escape_Benchmark.log");
+    PLOG_INFO << "YAML_Escape_Benchmark started ...";
+    PLOG_INFO << YAML_Lib::YAML::version();
+    const yl::Default_Translator translator;
+    for (const auto &[name, raw] :
+         {std::pair{std::string("escape-free"), createEscapeFree()},
+          std::pair{std::string("escape-heavy"), createEscapeHeavy()}}) {
+      std::vector<std::string> escaped;
+      for (const auto &string : raw) {
+        escaped.push_back(translator.to(string));
+      }
+      timeTranslation("to (" + name + ")", raw, [&](const std::string &string) {
+        return translator.to(string);
+      });
+      timeTranslation("from (" + name + ")", escaped,
+                      [&](const std::string &string) {
+                        return translator.from(string);
+                      });
+    }
+  } catch (const std::exception &ex) {
+    PLOG_ERROR << "Error: " << ex.what();
+  }
+  PLOG_INFO << "YAML_Escape_Benchmark exited.";
+  exit(EXIT_SUCCESS);
+}
@@ -0,0 +1,98 @@
+//
+// Program: YAML_Flow_Benchmark
+//
+// Description: Time parsing large single line flow collections (JSON style
+// arrays of numbers and quoted strings, a flow mapping and a nested array of
+// small arrays) with Default_Parser, where per element routing dominates the
+// parse.
+//
+// Dependencies: C++20, PLOG, YAML_Lib.
+//
+
+#include "YAML_Utility.hpp"
+
+namespace yl = YAML_Lib;
+namespace chrono = std::chrono;
+
+static constexpr int kElements = 1000000;
+static constexpr int kIterations = 3;
+
+/// <summary>
+/// Create a flow sequence of kElements entries.
+/// </summary>
+/// <param name="element">Returns the text of entry n.</param>
+/// <returns>YAML text.</returns>
+template <typename Element> std::string createFlowArray(Element element) {
+  std::string yaml{"["};
+  for (int index = 0; index < kElements; ++index) {
+    if (index != 0) {
+      yaml += ", ";
+    }
+    yaml += element(index);
+  }
+  return yaml + "]\n";
+}
+/// <summary>
+/// Create a flow mapping of kElements plain keys with number values.
+/// </summary>
+/// <returns>YAML text.</returns>
+std::string createFlowMapping() {
+  std::string yaml{"{"};
+  for (int key = 0; key < kElements; ++key) {
+    if (key != 0) {
+      yaml += ", ";
+    }
+    yaml += "key" + std::to_string(key) + ": " + std::to_string(key);
+  }
+  return yaml + "}\n";
+}
+/// <summary>
+/// Parse yamlText kIterations times and log the average time.
+/// </summary>
+/// <param name="name">Benchmark name for the log.</param>
+/// <param name="yamlText">YAML to parse.</param>
+void timeParse(const std::string &name, const std::string &yamlText) {
+  const yl::YAML yaml;
+  const auto start = chrono::high_resolution_clock::now();
+  for (int iteration = 0; iteration < kIterations; ++iteration) {
+    yaml.parse(yl::BufferSource{yamlText});
+  }
+  const auto stop = chrono::high_resolution_clock::now();
+  PLOG_INFO << name << ": "
+            << chrono::duration_cast<chrono::milliseconds>(stop - start).count() /
+                   kIterations
+            << " milliseconds per parse of " << kElements << " elements ("
+            << yamlText.size() << " bytes).";
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char **argv) {
+  try {
+    // Initialise logging.
+    init(plog::debug, "YAML_Flow_Benchmark.log");
+    PLOG_INFO << "YAML_Flow_Benchmark started ...";
+    PLOG_INFO << YAML_Lib::YAML::version();
+    timeParse("flow array, integers", createFlowArray([](const int index) {
+                return std::to_string(index);
+              }));
+    timeParse("flow array, floats", createFlowArray([](const int index) {
+                return std::to_string(index) + ".25e-3";
+              }));
+    timeParse("flow array, double quoted strings",
+              createFlowArray([](const int index) {
+                return "\"item" + std::to_string(index) + "\"";
+              }));
+    timeParse("flow array, booleans and nulls",
+              createFlowArray([](const int index) {
+                return index % 3 == 0 ? "true" : index % 3 == 1 ? "false" : "null";
+              }));
+    timeParse("flow array of [x, y] pairs", createFlowArray([](const int index) {
+                return "[" + std::to_string(index) + ", " +
+                       std::to_string(-index) + "]";
+              }));
+    timeParse("flow mapping, number values", createFlowMapping());
+  } catch (const std::exception &ex) {
+    PLOG_ERROR << "Error: " << ex.what();
+  }
+  PLOG_INFO << "YAML_Flow_Benchmark exited.";
+  exit(EXIT_SUCCESS);
+}
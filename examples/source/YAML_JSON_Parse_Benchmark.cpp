@@ -0,0 +1,84 @@
+//
+// Program: YAML_JSON_Parse_Benchmark
+//
+// Description: Generate a JSON API style payload and time parsing it with
+// Default_Parser, JSON_Parser and (after conversion) MessagePack_Parser into
+// the same Node tree.
+//
+// Dependencies: C++20, PLOG, YAML_Lib.
+//
+
+#include "YAML_Utility.hpp"
+#include "JSON_Parser.hpp"
+#include "MessagePack_Parser.hpp"
+#include "MessagePack_Stringify.hpp"
+
+namespace yl = YAML_Lib;
+namespace chrono = std::chrono;
+
+static constexpr int kRecords = 2000;
+static constexpr int kIterations = 10;
+
+/// <summary>
+/// Create a JSON array of records similar to a typical API response.
+/// </summary>
+/// <returns>JSON text.</returns>
+std::string createPayload() {
+  std::string json{"["};
+  for (int record = 0; record < kRecords; ++record) {
+    if (record != 0) {
+      json += ",";
+    }
+    json += R"({"id": )" + std::to_string(record) + R"(, "name": "user)" +
+            std::to_string(record) +
+            R"(", "email": "user@example.com", "active": true, "score": )" +
+            std::to_string(record) +
+            R"(.5, "tags": ["alpha", "beta", "gamma"], "manager": null,)"
+            R"( "address": {"street": "1 Main Street", "city": "Springfield"}})";
+  }
+  return json + "]";
+}
+/// <summary>
+/// Parse payload kIterations times with the given parser and log the
+/// average time.
+/// </summary>
+/// <param name="name">Parser name for the log.</param>
+/// <param name="parser">Parser to use (nullptr = Default_Parser).</param>
+/// <param name="payload">Data to parse.</param>
+void timeParser(const std::string &name, yl::IParser *parser,
+                const std::string &payload) {
+  const yl::YAML yaml(nullptr, parser);
+  yaml.parse(yl::BufferSource{payload}); // warm up
+  const auto start = chrono::high_resolution_clock::now();
+  for (int iteration = 0; iteration < kIterations; ++iteration) {
+    yaml.parse(yl::BufferSource{payload});
+  }
+  const auto stop = chrono::high_resolution_clock::now();
+  PLOG_INFO << name << ": "
+            << chrono::duration_cast<chrono::microseconds>(stop - start).count() /
+                   kIterations
+            << " microseconds per parse of " << payload.size() << " bytes.";
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char **argv) {
+  try {
+    // Initialise logging.
+    init(plog::debug, "YAML_JSON_Parse_Benchmark.log");
+    PLOG_INFO << "YAML_JSON_Parse_Benchmark started ...";
+    PLOG_INFO << YAML_Lib::YAML::version();
+    const std::string json{createPayload()};
+    const yl::YAML converter(yl::makeStringify<yl::MessagePack_Stringify>(),
+                             yl::makeParser<yl::JSON_Parser>());
+    converter.parse(yl::BufferSource{json});
+    yl::BufferDestination messagePack;
+    converter.stringify(messagePack);
+    timeParser("Default_Parser (JSON)", nullptr, json);
+    timeParser("JSON_Parser (JSON)", yl::makeParser<yl::JSON_Parser>(), json);
+    timeParser("MessagePack_Parser (MessagePack)",
+               yl::makeParser<yl::MessagePack_Parser>(), messagePack.toString());
+  } catch (const std::exception &ex) {
+    PLOG_ERROR << "Error: " << ex.what();
+  }
+  PLOG_INFO << "YAML_JSON_Parse_Benchmark exited.";
+  exit(EXIT_SUCCESS);
+}
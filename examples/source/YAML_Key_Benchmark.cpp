@@ -0,0 +1,86 @@
+//
+// Program: YAML_Key_Benchmark
+//
+// Description: Time parsing key-heavy block mappings (double quoted, single
+// quoted and plain keys, plus a flow mapping of quoted keys) with
+// Default_Parser, where key handling dominates the parse.
+//
+// Dependencies: C++20, PLOG, YAML_Lib.
+//
+
+#include "YAML_Utility.hpp"
+
+namespace yl = YAML_Lib;
+namespace chrono = std::chrono;
+
+static constexpr int kKeys = 1000000;
+static constexpr int kIterations = 3;
+
+/// <summary>
+/// Create a block mapping of kKeys entries with the given key quoting.
+/// </summary>
+/// <param name="quote">Quote character (0 for plain keys).</param>
+/// <returns>YAML text.</returns>
+std::string createBlockMapping(const char quote) {
+  std::string yaml;
+  for (int key = 0; key < kKeys; ++key) {
+    if (quote != 0) {
+      yaml += quote;
+    }
+    yaml += "key" + std::to_string(key);
+    if (quote != 0) {
+      yaml += quote;
+    }
+    yaml += ": " + std::to_string(key) + "\n";
+  }
+  return yaml;
+}
+/// <summary>
+/// Create a single line flow mapping of kKeys double quoted keys.
+/// </summary>
+/// <returns>YAML text.</returns>
+std::string createFlowMapping() {
+  std::string yaml{"{"};
+  for (int key = 0; key < kKeys; ++key) {
+    if (key != 0) {
+      yaml += ", ";
+    }
+    yaml += "\"key" + std::to_string(key) + "\": " + std::to_string(key);
+  }
+  return yaml + "}\n";
+}
+/// <summary>
+/// Parse yamlText kIterations times and log the average time.
+/// </summary>
+/// <param name="name">Benchmark name for the log.</param>
+/// <param name="yamlText">YAML to parse.</param>
+void timeParse(const std::string &name, const std::string &yamlText) {
+  const yl::YAML yaml;
+  const auto start = chrono::high_resolution_clock::now();
+  for (int iteration = 0; iteration < kIterations; ++iteration) {
+    yaml.parse(yl::BufferSource{yamlText});
+  }
+  const auto stop = chrono::high_resolution_clock::now();
+  PLOG_INFO << name << ": "
+            << chrono::duration_cast<chrono::milliseconds>(stop - start).count() /
+                   kIterations
+            << " milliseconds per parse of " << kKeys << " keys ("
+            << yamlText.size() << " bytes).";
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char **argv) {
+  try {
+    // Initialise logging.
+    init(plog::debug, "YAML_Key_Benchmark.log");
+    PLOG_INFO << "YAML_Key_Benchmark started ...";
+    PLOG_INFO << YAML_Lib::YAML::version();
+    timeParse("double quoted keys", createBlockMapping('"'));
+    timeParse("single quoted keys", createBlockMapping('\''));
+    timeParse("plain keys", createBlockMapping(0));
+    timeParse("flow mapping, double quoted keys", createFlowMapping());
+  } catch (const std::exception &ex) {
+    PLOG_ERROR << "Error: " << ex.what();
+  }
+  PLOG_INFO << "YAML_Key_Benchmark exited.";
+  exit(EXIT_SUCCESS);
+}
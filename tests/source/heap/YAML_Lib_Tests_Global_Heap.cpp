@@ -0,0 +1,136 @@
+#include "YAML_Lib_Tests.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+
+// ============================================================================
+// Global heap use of steady state parsing. Global operator new/delete are
+// replaced to count calls, which is why these tests are a program of their
+// own rather than part of the unit tests.
+// ============================================================================
+
+static std::atomic<uint64_t> globalNewCalls{};
+
+void *operator new(const std::size_t bytes) {
+  globalNewCalls.fetch_add(1, std::memory_order_relaxed);
+  if (void *pointer = std::malloc(bytes != 0 ? bytes : 1)) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+void operator delete(void *pointer) noexcept { std::free(pointer); }
+void operator delete(void *pointer, std::size_t) noexcept { std::free(pointer); }
+// new_delete_resource() allocates through the aligned forms: over-allocate and
+// keep the pointer from malloc just below the aligned block.
+void *operator new(const std::size_t bytes, const std::align_val_t alignment) {
+  globalNewCalls.fetch_add(1, std::memory_order_relaxed);
+  const std::size_t align = std::max(static_cast<std::size_t>(alignment), sizeof(void *));
+  void *raw = std::malloc(bytes + align + sizeof(void *));
+  if (raw == nullptr) {
+    throw std::bad_alloc();
+  }
+  const std::uintptr_t address =
+      (reinterpret_cast<std::uintptr_t>(raw) + sizeof(void *) + align - 1) & ~(align - 1);
+  reinterpret_cast<void **>(address)[-1] = raw;
+  return reinterpret_cast<void *>(address);
+}
+void operator delete(void *pointer, std::align_val_t) noexcept {
+  if (pointer != nullptr) {
+    std::free(static_cast<void **>(pointer)[-1]);
+  }
+}
+void operator delete(void *pointer, std::size_t, const std::align_val_t alignment) noexcept {
+  operator delete(pointer, alignment);
+}
+
+// Exercises every kind of scratch string the parser builds: long plain,
+// quoted and escaped scalars, keys re-parsed from a buffer, block scalars,
+// local, %TAG and core tags, anchors, aliases and merges, flow collections
+// and more than one document.
+static constexpr std::string_view kHeapYAML{
+    "%TAG !e! tag:example.com,2000:app/\n"
+    "---\n"
+    "# a comment that is long enough to need its own storage\n"
+    "a key longer than the small string buffer: a plain value just as long\n"
+    "quoted: \"a double quoted string with an \\t escape and \\u263A in it\"\n"
+    "'single quoted key that is long': 'and a single quoted value'\n"
+    "tagged: !local/type a value carrying a long local tag\n"
+    "prefixed: !e!foo a value with a prefixed tag handle\n"
+    "integer: !!int \"12345\"\n"
+    "text: !!str 0077\n"
+    "created: 2001-12-14t21:59:43.10-05:00\n"
+    "base: &base\n"
+    "  name: a name long enough to be allocated separately\n"
+    "  values: [1, 2, 3]\n"
+    "derived:\n"
+    "  <<: *base\n"
+    "  extra: another long value string for the derived map\n"
+    "literal: |\n"
+    "  the first line of a literal block string\n"
+    "  and the second line of the same block\n"
+    "folded: >-\n"
+    "  the first line of a folded block string\n"
+    "  and the second line of the same block\n"
+    "list: [another long plain string element, 'and a single quoted one', {k: v}]\n"
+    "? a complex key that is long enough\n"
+    ": its value\n"
+    "multi: a plain multi line\n"
+    "  scalar continued on the next line\n"
+    "---\n"
+    "second: document\n"
+    "...\n"};
+
+// Parse kHeapYAML a few times so that buffers the library keeps between
+// parses have grown, then count the global operator new calls made by one
+// more parse (the source is set up before counting starts).
+template <typename Parse> static uint64_t steadyStateCalls(const YAML &yaml, Parse parse) {
+  for (int warmUp = 0; warmUp < 3; ++warmUp) {
+    BufferSource source{kHeapYAML};
+    parse(yaml, source);
+  }
+  BufferSource source{kHeapYAML};
+  const uint64_t before = globalNewCalls;
+  parse(yaml, source);
+  const uint64_t calls = globalNewCalls - before;
+  REQUIRE(yaml.getNumberOfDocuments() == 2);
+  REQUIRE(NRef<String>(yaml["derived"]["name"]).value() ==
+          "a name long enough to be allocated separately");
+  return calls;
+}
+
+static void parse(const YAML &yaml, ISource &source) { yaml.parse(source); }
+static void reparse(const YAML &yaml, ISource &source) { yaml.reparse(source); }
+
+TEST_CASE("Check steady state parsing makes no global heap allocations.",
+          "[YAML][Allocation][Heap]") {
+  // Upstream memory taken up front so that arena blocks and pool chunks
+  // never come from the global heap.
+  const std::unique_ptr<std::byte[]> buffer{new std::byte[4 * 1024 * 1024]};
+  std::pmr::monotonic_buffer_resource upstream{buffer.get(), 4 * 1024 * 1024,
+                                               std::pmr::null_memory_resource()};
+  SECTION("Reparsing into an arena tree.", "[YAML][Allocation][Heap]") {
+    Options options;
+    options.arena_tree = true;
+    const YAML yaml{options};
+    REQUIRE(steadyStateCalls(yaml, reparse) == 0);
+  }
+  SECTION("Parsing into an arena tree over a pool.", "[YAML][Allocation][Heap]") {
+    std::pmr::unsynchronized_pool_resource pool{&upstream};
+    Options options;
+    options.memory_resource = &pool;
+    options.arena_tree = true;
+    const YAML yaml{options};
+    REQUIRE(steadyStateCalls(yaml, parse) == 0);
+  }
+  SECTION("Parsing with a memory resource.", "[YAML][Allocation][Heap]") {
+    std::pmr::unsynchronized_pool_resource pool{&upstream};
+    const YAML yaml{&pool};
+    REQUIRE(steadyStateCalls(yaml, parse) == 0);
+  }
+  SECTION("Without a resource the tree is on the global heap.",
+          "[YAML][Allocation][Heap]") {
+    const YAML yaml;
+    REQUIRE(steadyStateCalls(yaml, parse) > 0);
+  }
+}
@@ -1,6 +1,11 @@
 #include "YAML_Lib_Tests.hpp"
 
 #ifdef YAML_LIB_FILE_IO
+static void writeBytes(const std::string &fileName, const std::string &bytes) {
+  std::ofstream file{fileName, std::ios::binary};
+  file << bytes;
+}
+
 TEST_CASE("Checks for fromFile() api.", "[YAML][FromFile]") {
   SECTION("Check that fromFile() works with UTF8.", "[YAML][FromFile][UTF8]") {
     std::string testFile{prefixTestDataPath("testfile033.yaml")};
@@ -57,23 +62,32 @@ TEST_CASE("Checks for fromFile() api.", "[YAML][FromFile]") {
         " MYSQL_USER: wordpress\n    MYSQL_PASSWORD: wordpress\n"};
     REQUIRE(YAML::fromFile(testFile) == expected);
   }
-  // SECTION("Check that fromFile() works with UTF32BE.",
-  // "[YAML][FromFile][UTF32BE]")
-  // {
-  //     std::string testFile{ prefixPath("testfile025.yaml") };
-  //     std::string expected{ R"([true  , "Out of time",  7.89043e+18,
-  //     true])" }; REQUIRE_THROWS_WITH(
-  //         YAML::fromFile(testFile), "YAML Error: Unsupported YAML file
-  //         format (Byte Order Mark) encountered.");
-  // }
-  // SECTION("Check that fromFile() works with UTF32LE.",
-  // "[YAML][FromFile][UTF32LE]")
-  // {
-  //     std::string testFile{ prefixPath("testfile026.yaml") };
-  //     std::string expected{ R"([true  , "Out of time",  7.89043e+18,
-  //     true])" }; REQUIRE_THROWS_WITH(
-  //         YAML::fromFile(testFile), "YAML Error: Unsupported YAML file
-  //         format (Byte Order Mark) encountered.");
-  // }
+  SECTION("Check that fromFile() works with UTF32BE.",
+          "[YAML][FromFile][UTF32BE]") {
+    std::string testFile{generateRandomFileName()};
+    writeBytes(testFile, std::string("\x00\x00\xFE\xFF\x00\x00\x00" "a"
+                                    "\x00\x00\x00\x0D\x00\x00\x00\x0A"
+                                    "\x00\x01\xF6\x00",
+                                    20));
+    REQUIRE(YAML::fromFile(testFile) == "a\n\xF0\x9F\x98\x80");
+    std::filesystem::remove(testFile);
+  }
+  SECTION("Check that fromFile() works with UTF32LE.",
+          "[YAML][FromFile][UTF32LE]") {
+    std::string testFile{generateRandomFileName()};
+    writeBytes(testFile, std::string("\xFF\xFE\x00\x00" "a\x00\x00\x00"
+                                    "\xE9\x00\x00\x00\x00\xF6\x01\x00",
+                                    16));
+    REQUIRE(YAML::fromFile(testFile) == "a\xC3\xA9\xF0\x9F\x98\x80");
+    std::filesystem::remove(testFile);
+  }
+  SECTION("Check that fromFile() rejects invalid UTF-16.",
+          "[YAML][FromFile][UTF16LE][Exception]") {
+    std::string testFile{generateRandomFileName()};
+    writeBytes(testFile, std::string("\xFF\xFE" "a\x00\x00\xD8" "b\x00", 8));
+    REQUIRE_THROWS_WITH(YAML::fromFile(testFile),
+                        "YAML Error: Invalid UTF-16 sequence.");
+    std::filesystem::remove(testFile);
+  }
 }
 #endif // YAML_LIB_FILE_IO
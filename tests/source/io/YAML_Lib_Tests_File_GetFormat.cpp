@@ -19,13 +19,19 @@ TEST_CASE("Checks for getFileFormat() api.", "[YAML][GetFileFormat]")
     {
         REQUIRE(YAML::getFileFormat(prefixTestDataPath("testfile036.yaml")) == YAML::Format::utf16LE);
     }
-    // SECTION("Check that getFileFormat() works with UTF32BE.", "[YAML][GetFileFormat][UTF32BE]")
-    // {
-    //     REQUIRE(YAML::getFileFormat(prefixPath("testfile025.yaml")) == YAML::Format::utf32BE);
-    // }
-    // SECTION("Check that getFileFormat() works with UTF32LE.", "[YAML][GetFileFormat][UTF32LE]")
-    // {
-    //     REQUIRE(YAML::getFileFormat(prefixPath("testfile026.yaml")) == YAML::Format::utf32LE);
-    // }
+    SECTION("Check that getFileFormat() works with UTF32BE.", "[YAML][GetFileFormat][UTF32BE]")
+    {
+        std::string testFile{ generateRandomFileName() };
+        YAML::toFile(testFile, "a: 1\n", YAML::Format::utf32BE);
+        REQUIRE(YAML::getFileFormat(testFile) == YAML::Format::utf32BE);
+        std::filesystem::remove(testFile);
+    }
+    SECTION("Check that getFileFormat() works with UTF32LE.", "[YAML][GetFileFormat][UTF32LE]")
+    {
+        std::string testFile{ generateRandomFileName() };
+        YAML::toFile(testFile, "a: 1\n", YAML::Format::utf32LE);
+        REQUIRE(YAML::getFileFormat(testFile) == YAML::Format::utf32LE);
+        std::filesystem::remove(testFile);
+    }
 }
 #endif // YAML_LIB_FILE_IO
@@ -65,25 +65,68 @@ TEST_CASE("Checks for toFile() api.", "[YAML][ToFile]") {
     REQUIRE(YAML::fromFile(testFileName) == expected);
     std::filesystem::remove(testFileName);
   }
-  // SECTION("Check that toFile() works with UTF32BE.",
-  // "[YAML][ToFile][UTF32BE]")
-  // {
-  //     std::string testFileName{ prefixPath(kGeneratedYAMLFile) };
-  //     std::string expected{ R"([true  , "Out of time",  7.89043e+18, true])"
-  //     }; REQUIRE_THROWS_WITH(YAML::toFile(testFileName, expected,
-  //     YAML::Format::utf32BE),
-  //                         "YAML Error: Unsupported YAML file format (Byte
-  //                         Order Mark) specified.");
-  // }
-  // SECTION("Check that toFile() works with UTF32LE.",
-  // "[YAML][ToFile][UTF32LE]")
-  // {
-  //     std::string testFileName{ prefixPath(kGeneratedYAMLFile) };
-  //     std::string expected{ R"([true  , "Out of time",  7.89043e+18, true])"
-  //     }; REQUIRE_THROWS_WITH(YAML::toFile(testFileName, expected,
-  //     YAML::Format::utf32LE),
-  //                         "YAML Error: Unsupported YAML file format (Byte
-  //                         Order Mark) specified.");
-  // }
+  SECTION("Check that toFile() works with UTF32BE.",
+          "[YAML][ToFile][UTF32BE]") {
+    std::string testFileName{generateRandomFileName()};
+    std::string expected{
+        "version: \"3.9\"\n\nservices:\n  production-db:\n    image: "
+        "mysql:5.7\n    volumes:\n      - db_data:/var/lib/mysql\n    restart: "
+        "always\n    environment:\n  MYSQL_ROOT_PASSWORD: somewordpress\n  "
+        "MYSQL_DATABASE: wordpress\n  MYSQL_USER: wordpress\n  MYSQL_PASSWORD: "
+        "wordpress\n  test-db:\n    image: mysql:5.7\n    volumes:\n      - "
+        "db_data:/var/lib/mysql\n    restart: always\n    environment:\n    "
+        "MYSQL_ROOT_PASSWORD: somewordpress\n    MYSQL_DATABASE: wordpress\n   "
+        " MYSQL_USER: wordpress\n    MYSQL_PASSWORD: wordpress\n"};
+    YAML::toFile(testFileName, expected, YAML::Format::utf32BE);
+    REQUIRE(YAML::fromFile(testFileName) == expected);
+    std::filesystem::remove(testFileName);
+  }
+  SECTION("Check that toFile() works with UTF32LE.",
+          "[YAML][ToFile][UTF32LE]") {
+    std::string testFileName{generateRandomFileName()};
+    std::string expected{
+        "version: \"3.9\"\n\nservices:\n  production-db:\n    image: "
+        "mysql:5.7\n    volumes:\n      - db_data:/var/lib/mysql\n    restart: "
+        "always\n    environment:\n  MYSQL_ROOT_PASSWORD: somewordpress\n  "
+        "MYSQL_DATABASE: wordpress\n  MYSQL_USER: wordpress\n  MYSQL_PASSWORD: "
+        "wordpress\n  test-db:\n    image: mysql:5.7\n    volumes:\n      - "
+        "db_data:/var/lib/mysql\n    restart: always\n    environment:\n    "
+        "MYSQL_ROOT_PASSWORD: somewordpress\n    MYSQL_DATABASE: wordpress\n   "
+        " MYSQL_USER: wordpress\n    MYSQL_PASSWORD: wordpress\n"};
+    YAML::toFile(testFileName, expected, YAML::Format::utf32LE);
+    REQUIRE(YAML::fromFile(testFileName) == expected);
+    std::filesystem::remove(testFileName);
+  }
+  SECTION("Check that toFile() round trips non-ASCII text in every format.",
+          "[YAML][ToFile][Unicode]") {
+    const std::string expected{
+        "caf\xC3\xA9: \xE2\x82\xAC" "5\nemoji: \xF0\x9F\x98\x80\n"};
+    for (const auto format :
+         {YAML::Format::utf8, YAML::Format::utf8BOM, YAML::Format::utf16BE,
+          YAML::Format::utf16LE, YAML::Format::utf32BE,
+          YAML::Format::utf32LE}) {
+      std::string testFileName{generateRandomFileName()};
+      YAML::toFile(testFileName, expected, format);
+      REQUIRE(YAML::getFileFormat(testFileName) == format);
+      REQUIRE(YAML::fromFile(testFileName) == expected);
+      std::filesystem::remove(testFileName);
+    }
+  }
+  SECTION("Check that fromFile() decodes surrogate pairs split across blocks.",
+          "[YAML][ToFile][Unicode]") {
+    // Odd number of UTF-16 units before the pairs so a block ends mid pair.
+    std::string expected{"a: "};
+    for (int index = 0; index < 40000; ++index) {
+      expected += "\xF0\x9F\x98\x80";
+    }
+    expected += "\n";
+    for (const auto format : {YAML::Format::utf16BE, YAML::Format::utf16LE,
+                              YAML::Format::utf32LE}) {
+      std::string testFileName{generateRandomFileName()};
+      YAML::toFile(testFileName, expected, format);
+      REQUIRE(YAML::fromFile(testFileName) == expected);
+      std::filesystem::remove(testFileName);
+    }
+  }
 }
 #endif // YAML_LIB_FILE_IO
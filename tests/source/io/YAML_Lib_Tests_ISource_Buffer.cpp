@@ -67,6 +67,30 @@ TEST_CASE("Check ISource (Buffer) interface.", "[YAML][ISource][Buffer]") {
     REQUIRE_FALSE(!source.match("doe")); // Match
     REQUIRE(source.position() == 3);     // new position
   }
+  SECTION("Check that nested saves are restored in reverse order however deep.",
+          "[YAML][ISource][Buffer][Save]") {
+    // Deeper than the contexts a source holds without going to the heap.
+    const std::string text(64, 'x');
+    BufferSource source{text};
+    for (int depth = 0; depth < 40; ++depth) {
+      source.save();
+      source.next();
+    }
+    for (int depth = 39; depth >= 0; --depth) {
+      source.restore();
+      REQUIRE(source.position() == static_cast<std::size_t>(depth));
+      REQUIRE(source.getPosition().second == static_cast<unsigned long>(depth + 1));
+    }
+    for (int round = 0; round < 2; ++round) {
+      source.save();
+      source.skip(10);
+      source.save();
+      source.next();
+      source.discardSave();
+      source.restore();
+      REQUIRE(source.position() == 0);
+    }
+  }
   SECTION("Create BufferSource with empty buffer.",
           "[YAML][ISource][Buffer][Construct]") {
     BufferSource source("");
@@ -1,5 +1,17 @@
 #include "YAML_Lib_Tests.hpp"
 
+// Stream buffer that cannot seek (like a pipe or std::cin).
+class NonSeekableBuffer final : public std::streambuf {
+public:
+  explicit NonSeekableBuffer(std::string text) : text(std::move(text)) {
+    setg(this->text.data(), this->text.data(),
+         this->text.data() + this->text.size());
+  }
+
+private:
+  std::string text;
+};
+
 TEST_CASE("Check ISource (Stream) interface.", "[YAML][ISource][Stream]") {
   SECTION("Create StreamSource from a std::istringstream.",
           "[YAML][ISource][Stream][Construct]") {
@@ -110,4 +122,74 @@ TEST_CASE("Check ISource (Stream) interface.", "[YAML][ISource][Stream]") {
     REQUIRE_FALSE(source.more());
     REQUIRE_THROWS_AS(source.next(), ISource::Error);
   }
+  SECTION("Create StreamSource with a zero chunk size throws.",
+          "[YAML][ISource][Stream][Construct][Exception]") {
+    std::istringstream ss{"x"};
+    REQUIRE_THROWS_AS(StreamSource(ss, 0), ISource::Error);
+  }
+  SECTION("Check StreamSource normalises CR/LF split across chunks.",
+          "[YAML][ISource][Stream][Chunk]") {
+    std::istringstream ss{"a\r\nb\rc"};
+    StreamSource source{ss, 2};
+    std::string text;
+    while (source.more()) {
+      text += source.append();
+    }
+    REQUIRE(text == "a\nb\nc");
+    REQUIRE(source.getPosition().first == 3);
+  }
+  SECTION("Check StreamSource restore() across many chunks.",
+          "[YAML][ISource][Stream][Chunk][Save][Restore]") {
+    std::istringstream ss{"abcdefghijklmnopqrstuvwxyz"};
+    StreamSource source{ss, 3};
+    source.next();
+    source.save();
+    for (int i = 0; i < 20; ++i) {
+      source.next();
+    }
+    REQUIRE(source.current() == 'v');
+    source.restore();
+    REQUIRE(source.current() == 'b');
+    REQUIRE(source.position() == 1);
+  }
+  SECTION("Parse YAML from a non-seekable stream in small chunks.",
+          "[YAML][ISource][Stream][Chunk][Parse]") {
+    const std::string text{
+        "---\nname: Alice\nitems: [1, 2, 3]\nnote: |\n  line one\n  line "
+        "two\n...\n"};
+    const YAML expected;
+    expected.parse(BufferSource{text});
+    for (const std::size_t chunkSize : {1, 2, 7, 64}) {
+      NonSeekableBuffer buffer{text};
+      std::istream stream{&buffer};
+      const YAML yaml;
+      REQUIRE_NOTHROW(yaml.parse(StreamSource{stream, chunkSize}));
+      BufferDestination expectedYAML;
+      BufferDestination actualYAML;
+      expected.stringify(expectedYAML);
+      yaml.stringify(actualYAML);
+      REQUIRE(actualYAML.toString() == expectedYAML.toString());
+    }
+  }
+  SECTION("Reset a non-seekable StreamSource after its start is discarded throws.",
+          "[YAML][ISource][Stream][Chunk][Reset][Exception]") {
+    NonSeekableBuffer buffer{std::string(1024, 'x')};
+    std::istream stream{&buffer};
+    StreamSource source{stream, 16};
+    while (source.more()) {
+      source.next();
+    }
+    REQUIRE_THROWS_AS(source.reset(), ISource::Error);
+  }
+  SECTION("Reset a seekable StreamSource after its start is discarded.",
+          "[YAML][ISource][Stream][Chunk][Reset]") {
+    std::istringstream ss{"a" + std::string(1024, 'x')};
+    StreamSource source{ss, 16};
+    while (source.more()) {
+      source.next();
+    }
+    source.reset();
+    REQUIRE(source.position() == 0);
+    REQUIRE(source.current() == 'a');
+  }
 }
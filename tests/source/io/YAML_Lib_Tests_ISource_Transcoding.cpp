@@ -0,0 +1,94 @@
+#include "YAML_Lib_Tests.hpp"
+
+#ifdef YAML_LIB_FILE_IO
+// ============================================================================
+// TranscodingSource: parse files in any YAML::Format without a full copy.
+// ============================================================================
+
+static const std::string kTranscodeYAML{
+    "name: caf\xC3\xA9\r\nprice: \"\xE2\x82\xAC" "5\"\r\nemoji: \xF0\x9F\x98\x80\n"
+    "list:\n  - one\r\n  - two\n"};
+
+static std::string stringifyParse(ISource &&source) {
+  const YAML yaml;
+  yaml.parse(source);
+  BufferDestination destination;
+  yaml.stringify(destination);
+  return destination.toString();
+}
+
+TEST_CASE("Check ISource (Transcoding) interface.",
+          "[YAML][ISource][Transcoding]") {
+  const std::string expected{stringifyParse(BufferSource{
+      YAML::fromFile(prefixTestDataPath(kSingleYAMLFile))})};
+  SECTION("Parse test file in every format and chunk size.",
+          "[YAML][ISource][Transcoding][Parse]") {
+    const std::string text{YAML::fromFile(prefixTestDataPath(kSingleYAMLFile))};
+    for (const auto format :
+         {YAML::Format::utf8, YAML::Format::utf8BOM, YAML::Format::utf16BE,
+          YAML::Format::utf16LE, YAML::Format::utf32BE,
+          YAML::Format::utf32LE}) {
+      const std::string testFileName{generateRandomFileName()};
+      YAML::toFile(testFileName, text, format);
+      for (const std::size_t chunkSize : {1, 3, 7, 4096}) {
+        REQUIRE(stringifyParse(TranscodingSource{testFileName, chunkSize}) ==
+                expected);
+      }
+      std::filesystem::remove(testFileName);
+    }
+  }
+  SECTION("Non-ASCII text and CR/LF are decoded and normalised.",
+          "[YAML][ISource][Transcoding][Unicode]") {
+    const std::string normalised{stringifyParse(BufferSource{
+        "name: caf\xC3\xA9\nprice: \"\xE2\x82\xAC" "5\"\nemoji: \xF0\x9F\x98\x80\n"
+        "list:\n  - one\n  - two\n"})};
+    for (const auto format : {YAML::Format::utf16LE, YAML::Format::utf32BE}) {
+      const std::string testFileName{generateRandomFileName()};
+      YAML::toFile(testFileName, kTranscodeYAML, format);
+      REQUIRE(stringifyParse(TranscodingSource{testFileName, 5}) == normalised);
+      std::filesystem::remove(testFileName);
+    }
+  }
+  SECTION("Reset after the start of the file has left the window.",
+          "[YAML][ISource][Transcoding][Reset]") {
+    const std::string testFileName{generateRandomFileName()};
+    YAML::toFile(testFileName, kTranscodeYAML, YAML::Format::utf16BE);
+    TranscodingSource source{testFileName, 2};
+    std::string first;
+    while (source.more()) {
+      first += source.current();
+      source.next();
+    }
+    source.reset();
+    std::string second;
+    while (source.more()) {
+      second += source.current();
+      source.next();
+    }
+    REQUIRE(first == second);
+    REQUIRE(first.starts_with("name: caf\xC3\xA9\n"));
+    std::filesystem::remove(testFileName);
+  }
+  SECTION("StreamSource decodes an encoded std::istream.",
+          "[YAML][ISource][Transcoding][Stream]") {
+    std::string bytes{"\xFF\xFE"};
+    encodeUtf16("key: value\n", std::endian::little, bytes);
+    std::istringstream stream{bytes};
+    REQUIRE(stringifyParse(StreamSource{stream, YAML::Format::utf16LE, 3}) ==
+            "---\nkey: value\n...\n");
+  }
+  SECTION("Truncated UTF-16 file throws.",
+          "[YAML][ISource][Transcoding][Exception]") {
+    const std::string testFileName{generateRandomFileName()};
+    std::ofstream{testFileName, std::ios::binary} << std::string("\xFE\xFF\x00" "a\x00", 5);
+    REQUIRE_THROWS_WITH(TranscodingSource(testFileName, 64),
+                        "YAML Error: Truncated UTF-16 data.");
+    std::filesystem::remove(testFileName);
+  }
+  SECTION("Missing file throws.", "[YAML][ISource][Transcoding][Exception]") {
+    REQUIRE_THROWS_WITH(
+        TranscodingSource(prefixTestDataPath(kNonExistantYAMLFile)),
+        "ISource Error: File input stream failed to open or does not exist.");
+  }
+}
+#endif // YAML_LIB_FILE_IO
@@ -0,0 +1,367 @@
+#include "YAML_Lib_Tests.hpp"
+
+#include <cstdint>
+
+// ============================================================================
+// AllocationCounter: PMR allocation accounting and arena size recommendation.
+// ============================================================================
+
+static constexpr std::string_view kAllocationYAML{
+    "name: Alice\n"
+    "tags: [a, b, c, d, e]\n"
+    "address:\n"
+    "  street: 1 Main Street\n"
+    "  city: Springfield\n"
+    "scores:\n"
+    "  - 1\n"
+    "  - 2\n"
+    "  - 3\n"};
+
+// String heavy: every value, key, tag and comment is too long for the small
+// string buffer.
+static constexpr std::string_view kStringYAML{
+    "# a comment that is long enough to need its own storage\n"
+    "a key longer than the small string buffer: a plain value just as long\n"
+    "quoted: \"a double quoted string with an \\t escape in it\"\n"
+    "tagged: !local/type a value carrying a long local tag\n"
+    "created: 2001-12-14t21:59:43.10-05:00\n"
+    "block: |\n"
+    "  the first line of a literal block string\n"
+    "  and the second line of the same block\n"
+    "list: [another long plain string element, 'and a single quoted one']\n"};
+
+// Parse with a MonotonicArena<N> equivalent sized at run time: a pool over a
+// monotonic buffer of the given capacity with no upstream.
+static void parseInArena(ISource &source, const std::size_t capacity) {
+  const std::unique_ptr<std::byte[]> buffer{new std::byte[capacity]};
+  std::pmr::monotonic_buffer_resource monotonic{buffer.get(), capacity,
+                                                std::pmr::null_memory_resource()};
+  std::pmr::unsynchronized_pool_resource pool{&monotonic};
+  const YAML yaml{&pool};
+  yaml.parse(source);
+}
+
+TEST_CASE("Check AllocationCounter statistics.", "[YAML][Allocation]") {
+  AllocationCounter counter;
+  Options options;
+  options.memory_resource = &counter;
+  SECTION("Nothing is counted before use.", "[YAML][Allocation]") {
+    const auto statistics = counter.getStatistics();
+    REQUIRE(statistics.allocations == 0);
+    REQUIRE(statistics.bytes == 0);
+    REQUIRE(statistics.peakBytes == 0);
+    REQUIRE(counter.upstream() == std::pmr::new_delete_resource());
+  }
+  SECTION("Parsing counts allocations by container kind.", "[YAML][Allocation]") {
+    {
+      const YAML yaml{options};
+      yaml.parse(BufferSource{kAllocationYAML});
+      const auto statistics = counter.getStatistics();
+      REQUIRE(statistics.allocations > 0);
+      REQUIRE(statistics.liveBytes > 0);
+      REQUIRE(statistics.peakBytes >= statistics.liveBytes);
+      REQUIRE(statistics.bytes >= statistics.peakBytes);
+      REQUIRE(statistics[AllocationKind::sequences].allocations > 0);
+      REQUIRE(statistics[AllocationKind::dictionaryEntries].allocations > 0);
+      REQUIRE(statistics[AllocationKind::dictionaryIndex].allocations > 0);
+      REQUIRE(statistics[AllocationKind::containers].allocations > 0);
+      uint64_t kindAllocations{};
+      uint64_t kindBytes{};
+      for (const auto &kind : statistics.kinds) {
+        kindAllocations += kind.allocations;
+        kindBytes += kind.bytes;
+      }
+      REQUIRE(kindAllocations == statistics.allocations);
+      REQUIRE(kindBytes == statistics.bytes);
+      uint64_t histogramAllocations{};
+      for (const auto bucket : statistics.histogram) {
+        histogramAllocations += bucket;
+      }
+      REQUIRE(histogramAllocations == statistics.allocations);
+    }
+    const auto statistics = counter.getStatistics();
+    REQUIRE(statistics.liveBytes == 0);
+    REQUIRE(statistics.deallocations == statistics.allocations);
+  }
+  SECTION("Byte aligned allocations are counted as strings.", "[YAML][Allocation]") {
+    {
+      std::pmr::string text{"a string too long for the small string buffer",
+                            &counter};
+      REQUIRE(counter.getStatistics()[AllocationKind::strings].allocations == 1);
+    }
+    std::pmr::vector<int> numbers{{1, 2, 3}, &counter};
+    const auto statistics = counter.getStatistics();
+    REQUIRE(statistics[AllocationKind::other].allocations == 1);
+    REQUIRE(statistics.liveBytes == 3 * sizeof(int));
+  }
+  SECTION("AllocationScope tags allocations and restores the previous kind.",
+          "[YAML][Allocation]") {
+    {
+      AllocationScope outer{AllocationKind::sequences};
+      {
+        AllocationScope inner{AllocationKind::dictionaryIndex};
+        REQUIRE(currentAllocationKind == AllocationKind::dictionaryIndex);
+        std::pmr::vector<int> numbers{{1}, &counter};
+      }
+      REQUIRE(currentAllocationKind == AllocationKind::sequences);
+    }
+    REQUIRE(currentAllocationKind == AllocationKind::other);
+    REQUIRE(counter.getStatistics()[AllocationKind::dictionaryIndex].allocations == 1);
+  }
+  SECTION("Reset zeroes the counters but keeps live bytes balanced.",
+          "[YAML][Allocation]") {
+    {
+      std::pmr::vector<int> numbers{{1, 2}, &counter};
+      counter.resetStatistics();
+      REQUIRE(counter.getStatistics().allocations == 0);
+      REQUIRE(counter.getStatistics().liveBytes == 2 * sizeof(int));
+    }
+    REQUIRE(counter.getStatistics().deallocations == 1);
+    REQUIRE(counter.getStatistics().liveBytes == 0);
+  }
+  SECTION("Counter can wrap an arena.", "[YAML][Allocation]") {
+    MonotonicArena<65536> arena;
+    AllocationCounter arenaCounter{arena.resource()};
+    const YAML yaml{&arenaCounter};
+    yaml.parse(BufferSource{kAllocationYAML});
+    REQUIRE(arenaCounter.getStatistics().allocations > 0);
+  }
+}
+
+TEST_CASE("Check AllocationCounter histogram buckets.", "[YAML][Allocation]") {
+  REQUIRE(AllocationCounter::histogramBucket(1) == 0);
+  REQUIRE(AllocationCounter::histogramBucket(16) == 0);
+  REQUIRE(AllocationCounter::histogramBucket(17) == 1);
+  REQUIRE(AllocationCounter::histogramBucket(32) == 1);
+  REQUIRE(AllocationCounter::histogramBucket(33) == 2);
+  REQUIRE(AllocationCounter::histogramBucket(32768) == 11);
+  REQUIRE(AllocationCounter::histogramBucket(32769) == 12);
+  REQUIRE(AllocationCounter::histogramBucket(1 << 30) ==
+          AllocationCounter::kHistogramBuckets - 1);
+}
+
+TEST_CASE("Check ChainedArena.", "[YAML][Allocation][Arena]") {
+  AllocationCounter upstream;
+  SECTION("Blocks are chained on as the arena fills.", "[YAML][Allocation][Arena]") {
+    ChainedArena arena{1024, &upstream};
+    REQUIRE(arena.capacity() == 0);
+    REQUIRE(arena.upstream() == &upstream);
+    void *first = arena.resource()->allocate(100, 8);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(first) % 8 == 0);
+    REQUIRE(upstream.getStatistics().allocations == 1);
+    REQUIRE(arena.capacity() == 1024);
+    for (int allocation = 0; allocation < 20; ++allocation) {
+      REQUIRE(reinterpret_cast<std::uintptr_t>(arena.resource()->allocate(100, 16)) % 16 == 0);
+    }
+    REQUIRE(upstream.getStatistics().allocations == 2);
+    REQUIRE(arena.capacity() == 1024 + 2048);
+    arena.resource()->deallocate(first, 100, 8);
+    REQUIRE(upstream.getStatistics().deallocations == 0);
+  }
+  SECTION("An allocation larger than the next block gets a block of its own.",
+          "[YAML][Allocation][Arena]") {
+    ChainedArena arena{1024, &upstream};
+    REQUIRE_NOTHROW(arena.resource()->allocate(100000, 8));
+    REQUIRE(arena.capacity() > 100000);
+  }
+  SECTION("Reset keeps the blocks for reuse.", "[YAML][Allocation][Arena]") {
+    ChainedArena arena{1024, &upstream};
+    const auto fill = [&arena] {
+      for (int allocation = 0; allocation < 20; ++allocation) {
+        (void)arena.resource()->allocate(100, 8);
+      }
+    };
+    fill();
+    auto statistics = arena.getStatistics();
+    REQUIRE(statistics.blocks == 2);
+    REQUIRE(statistics.upstreamAllocations == 2);
+    REQUIRE(statistics.used >= 2000);
+    const std::size_t used = statistics.used;
+    for (int reset = 0; reset < 3; ++reset) {
+      arena.reset();
+      REQUIRE(arena.getStatistics().used == 0);
+      fill();
+    }
+    statistics = arena.getStatistics();
+    REQUIRE(statistics.resets == 3);
+    REQUIRE(statistics.blocks == 2);
+    REQUIRE(statistics.upstreamAllocations == 2);
+    REQUIRE(statistics.used == used);
+    REQUIRE(statistics.highWater == used);
+    REQUIRE(upstream.getStatistics().allocations == 2);
+    arena.reset();
+    REQUIRE_NOTHROW(arena.resource()->allocate(100000, 8));
+    REQUIRE(arena.getStatistics().blocks == 3);
+    arena.release();
+    REQUIRE(arena.getStatistics().blocks == 0);
+    REQUIRE(upstream.getStatistics().liveBytes == 0);
+  }
+  SECTION("Release returns every block.", "[YAML][Allocation][Arena]") {
+    {
+      ChainedArena arena{1024, &upstream};
+      const YAML yaml{arena.resource()};
+      yaml.parse(BufferSource{kAllocationYAML});
+      REQUIRE(upstream.getStatistics().allocations > 0);
+      REQUIRE(upstream.getStatistics().liveBytes == arena.capacity());
+    }
+    REQUIRE(upstream.getStatistics().liveBytes == 0);
+    REQUIRE(upstream.getStatistics().deallocations ==
+            upstream.getStatistics().allocations);
+  }
+}
+
+TEST_CASE("Check Options::arena_tree.", "[YAML][Allocation][Arena]") {
+  AllocationCounter upstream;
+  Options options;
+  options.memory_resource = &upstream;
+  options.arena_tree = true;
+  SECTION("Containers come from arena blocks.", "[YAML][Allocation][Arena]") {
+    {
+      const YAML yaml{options};
+      yaml.parse(BufferSource{kAllocationYAML});
+      const auto statistics = upstream.getStatistics();
+      // One 64 KiB block holds the whole tree.
+      REQUIRE(statistics.allocations == 1);
+      REQUIRE(statistics.liveBytes == ChainedArena::kDefaultBlockSize);
+      REQUIRE(NRef<String>(yaml["address"]["city"]).value() == "Springfield");
+      REQUIRE(NRef<Array>(yaml["tags"]).size() == 5);
+    }
+    REQUIRE(upstream.getStatistics().liveBytes == 0);
+  }
+  SECTION("Parsing again releases the previous tree's blocks.",
+          "[YAML][Allocation][Arena]") {
+    const YAML yaml{options};
+    for (int parse = 0; parse < 3; ++parse) {
+      yaml.parse(BufferSource{kAllocationYAML});
+      REQUIRE(upstream.getStatistics().liveBytes == ChainedArena::kDefaultBlockSize);
+    }
+    const YAML heapYAML;
+    heapYAML.parse(BufferSource{kAllocationYAML});
+    BufferDestination arenaText;
+    BufferDestination heapText;
+    yaml.stringify(arenaText);
+    heapYAML.stringify(heapText);
+    REQUIRE(arenaText.toString() == heapText.toString());
+  }
+  SECTION("Reparsing reuses the arena blocks.", "[YAML][Allocation][Arena]") {
+    std::string yamlText;
+    for (int key = 0; key < 2000; ++key) {
+      yamlText += "key" + std::to_string(key) + ": [" + std::to_string(key) + "]\n";
+    }
+    const YAML yaml{options};
+    yaml.reparse(BufferSource{yamlText});
+    const auto blocks = upstream.getStatistics().allocations;
+    REQUIRE(blocks > 1);
+    for (int parse = 0; parse < 3; ++parse) {
+      yaml.reparse(BufferSource{yamlText});
+      REQUIRE(NRef<Dictionary>(yaml.document(0)).size() == 2000);
+    }
+    REQUIRE(upstream.getStatistics().allocations == blocks);
+    REQUIRE(upstream.getStatistics().deallocations == 0);
+    REQUIRE(yaml.arena() != nullptr);
+    const auto statistics = yaml.arena()->getStatistics();
+    REQUIRE(statistics.resets == 4);
+    REQUIRE(statistics.upstreamAllocations == blocks);
+    REQUIRE(statistics.highWater == statistics.used);
+    REQUIRE(statistics.used <= statistics.capacity);
+  }
+  SECTION("A tree larger than the first block grows the arena.",
+          "[YAML][Allocation][Arena]") {
+    std::string yamlText;
+    for (int key = 0; key < 5000; ++key) {
+      yamlText += "key" + std::to_string(key) + ": [" + std::to_string(key) + "]\n";
+    }
+    const YAML yaml{options};
+    yaml.parse(BufferSource{yamlText});
+    REQUIRE(upstream.getStatistics().allocations > 1);
+    REQUIRE(NRef<Dictionary>(yaml.document(0)).size() == 5000);
+  }
+}
+
+TEST_CASE("Check arena tree teardown.", "[YAML][Allocation][Arena]") {
+  Options options;
+  options.arena_tree = true;
+  YAML yaml{options};
+  // Deallocations the arena sees while a tree is dropped and "---" parsed.
+  const auto teardown = [&yaml] {
+    const auto before = yaml.arena()->getStatistics().deallocations;
+    yaml.reparse(BufferSource{"---\n"});
+    return yaml.arena()->getStatistics().deallocations - before;
+  };
+  yaml.reparse(BufferSource{"---\n"});
+  const auto emptyTeardown = teardown();
+  SECTION("A tree only read through const access is not walked.",
+          "[YAML][Allocation][Arena]") {
+    yaml.reparse(BufferSource{kStringYAML});
+    REQUIRE(NRef<String>(std::as_const(yaml)["tagged"]).value() ==
+            "a value carrying a long local tag");
+    REQUIRE(teardown() == emptyTeardown);
+  }
+  SECTION("A tree given out for update is destroyed node by node.",
+          "[YAML][Allocation][Arena]") {
+    yaml.reparse(BufferSource{kStringYAML});
+    REQUIRE(NRef<String>(yaml["quoted"]).value().starts_with("a double"));
+    REQUIRE(teardown() > emptyTeardown);
+  }
+  SECTION("Nodes attached after parsing are destroyed.", "[YAML][Allocation][Arena]") {
+    yaml.reparse(BufferSource{kStringYAML});
+    AllocationCounter counter;
+    {
+      auto *previous = std::pmr::set_default_resource(&counter);
+      yaml["extra"] = "a string long enough to need storage of its own";
+      std::pmr::set_default_resource(previous);
+    }
+    REQUIRE(counter.getStatistics().liveBytes > 0);
+    yaml.reparse(BufferSource{"---\n"});
+    REQUIRE(counter.getStatistics().liveBytes == 0);
+  }
+}
+
+TEST_CASE("Check reparse without an arena tree.", "[YAML][Allocation][Arena]") {
+  const YAML yaml;
+  REQUIRE(yaml.arena() == nullptr);
+  yaml.parse(BufferSource{"[1, 2]"});
+  yaml.reparse(BufferSource{kAllocationYAML});
+  REQUIRE(yaml.getNumberOfDocuments() == 1);
+  REQUIRE(NRef<String>(yaml["name"]).value() == "Alice");
+}
+
+TEST_CASE("Check recommendArenaSize.", "[YAML][Allocation]") {
+  SECTION("Recommended size is enough to parse the same input.",
+          "[YAML][Allocation]") {
+    const std::size_t size = recommendArenaSize(BufferSource{kAllocationYAML});
+    REQUIRE(size > 0);
+    REQUIRE(size % 1024 == 0);
+    BufferSource source{kAllocationYAML};
+    REQUIRE_NOTHROW(parseInArena(source, size));
+  }
+  SECTION("An arena smaller than the tree runs out of memory.",
+          "[YAML][Allocation]") {
+    AllocationCounter counter;
+    {
+      const YAML yaml{&counter};
+      yaml.parse(BufferSource{kAllocationYAML});
+    }
+    const auto bytes = static_cast<std::size_t>(counter.getStatistics().bytes);
+    REQUIRE(recommendArenaSize(BufferSource{kAllocationYAML}) >= bytes);
+    // A single block with no pool in front of it is asked for every one of
+    // those bytes (plus any alignment padding), so one byte less is too few.
+    const std::unique_ptr<std::byte[]> buffer{new std::byte[bytes - 1]};
+    std::pmr::monotonic_buffer_resource block{buffer.get(), bytes - 1,
+                                              std::pmr::null_memory_resource()};
+    const YAML yaml{&block};
+    REQUIRE_THROWS_AS(yaml.parse(BufferSource{kAllocationYAML}), std::bad_alloc);
+  }
+  SECTION("Parse errors are passed on.", "[YAML][Allocation]") {
+    REQUIRE_THROWS_AS(recommendArenaSize(BufferSource{"[1, 2"}), SyntaxError);
+  }
+#ifdef YAML_LIB_FILE_IO
+  SECTION("Recommended size holds each test file.", "[YAML][Allocation]") {
+    TEST_FILE_LIST(testFile);
+    const std::size_t size =
+        recommendArenaSize(FileSource{prefixTestDataPath(testFile)});
+    FileSource source{prefixTestDataPath(testFile)};
+    REQUIRE_NOTHROW(parseInArena(source, size));
+  }
+#endif
+}
@@ -14,6 +14,18 @@ TEST_CASE("YAML::Options enables strict boolean parsing", "[YAML][Options][Parse
   ::YAML_Lib::YAML::setStrictBooleans(false);
 }
 
+TEST_CASE("YAML::Options strict booleans apply to that object only", "[YAML][Options][Parse]") {
+  ::YAML_Lib::Options options;
+  options.strict_booleans = true;
+  const ::YAML_Lib::YAML strict(options);
+  const ::YAML_Lib::YAML permissive{::YAML_Lib::Options()};
+
+  strict.parse(::YAML_Lib::BufferSource{"%YAML 1.1\n---\nvalue: yes\n"});
+  permissive.parse(::YAML_Lib::BufferSource{"%YAML 1.1\n---\nvalue: yes\n"});
+  REQUIRE(::YAML_Lib::isA<::YAML_Lib::String>(strict.document(0)["value"]));
+  REQUIRE(::YAML_Lib::isA<::YAML_Lib::Boolean>(permissive.document(0)["value"]));
+}
+
 TEST_CASE("YAML::Options enforces maxDocuments during parsing", "[YAML][Options][Parse]") {
   ::YAML_Lib::Options options;
   options.max_documents = 1;
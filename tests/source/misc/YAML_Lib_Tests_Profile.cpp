@@ -0,0 +1,126 @@
+#ifdef YAML_LIB_PROFILE
+#include "YAML_Lib_Tests.hpp"
+
+// ============================================================================
+// ParseProfile: Default_Parser production, backtrack and re-parse counters.
+// ============================================================================
+
+static const ParseProfile::Production &
+findProduction(const ParseProfile &profile, const std::string_view name) {
+  const auto production =
+      std::ranges::find(profile.productions, name, &ParseProfile::Production::name);
+  REQUIRE(production != profile.productions.end());
+  return *production;
+}
+// Times a production matched and produced a node.
+static uint64_t parsed(const ParseProfile &profile, const std::string_view name) {
+  const auto &production = findProduction(profile, name);
+  return production.matches - production.misses;
+}
+
+TEST_CASE("Check ParseProfile production counters.", "[YAML][Parse][Profile]") {
+  auto *parser = makeParser<Default_Parser>(std::make_unique<Default_Translator>());
+  const auto &profile = dynamic_cast<Default_Parser &>(*parser).getProfile();
+  const YAML yaml(nullptr, parser);
+  SECTION("One entry per router production, all zero before parsing.",
+          "[YAML][Parse][Profile]") {
+    REQUIRE(profile.productions.size() == 16);
+    REQUIRE(profile.productions.front().name == "array");
+    REQUIRE(profile.productions.back().name == "plain");
+    REQUIRE(profile.parses == 0);
+    REQUIRE(std::ranges::all_of(profile.productions, [](const auto &production) {
+      return production.probes == 0 && production.nanoseconds == 0;
+    }));
+  }
+  SECTION("Matched productions record the bytes they consumed.",
+          "[YAML][Parse][Profile]") {
+    yaml.parse(BufferSource{"- 1\n- true\n- text\n"});
+    REQUIRE(profile.parses == 1);
+    const auto &array = findProduction(profile, "array");
+    REQUIRE(array.matches == 1);
+    REQUIRE(array.bytes == 18);
+    REQUIRE(parsed(profile, "number") == 1);
+    REQUIRE(parsed(profile, "boolean") == 1);
+    REQUIRE(parsed(profile, "plain") == 1);
+    REQUIRE(findProduction(profile, "boolean").misses == 1);
+    REQUIRE(findProduction(profile, "dictionary").matches == 0);
+    REQUIRE(findProduction(profile, "dictionary").probes > 0);
+  }
+  SECTION("Anchors and aliases are re-parsed from a buffer.",
+          "[YAML][Parse][Profile]") {
+    yaml.parse(BufferSource{"a: &x 1\nb: *x\nc: *x\n"});
+    REQUIRE(profile.aliasExpansions == 2);
+    REQUIRE(profile.reparses >= 3);
+    REQUIRE(profile.reparseBytes > 0);
+  }
+  SECTION("Single line keys and tagged scalars are not re-parsed.",
+          "[YAML][Parse][Profile]") {
+    yaml.parse(BufferSource{"\"a\\tb\": 1\n'it''s': 2\nplain key: !!int \"3\"\n"
+                            "? [x]\n: 4\n"});
+    REQUIRE(profile.reparses == 1); // only the inline collection key
+    const auto &root = NRef<Dictionary>(yaml.document(0));
+    REQUIRE(root.contains("a\tb"));
+    REQUIRE(root.contains("it's"));
+    REQUIRE(isA<Number>(root["plain key"]));
+  }
+  SECTION("Flow collection elements bypass the productions.",
+          "[YAML][Parse][Profile]") {
+    yaml.parse(BufferSource{"[1, \"a\", [true], {k: v}, x]"});
+    // 1, "a", [true], true, {k: v} and the key k; v and x are plain scalars.
+    REQUIRE(profile.flowElements == 6);
+    REQUIRE(parsed(profile, "plain") == 2);
+    REQUIRE(findProduction(profile, "inlineArray").matches == 1);
+    REQUIRE(parsed(profile, "number") == 0);
+  }
+  SECTION("Only productions that can start with the first byte are probed.",
+          "[YAML][Parse][Profile]") {
+    yaml.parse(BufferSource{"- 1\n- text\n"});
+    REQUIRE(findProduction(profile, "number").probes == 1);
+    REQUIRE(findProduction(profile, "boolean").probes == 1);
+    REQUIRE(findProduction(profile, "quotedString").probes == 0);
+    REQUIRE(findProduction(profile, "inlineArray").probes == 0);
+    REQUIRE(findProduction(profile, "anchor").probes == 0);
+    REQUIRE(findProduction(profile, "tagged").probes == 0);
+    REQUIRE(parsed(profile, "plain") == 1);
+  }
+  SECTION("Rejected lookahead is counted as a restore.", "[YAML][Parse][Profile]") {
+    yaml.parse(BufferSource{"key: 12abc\n"});
+    REQUIRE(profile.restores > 0);
+    REQUIRE(profile.backtrackBytes > 0);
+  }
+  SECTION("Counters accumulate until reset.", "[YAML][Parse][Profile]") {
+    yaml.parse(BufferSource{"[1, 2]"});
+    yaml.parse(BufferSource{"[3, 4]"});
+    REQUIRE(profile.parses == 2);
+    REQUIRE(findProduction(profile, "inlineArray").matches == 2);
+    dynamic_cast<Default_Parser &>(*parser).resetProfile();
+    REQUIRE(profile.parses == 0);
+    REQUIRE(findProduction(profile, "inlineArray").matches == 0);
+    REQUIRE(profile.productions.size() == 16);
+  }
+}
+
+TEST_CASE("Check ParseProfile report and JSON output.", "[YAML][Parse][Profile]") {
+  auto *parser = makeParser<Default_Parser>(std::make_unique<Default_Translator>());
+  const auto &profile = dynamic_cast<Default_Parser &>(*parser).getProfile();
+  const YAML yaml(nullptr, parser);
+  yaml.parse(BufferSource{"a: &x [1, 2]\nb: *x\n"});
+  SECTION("Text report lists every production and the totals.",
+          "[YAML][Parse][Profile]") {
+    const std::string report{profile.report()};
+    REQUIRE_THAT(report, Catch::Matchers::ContainsSubstring("Parses: 1"));
+    REQUIRE_THAT(report, Catch::Matchers::ContainsSubstring("inlineArray"));
+    REQUIRE_THAT(report, Catch::Matchers::ContainsSubstring("Alias expansions: 1"));
+  }
+  SECTION("JSON output parses back with the same counters.",
+          "[YAML][Parse][Profile]") {
+    const YAML json;
+    json.parse(BufferSource{profile.toJSON()});
+    auto &root = json.document(0);
+    REQUIRE(NRef<Number>(root["parses"]).value<int>() == 1);
+    REQUIRE(NRef<Number>(root["aliasExpansions"]).value<int>() == 1);
+    REQUIRE(NRef<Array>(root["productions"]).size() == 16);
+    REQUIRE(NRef<String>(root["productions"][0]["name"]).value() == "array");
+  }
+}
+#endif // YAML_LIB_PROFILE
@@ -0,0 +1,127 @@
+#include "YAML_Lib_Tests.hpp"
+#include "JSON_Stringify.hpp"
+#include "YAML_Snapshot.hpp"
+
+#include <thread>
+
+// ============================================================================
+// Snapshot: immutable trees shared between threads, swapped by AtomicSnapshot.
+// ============================================================================
+
+static constexpr std::string_view kSnapshotYAML{"version: 1\n"
+                                                "listen: [80, 443]\n"
+                                                "name: \"front end\"\n"};
+
+static std::string stringify(const Snapshot &snapshot) {
+  BufferDestination destination;
+  snapshot.stringify(destination);
+  return destination.toString();
+}
+
+TEST_CASE("Check Snapshot.", "[YAML][Snapshot]") {
+  SECTION("Parse a source into a snapshot.", "[YAML][Snapshot]") {
+    const auto snapshot = Snapshot::make(BufferSource{kSnapshotYAML});
+    REQUIRE(snapshot->getNumberOfDocuments() == 1);
+    REQUIRE(NRef<Number>((*snapshot)["version"]).value<int>() == 1);
+    REQUIRE(NRef<Number>(snapshot->document(0)["listen"][1]).value<int>() == 443);
+    const YAML yaml;
+    yaml.parse(BufferSource{kSnapshotYAML});
+    BufferDestination destination;
+    yaml.stringify(destination);
+    REQUIRE(stringify(*snapshot) == destination.toString());
+  }
+  SECTION("Reading a missing key or index leaves the tree unchanged.",
+          "[YAML][Snapshot]") {
+    const auto snapshot = Snapshot::make(BufferSource{kSnapshotYAML});
+    const std::string before{stringify(*snapshot)};
+    REQUIRE_THROWS_AS((*snapshot)["missing"], Node::Error);
+    REQUIRE_THROWS_AS(snapshot->document(0)["listen"][5], Node::Error);
+    REQUIRE_THROWS_WITH(snapshot->document(1), "YAML Error: Document does not exist.");
+    REQUIRE(stringify(*snapshot) == before);
+  }
+  SECTION("A snapshot of a YAML object is a copy.", "[YAML][Snapshot]") {
+    YAML yaml;
+    yaml.parse(BufferSource{kSnapshotYAML});
+    const auto snapshot = Snapshot::make(yaml);
+    yaml["version"] = 2;
+    yaml["extra"] = "added";
+    REQUIRE(NRef<Number>((*snapshot)["version"]).value<int>() == 1);
+    REQUIRE_FALSE(NRef<Dictionary>(snapshot->document(0)).contains("extra"));
+  }
+  SECTION("A snapshot can be stringified with the stringifier it was made with.",
+          "[YAML][Snapshot]") {
+    Options options;
+    options.stringifier = makeStringify<JSON_Stringify>();
+    const auto snapshot = Snapshot::make(BufferSource{kSnapshotYAML}, options);
+    REQUIRE(stringify(*snapshot) ==
+            R"({"version":1,"listen":[80,443],"name":"front end"})");
+  }
+  SECTION("A copy stringifies with the stringifier given for it.", "[YAML][Snapshot]") {
+    Options jsonOptions;
+    jsonOptions.stringifier = makeStringify<JSON_Stringify>();
+    const YAML json{jsonOptions};
+    json.parse(BufferSource{kSnapshotYAML});
+    Options copyOptions;
+    copyOptions.stringifier = makeStringify<JSON_Stringify>();
+    copyOptions.arena_tree = true;
+    REQUIRE(stringify(*Snapshot::make(json, copyOptions)) ==
+            R"({"version":1,"listen":[80,443],"name":"front end"})");
+    REQUIRE_FALSE(stringify(*Snapshot::make(json)).starts_with("{"));
+  }
+}
+
+TEST_CASE("Check AtomicSnapshot.", "[YAML][Snapshot]") {
+  SECTION("Store and exchange replace the current snapshot.", "[YAML][Snapshot]") {
+    AtomicSnapshot current;
+    REQUIRE(current.load() == nullptr);
+    const auto first = Snapshot::make(BufferSource{"version: 1\n"});
+    current.store(first);
+    REQUIRE(current.load() == first);
+    const auto previous = current.exchange(Snapshot::make(BufferSource{"version: 2\n"}));
+    REQUIRE(previous == first);
+    REQUIRE(NRef<Number>((*current.load())["version"]).value<int>() == 2);
+  }
+  SECTION("Readers see whole snapshots while another thread reloads.",
+          "[YAML][Snapshot]") {
+    // Each version's list holds version copies of the version number, so a
+    // reader can tell a whole tree from a mixed one.
+    const auto makeVersion = [](const int version) {
+      std::string yamlText{"version: " + std::to_string(version) + "\nlist: ["};
+      for (int entry = 0; entry < version; ++entry) {
+        yamlText += (entry != 0 ? ", " : "") + std::to_string(version);
+      }
+      return Snapshot::make(BufferSource{yamlText + "]\n"});
+    };
+    AtomicSnapshot current{makeVersion(1)};
+    std::atomic<bool> reloading{true};
+    std::atomic<int> reads{};
+    std::atomic<int> failures{};
+    std::vector<std::thread> readers;
+    for (int reader = 0; reader < 4; ++reader) {
+      readers.emplace_back([&] {
+        while (reloading) {
+          const auto snapshot = current.load();
+          const int version = NRef<Number>((*snapshot)["version"]).value<int>();
+          const auto &list = NRef<Array>((*snapshot)["list"]);
+          bool whole = std::cmp_equal(list.size(), version);
+          for (const auto &entry : list.value()) {
+            whole = whole && NRef<Number>(entry).value<int>() == version;
+          }
+          whole = whole && !stringify(*snapshot).empty();
+          failures += whole ? 0 : 1;
+          ++reads;
+        }
+      });
+    }
+    for (int version = 2; version <= 200; ++version) {
+      current.store(makeVersion(version));
+    }
+    reloading = false;
+    for (auto &reader : readers) {
+      reader.join();
+    }
+    REQUIRE(reads > 0);
+    REQUIRE(failures == 0);
+    REQUIRE(NRef<Number>((*current.load())["version"]).value<int>() == 200);
+  }
+}
@@ -0,0 +1,98 @@
+#include "YAML_Lib_Tests.hpp"
+
+// ============================================================================
+// Transcoder: UTF-8 <-> UTF-16 <-> UTF-32, in memory and byte encoded.
+// ============================================================================
+
+static const std::string kMixed{"plain ASCII text, caf\xC3\xA9 \xE2\x82\xAC"
+                                "5 \xF0\x9F\x98\x80 and \xF4\x8F\xBF\xBF."};
+
+TEST_CASE("Check Transcoder round trips every encoding.",
+          "[YAML][Transcoder]") {
+  SECTION("UTF-16 code units.", "[YAML][Transcoder][UTF16]") {
+    const std::u16string utf16{toUtf16(kMixed)};
+    REQUIRE(utf16.substr(0, 5) == u"plain");
+    REQUIRE(utf16.find(u"\U0001F600") != std::u16string::npos);
+    REQUIRE(toUtf8(utf16) == kMixed);
+  }
+  SECTION("UTF-32 code points.", "[YAML][Transcoder][UTF32]") {
+    const std::u32string utf32{toUtf32(kMixed)};
+    REQUIRE(utf32.find(U'\U0001F600') != std::u32string::npos);
+    REQUIRE(utf32.back() == U'.');
+    REQUIRE(toUtf8(utf32) == kMixed);
+  }
+  SECTION("Byte encoded UTF-16/UTF-32 in both byte orders.",
+          "[YAML][Transcoder][Bytes]") {
+    for (const auto order : {std::endian::big, std::endian::little}) {
+      std::string utf16;
+      encodeUtf16(kMixed, order, utf16);
+      std::string utf8;
+      REQUIRE(decodeUtf16(utf16, order, utf8) == utf16.size());
+      REQUIRE(utf8 == kMixed);
+      std::string utf32;
+      encodeUtf32(kMixed, order, utf32);
+      REQUIRE(utf32.size() == 4 * toUtf32(kMixed).size());
+      utf8.clear();
+      REQUIRE(decodeUtf32(utf32, order, utf8) == utf32.size());
+      REQUIRE(utf8 == kMixed);
+    }
+  }
+  SECTION("Byte encoded UTF-16 decoded a block at a time.",
+          "[YAML][Transcoder][Bytes]") {
+    std::string utf16;
+    encodeUtf16(kMixed, std::endian::little, utf16);
+    for (std::size_t block = 1; block < 8; ++block) {
+      std::string utf8;
+      std::string pending;
+      for (std::size_t start = 0; start < utf16.size(); start += block) {
+        pending += utf16.substr(start, block);
+        pending.erase(0, decodeUtf16(pending, std::endian::little, utf8, false));
+      }
+      REQUIRE(pending.empty());
+      REQUIRE(utf8 == kMixed);
+    }
+  }
+}
+
+TEST_CASE("Check Transcoder rejects malformed input.",
+          "[YAML][Transcoder][Exception]") {
+  SECTION("Invalid UTF-8.", "[YAML][Transcoder][Exception]") {
+    for (const auto *utf8 : {"\x80", "a\xC3", "\xC0\xAF", "\xE0\x80\xAF",
+                             "\xED\xA0\x80", "\xF4\x90\x80\x80", "\xFF"}) {
+      REQUIRE_THROWS_WITH(toUtf32(utf8), "YAML Error: Invalid UTF-8 sequence.");
+    }
+  }
+  SECTION("Default_Translator escapes only what the transcoder accepts.",
+          "[YAML][Transcoder][Exception]") {
+    const Default_Translator translator;
+    REQUIRE(translator.to("\xF0\x9F\x98\x80") == "\\uD83D\\uDE00");
+    for (const auto *utf8 : {"a\xC3", "\xC0\xAF", "\xED\xA0\x80"}) {
+      REQUIRE_THROWS_WITH(translator.to(utf8), "YAML Error: Invalid UTF-8 sequence.");
+    }
+  }
+  SECTION("Unpaired UTF-16 surrogates.", "[YAML][Transcoder][Exception]") {
+    REQUIRE_THROWS_WITH(toUtf8(std::u16string{u'a', 0xD800}),
+                        "YAML Error: Invalid UTF-16 sequence.");
+    REQUIRE_THROWS_WITH(toUtf8(std::u16string{0xDC00, u'a'}),
+                        "YAML Error: Invalid UTF-16 sequence.");
+    REQUIRE_THROWS_WITH(toUtf8(std::u16string{0xD800, u'a'}),
+                        "YAML Error: Invalid UTF-16 sequence.");
+  }
+  SECTION("Out of range UTF-32.", "[YAML][Transcoder][Exception]") {
+    REQUIRE_THROWS_WITH(toUtf8(std::u32string{0x110000}),
+                        "YAML Error: Invalid UTF-32 code point.");
+    std::string utf8;
+    REQUIRE_THROWS_WITH(
+        decodeUtf32(std::string("\x00\x00\xD8\x00", 4), std::endian::big, utf8),
+        "YAML Error: Invalid UTF-32 code point.");
+  }
+  SECTION("Truncated byte encoded data.", "[YAML][Transcoder][Exception]") {
+    std::string utf8;
+    REQUIRE_THROWS_WITH(decodeUtf16("a", std::endian::little, utf8),
+                        "YAML Error: Truncated UTF-16 data.");
+    REQUIRE_THROWS_WITH(decodeUtf32("abc", std::endian::little, utf8),
+                        "YAML Error: Truncated UTF-32 data.");
+    REQUIRE(decodeUtf32(std::string("a\x00\x00\x00" "b", 5), std::endian::little,
+                        utf8, false) == 4);
+  }
+}
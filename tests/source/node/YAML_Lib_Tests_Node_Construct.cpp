@@ -135,3 +135,80 @@ TEST_CASE("Check use of Node constructors.", "[YAML][Node][Constructor]")
         REQUIRE(NRef<Number>(object["key3"][3]).value<int>() == 8);
     }
 }
+
+TEST_CASE("Check destruction of deeply nested Nodes.", "[YAML][Node][Destructor]")
+{
+    // Deep enough to overflow the stack if each level were destroyed by recursion.
+    constexpr int kDepth = 1000000;
+    SECTION("Destroy a Node of nested arrays.", "[YAML][Node][Destructor][Array]")
+    {
+        Node yNode = Node::make<Array>();
+        Node *innermost = &yNode;
+        for (int depth = 0; depth < kDepth; ++depth) {
+            NRef<Array>(*innermost).add(Node::make<Array>());
+            innermost = &NRef<Array>(*innermost)[0];
+        }
+        yNode = Node();
+        REQUIRE(yNode.isEmpty());
+    }
+    SECTION("Destroy a Node of nested dictionaries.", "[YAML][Node][Destructor][Dictionary]")
+    {
+        Node yNode = Node::make<Dictionary>();
+        Node *innermost = &yNode;
+        for (int depth = 0; depth < kDepth; ++depth) {
+            NRef<Dictionary>(*innermost).add(Dictionary::Entry("key", Node::make<Dictionary>()));
+            innermost = &NRef<Dictionary>(*innermost)["key"];
+        }
+        yNode = Node();
+        REQUIRE(yNode.isEmpty());
+    }
+}
+
+TEST_CASE("Check Node clone.", "[YAML][Node][Clone]")
+{
+    SECTION("Clone scalars keeping their tags.", "[YAML][Node][Clone]")
+    {
+        Node yNode = Node::make<String>("a string too long for the small string buffer", '\'');
+        yNode.setTag("!custom");
+        const Node copy = yNode.clone();
+        REQUIRE(NRef<String>(copy).value() == "a string too long for the small string buffer");
+        REQUIRE(NRef<String>(copy).getQuote() == '\'');
+        REQUIRE(copy.getTag() == "!custom");
+        REQUIRE(NRef<Number>(Node(42).clone()).value<int>() == 42);
+        REQUIRE(Node().clone().isEmpty());
+    }
+    SECTION("Clone nested containers.", "[YAML][Node][Clone]")
+    {
+        const Node yNode{ { "key1", 55 }, { "key2", Node{ 1, 2, Node{ { "key3", "text" } } } } };
+        Node copy = yNode.clone();
+        REQUIRE(copy.toKey() == yNode.toKey());
+        REQUIRE(NRef<Dictionary>(copy).contains("key2"));
+        REQUIRE(NRef<String>(copy["key2"][2]["key3"]).value() == "text");
+        copy["key2"][0] = 99;
+        NRef<Dictionary>(copy["key2"][2]).add(Dictionary::Entry("key4", Node(4)));
+        REQUIRE(NRef<Number>(yNode["key2"][0]).value<int>() == 1);
+        REQUIRE_FALSE(NRef<Dictionary>(yNode["key2"][2]).contains("key4"));
+    }
+    SECTION("Clone a parsed document.", "[YAML][Node][Clone]")
+    {
+        const YAML yaml;
+        yaml.parse(BufferSource{ "name: &n base\ntags: !set [a, b]\nnested:\n  list: [1, 2.5, true, null]\n  alias: *n\n" });
+        const Node copy = yaml.document(0).clone();
+        REQUIRE(isA<Dictionary>(copy));
+        REQUIRE(copy.toKey() == yaml.document(0).toKey());
+        REQUIRE(copy["tags"].getTag() == yaml.document(0)["tags"].getTag());
+        REQUIRE(NRef<String>(copy["nested"]["alias"]).value() == "base");
+    }
+    SECTION("Clone a deeply nested Node.", "[YAML][Node][Clone]")
+    {
+        Node yNode = Node::make<Array>();
+        Node *innermost = &yNode;
+        for (int depth = 0; depth < 1000000; ++depth) {
+            NRef<Array>(*innermost).add(Node::make<Array>());
+            innermost = &NRef<Array>(*innermost)[0];
+        }
+        const Node copy = yNode.clone();
+        REQUIRE(NRef<Array>(copy).size() == 1);
+        REQUIRE(isA<Array>(copy[0][0][0]));
+    }
+}
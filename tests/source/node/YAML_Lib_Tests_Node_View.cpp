@@ -0,0 +1,102 @@
+#include "YAML_Lib_Tests.hpp"
+#include "Binary_Stringify.hpp"
+#include "YAML_Binary_View.hpp"
+
+// ============================================================================
+// Read-only NodeView/DocumentView navigation over binary snapshots.
+// ============================================================================
+
+static std::string toSnapshot(const std::string_view yamlText) {
+  const YAML yaml(makeStringify<Binary_Stringify>());
+  yaml.parse(BufferSource{yamlText});
+  BufferDestination destination;
+  yaml.stringify(destination);
+  return destination.toString();
+}
+
+TEST_CASE("Check NodeView navigation of a binary snapshot.",
+          "[YAML][Node][View]") {
+  const std::string snapshot{toSnapshot(
+      "server:\n  host: 'localhost'\n  port: 8080\n  secure: true\n"
+      "  ratio: 0.5\nservers:\n  - alpha\n  - beta\nempty: ~\n"
+      "zeta: !custom tagged\nalpha: 2024-01-15\n")};
+  const DocumentView view{snapshot};
+  SECTION("Root is a dictionary with keys in insertion order.",
+          "[YAML][Node][View]") {
+    REQUIRE(view.getNumberOfDocuments() == 1);
+    REQUIRE(isA<Dictionary>(view.document(0)));
+    REQUIRE(view.document(0).size() == 5);
+    REQUIRE(view.document(0).getKey(0) == "server");
+    REQUIRE(view.document(0).getKey(4) == "alpha");
+  }
+  SECTION("Scalars are read in place.", "[YAML][Node][View]") {
+    REQUIRE(view["server"]["host"].getString() == "localhost");
+    REQUIRE(view["server"]["host"].getQuote() == kApostrophe);
+    REQUIRE(view["server"]["port"].getNumber<int>() == 8080);
+    REQUIRE(view["server"]["secure"].getBoolean());
+    REQUIRE(view["server"]["ratio"].getNumber<double>() == 0.5);
+    REQUIRE(isA<Null>(view["empty"]));
+    REQUIRE(isA<Timestamp>(view["alpha"]));
+    REQUIRE(view["alpha"].getString() == "2024-01-15");
+    REQUIRE(view["zeta"].getTag() == "!custom");
+  }
+  SECTION("String views point into the snapshot.", "[YAML][Node][View]") {
+    const auto host = view["server"]["host"].getString();
+    REQUIRE(host.data() >= snapshot.data());
+    REQUIRE(host.data() + host.size() <= snapshot.data() + snapshot.size());
+  }
+  SECTION("Array indexing.", "[YAML][Node][View]") {
+    REQUIRE(isA<Array>(view["servers"]));
+    REQUIRE(view["servers"].size() == 2);
+    REQUIRE(view["servers"][1].getString() == "beta");
+  }
+  SECTION("Lookup errors match Node::operator[].", "[YAML][Node][View]") {
+    REQUIRE_FALSE(view["server"].contains("missing"));
+    REQUIRE_THROWS_WITH(view["missing"],
+                        "Node Error: Invalid key used to access dictionary.");
+    REQUIRE_THROWS_WITH(view["servers"][2],
+                        "Node Error: Invalid index used to access array.");
+    REQUIRE_THROWS_WITH(view["servers"]["key"],
+                        "Node Error: Node not an dictionary.");
+    REQUIRE_THROWS_WITH(view["server"]["port"][0],
+                        "Node Error: Not an array or document to index.");
+  }
+  SECTION("Unknown number kind is a Node error.", "[YAML][Node][View]") {
+    // Document record -> dictionary record -> entry table -> number record.
+    std::string corrupt{toSnapshot("n: 1\n")};
+    const auto load = [&corrupt](const uint32_t offset) {
+      uint32_t value{};
+      std::memcpy(&value, corrupt.data() + offset, sizeof(value));
+      return value;
+    };
+    const uint32_t document{load(12)};
+    const uint32_t dictionary{load(load(document + 12))};
+    const uint32_t number{load(load(dictionary + 12) + 8)};
+    corrupt[number + 1] = 0;
+    const DocumentView corruptView{corrupt};
+    REQUIRE_THROWS_AS(corruptView["n"].getNumber<int>(), Node::Error);
+  }
+}
+
+TEST_CASE("Check NodeView key lookup over a large mapping.",
+          "[YAML][Node][View]") {
+  std::string yamlText;
+  for (int index = 999; index >= 0; --index) {
+    yamlText += "key" + std::to_string(index) + ": " + std::to_string(index) + "\n";
+  }
+  const std::string snapshot{toSnapshot(yamlText)};
+  const DocumentView view{snapshot};
+  for (int index = 0; index < 1000; ++index) {
+    REQUIRE(view["key" + std::to_string(index)].getNumber<int>() == index);
+  }
+  REQUIRE_FALSE(view.document(0).contains("key1000"));
+}
+
+TEST_CASE("Check DocumentView over multiple documents.", "[YAML][Node][View]") {
+  const std::string snapshot{toSnapshot("---\na: 1\n...\n---\n- x\n- y\n...\n")};
+  const DocumentView view{snapshot};
+  REQUIRE(view.getNumberOfDocuments() == 2);
+  REQUIRE(view.document(0)["a"].getNumber<long>() == 1);
+  REQUIRE(view.document(1)[0].getString() == "x");
+  REQUIRE_THROWS_WITH(view.document(2), "YAML Error: Document does not exist.");
+}
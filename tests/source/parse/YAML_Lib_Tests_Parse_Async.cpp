@@ -0,0 +1,106 @@
+#include "YAML_Lib_Tests.hpp"
+#include "Async_Parser.hpp"
+
+// ============================================================================
+// Async_Parser: coroutines resumed by a single-threaded "event loop" that
+// feeds each connection's bytes as they arrive.
+// ============================================================================
+
+// Minimal eager coroutine type; the frame frees itself on completion.
+struct Task {
+  struct promise_type {
+    Task get_return_object() { return {}; }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+  };
+};
+
+struct Connection {
+  Async_Parser parser;
+  std::vector<std::string> received;
+  std::string error;
+  bool closed{false};
+};
+
+static Task handleConnection(Connection &connection) {
+  try {
+    while (auto document = co_await connection.parser.next()) {
+      connection.received.emplace_back(
+          NRef<String>(NRef<Document>(*document)[0]["name"]).value());
+    }
+  } catch (const std::exception &ex) {
+    connection.error = ex.what();
+  }
+  connection.closed = true;
+}
+
+TEST_CASE("Check Async_Parser resumes coroutines as documents complete.",
+          "[YAML][Parse][Async]") {
+  SECTION("Many connections interleaved on one thread.",
+          "[YAML][Parse][Async]") {
+    constexpr int kConnections = 50;
+    std::vector<std::unique_ptr<Connection>> connections;
+    std::vector<std::string> payloads;
+    for (int index = 0; index < kConnections; ++index) {
+      connections.push_back(std::make_unique<Connection>());
+      handleConnection(*connections.back());
+      payloads.push_back("---\nname: first" + std::to_string(index) +
+                         "\n---\nname: second" + std::to_string(index) + "\n");
+    }
+    // Round-robin 3 byte reads, as a non-blocking socket loop might see them.
+    for (std::size_t offset = 0; offset < payloads[0].size(); offset += 3) {
+      for (int index = 0; index < kConnections; ++index) {
+        const std::string_view payload{payloads[index]};
+        if (offset < payload.size()) {
+          connections[index]->parser.feed(
+              std::span{payload.data() + offset,
+                        std::min<std::size_t>(3, payload.size() - offset)});
+        }
+      }
+    }
+    for (int index = 0; index < kConnections; ++index) {
+      REQUIRE(connections[index]->received.size() == 1);
+      REQUIRE_FALSE(connections[index]->closed);
+      connections[index]->parser.finish();
+      REQUIRE(connections[index]->closed);
+      REQUIRE(connections[index]->received ==
+              std::vector<std::string>{"first" + std::to_string(index),
+                                       "second" + std::to_string(index)});
+    }
+  }
+  SECTION("Documents parsed before the coroutine waits are not lost.",
+          "[YAML][Parse][Async]") {
+    Connection connection;
+    const std::string_view payload{"name: a\n---\nname: b\n...\n"};
+    connection.parser.feed(payload);
+    REQUIRE(connection.parser.readyCount() == 2);
+    handleConnection(connection);
+    REQUIRE(connection.received == std::vector<std::string>{"a", "b"});
+    REQUIRE_FALSE(connection.closed);
+    connection.parser.finish();
+    REQUIRE(connection.closed);
+  }
+  SECTION("A parse error is rethrown in the coroutine after earlier documents.",
+          "[YAML][Parse][Async][Error]") {
+    Connection connection;
+    handleConnection(connection);
+    const std::string_view payload{"name: a\n---\nname: [b\n---\n"};
+    REQUIRE_NOTHROW(connection.parser.feed(payload));
+    REQUIRE(connection.received == std::vector<std::string>{"a"});
+    REQUIRE(connection.closed);
+    REQUIRE_FALSE(connection.error.empty());
+  }
+  SECTION("The first of several undelivered parse errors is rethrown.",
+          "[YAML][Parse][Async][Error]") {
+    Connection connection;
+    const std::string_view first{"name: [a\n---\n"};
+    const std::string_view second{"\n\nname: [b\n---\n"};
+    REQUIRE_NOTHROW(connection.parser.feed(first));
+    REQUIRE_NOTHROW(connection.parser.feed(second));
+    handleConnection(connection);
+    REQUIRE(connection.closed);
+    REQUIRE_THAT(connection.error, Catch::Matchers::ContainsSubstring("Line: 2"));
+  }
+}
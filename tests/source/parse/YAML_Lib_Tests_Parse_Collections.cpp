@@ -404,4 +404,74 @@ TEST_CASE("Check YAML parsing of collection edge cases.",
     REQUIRE(val.find("extra indent") != std::string::npos);
     REQUIRE(val.find("back") != std::string::npos);
   }
+
+  // ---- Flow mapping after a scalar in a flow sequence ----
+
+  SECTION("YAML flow mapping following a scalar inside a flow sequence.",
+          "[YAML][Parse][Collections][Flow]") {
+    BufferSource source{"[1, null, {\"four\": 4}, {five: 5}]"};
+    REQUIRE_NOTHROW(yaml.parse(source));
+    REQUIRE(NRef<Array>(yaml.document(0)).size() == 4);
+    REQUIRE(NRef<Number>(yaml.document(0)[0]).value<int>() == 1);
+    REQUIRE(isA<Null>(yaml.document(0)[1]));
+    REQUIRE(NRef<Number>(yaml.document(0)[2]["four"]).value<int>() == 4);
+    REQUIRE(NRef<Number>(yaml.document(0)[3]["five"]).value<int>() == 5);
+  }
+}
+
+TEST_CASE("Check YAML parsing of flow collection elements in one pass.",
+          "[YAML][Parse][Collections][Flow]") {
+  const YAML yaml;
+  SECTION("Scalar elements decode to the same types as routed parsing.",
+          "[YAML][Parse][Collections][Flow]") {
+    BufferSource source{"[1, -2.5e3, \"q\", 'it', true, null, ~, 2001-12-14, "
+                        "12abc, \"a\\tb\", 'a''b', yes]"};
+    REQUIRE_NOTHROW(yaml.parse(source));
+    const auto &array = NRef<Array>(yaml.document(0));
+    REQUIRE(array.size() == 12);
+    REQUIRE(NRef<Number>(array[0]).value<int>() == 1);
+    REQUIRE(NRef<Number>(array[1]).value<double>() == -2500.0);
+    REQUIRE(NRef<String>(array[2]).value() == "q");
+    REQUIRE(NRef<String>(array[2]).getQuote() == '"');
+    REQUIRE(NRef<String>(array[3]).getQuote() == '\'');
+    REQUIRE(NRef<Boolean>(array[4]).value());
+    REQUIRE(isA<Null>(array[5]));
+    REQUIRE(isA<Null>(array[6]));
+    REQUIRE_FALSE(isA<Number>(array[7]));
+    REQUIRE(NRef<String>(array[8]).value() == "12abc");
+    REQUIRE(NRef<String>(array[9]).value() == "a\tb");
+    REQUIRE(NRef<String>(array[10]).value() == "a'b");
+    REQUIRE(NRef<String>(array[11]).value() == "yes");
+  }
+  SECTION("Nested collections and keys inside flow collections.",
+          "[YAML][Parse][Collections][Flow]") {
+    BufferSource source{"{a: [1, [2, 3]], \"b\": {c: 4}, [5]: 6, d: [7]: 8}"};
+    REQUIRE_NOTHROW(yaml.parse(source));
+    auto &root = yaml.document(0);
+    REQUIRE(NRef<Number>(root["a"][1][1]).value<int>() == 3);
+    REQUIRE(NRef<Number>(root["b"]["c"]).value<int>() == 4);
+    REQUIRE(NRef<Number>(root["[5]"]).value<int>() == 6);
+    REQUIRE(isA<Dictionary>(root["d"]));
+  }
+  SECTION("Buffer and stream sources parse flow collections alike.",
+          "[YAML][Parse][Collections][Flow]") {
+    const std::string text{"k: [1, 'a', \"b\", {x: [true, ~]}, [0o17, .5]]\n"
+                           "m: {p: 1 , q: \"r\" ,s: [ ]}\n"};
+    yaml.parse(BufferSource{text});
+    BufferDestination fromBuffer;
+    yaml.stringify(fromBuffer);
+    std::istringstream stream{text};
+    yaml.parse(StreamSource{stream});
+    BufferDestination fromStream;
+    yaml.stringify(fromStream);
+    REQUIRE(fromBuffer.toString() == fromStream.toString());
+  }
+  SECTION("Malformed elements report the same errors.",
+          "[YAML][Parse][Collections][Flow]") {
+    REQUIRE_THROWS_WITH(yaml.parse(BufferSource{"[1}"}),
+                        Catch::Matchers::ContainsSubstring("Missing closing ]"));
+    REQUIRE_THROWS_WITH(yaml.parse(BufferSource{"[\"a\"x]"}),
+                        Catch::Matchers::ContainsSubstring(
+                            "Invalid trailing content after quoted scalar"));
+  }
 }
@@ -0,0 +1,65 @@
+#include "YAML_Lib_Tests.hpp"
+#include "Dispatch_Parser.hpp"
+
+// ============================================================================
+// Dispatch_Parser: route selection, identical results and route counters.
+// ============================================================================
+
+static std::string stringifyWith(const YAML &yaml, const std::string_view text) {
+  yaml.parse(BufferSource{text});
+  BufferDestination destination;
+  yaml.stringify(destination);
+  return destination.toString();
+}
+
+TEST_CASE("Check Dispatch_Parser gives the same results as Default_Parser.",
+          "[YAML][Parse][Dispatch]") {
+  const YAML full;
+  const YAML dispatch(nullptr, makeParser<Dispatch_Parser>());
+  for (const std::string_view text :
+       {R"({"name": "Alice", "tags": ["a", "b"], "age": 30, "ok": true})",
+        "  \n[1, -2.5, \"three\", null, {\"four\": 4}]",
+        "{name: Alice, tags: [a, b]}", "[a, b, {c: d}]",
+        "[\"a\", b]", "{\"a\": 1}\n# trailing comment\n",
+        "name: Alice\ntags:\n  - a\n  - b\n", "---\n- 1\n...\n---\n- 2\n...\n",
+        "\"key\": value\n", "[1e400]"}) {
+    REQUIRE(stringifyWith(dispatch, text) == stringifyWith(full, text));
+  }
+}
+
+TEST_CASE("Check Dispatch_Parser route counters.", "[YAML][Parse][Dispatch]") {
+  auto *parser = makeParser<Dispatch_Parser>();
+  auto &dispatch = dynamic_cast<Dispatch_Parser &>(*parser);
+  const YAML yaml(nullptr, parser);
+  yaml.parse(BufferSource{R"({"a": [1, 2]})"});
+  yaml.parse(BufferSource{"[\"x\", 2]"});
+  yaml.parse(BufferSource{"{a: [1, 2]}"});
+  yaml.parse(BufferSource{"a: 1\n"});
+  yaml.parse(BufferSource{"[\"a\", b]"});
+  yaml.parse(BufferSource{"{\"a\": 1, \"b\": c}"});
+  std::istringstream stream{"  {\"streamed\": true}"};
+  yaml.parse(StreamSource{stream});
+  REQUIRE(NRef<Boolean>(yaml.document(0)["streamed"]).value());
+  const auto statistics = dispatch.getStatistics();
+  REQUIRE(statistics.json == 3);
+  REQUIRE(statistics.flow == 3);
+  REQUIRE(statistics.block == 1);
+  REQUIRE(statistics.jsonFallbacks == 2);
+  dispatch.resetStatistics();
+  REQUIRE(dispatch.getStatistics().json == 0);
+}
+
+TEST_CASE("Check Dispatch_Parser reports Default_Parser errors.",
+          "[YAML][Parse][Dispatch][Error]") {
+  const YAML full;
+  const YAML dispatch(nullptr, makeParser<Dispatch_Parser>());
+  const std::string_view text{"{\"a\": 1, \"a\": 2}"};
+  std::string fullError;
+  try {
+    full.parse(BufferSource{text});
+  } catch (const std::exception &ex) {
+    fullError = ex.what();
+  }
+  REQUIRE_FALSE(fullError.empty());
+  REQUIRE_THROWS_WITH(dispatch.parse(BufferSource{text}), fullError);
+}
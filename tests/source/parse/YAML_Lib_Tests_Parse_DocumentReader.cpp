@@ -0,0 +1,97 @@
+#include "YAML_Lib_Tests.hpp"
+#include "YAML_Document_Reader.hpp"
+
+// ============================================================================
+// DocumentReader: one document at a time, in order, from any ISource.
+// ============================================================================
+
+static std::string logStream(const int documents) {
+  std::string yaml;
+  for (int index = 0; index < documents; ++index) {
+    yaml += "---\nid: " + std::to_string(index) + "\nmessage: entry " +
+            std::to_string(index) + "\n";
+  }
+  return yaml;
+}
+
+TEST_CASE("Check DocumentReader returns the documents Default_Parser would.",
+          "[YAML][Parse][DocumentReader]") {
+  const std::string text{"# log\n--- a\n---\n- 1\n- 2\n...\n---\nkey: |\n  "
+                         "text\n...\n"};
+  const YAML yaml;
+  yaml.parse(BufferSource{text});
+  SECTION("From a BufferSource.", "[YAML][Parse][DocumentReader]") {
+    BufferSource source{text};
+    DocumentReader reader{source};
+    unsigned long index = 0;
+    while (reader.next()) {
+      REQUIRE(reader.document().toString() == yaml.document(index).toString());
+      index++;
+    }
+    REQUIRE(index == yaml.getNumberOfDocuments());
+    REQUIRE(reader.documentCount() == index);
+    REQUIRE_FALSE(reader.next());
+  }
+  SECTION("From a StreamSource.", "[YAML][Parse][DocumentReader]") {
+    std::istringstream stream{text};
+    StreamSource source{stream};
+    DocumentReader reader{source};
+    unsigned long index = 0;
+    while (reader.next()) {
+      REQUIRE(reader.document().toString() == yaml.document(index).toString());
+      index++;
+    }
+    REQUIRE(index == yaml.getNumberOfDocuments());
+  }
+}
+
+TEST_CASE("Check DocumentReader reads streams of many documents.",
+          "[YAML][Parse][DocumentReader]") {
+  SECTION("More documents than Options::max_documents, in order.",
+          "[YAML][Parse][DocumentReader]") {
+    const std::string text{logStream(5000)};
+    BufferSource source{text};
+    DocumentReader reader{source};
+    int expected = 0;
+    while (reader.next()) {
+      REQUIRE(NRef<Number>(reader.document()["id"]).value<int>() == expected);
+      expected++;
+    }
+    REQUIRE(expected == 5000);
+  }
+  SECTION("Documents are allocated from the supplied memory resource.",
+          "[YAML][Parse][DocumentReader]") {
+    const std::string text{logStream(100)};
+    std::pmr::unsynchronized_pool_resource pool;
+    Options options;
+    options.memory_resource = &pool;
+    BufferSource source{text};
+    DocumentReader reader{source, options};
+    int documents = 0;
+    while (reader.next()) {
+      documents++;
+    }
+    REQUIRE(documents == 100);
+    REQUIRE(std::pmr::get_default_resource() ==
+            std::pmr::new_delete_resource());
+  }
+  SECTION("No document is available before next().",
+          "[YAML][Parse][DocumentReader][Error]") {
+    BufferSource source{"a: 1\n"};
+    DocumentReader reader{source};
+    REQUIRE_THROWS_AS(reader.document(), IParser::Error);
+  }
+  SECTION("A document that fails to parse is reported once and skipped.",
+          "[YAML][Parse][DocumentReader][Error]") {
+    BufferSource source{"---\na: 1\n...\n---\nb: [\n...\n---\nc: 3\n...\n"};
+    DocumentReader reader{source};
+    REQUIRE_THROWS_WITH(reader.next(),
+                        Catch::Matchers::ContainsSubstring("Line: 6"));
+    REQUIRE(reader.next());
+    REQUIRE(NRef<Number>(reader.document()["a"]).value<int>() == 1);
+    REQUIRE(reader.next());
+    REQUIRE(NRef<Number>(reader.document()["c"]).value<int>() == 3);
+    REQUIRE_FALSE(reader.next());
+    REQUIRE(reader.documentCount() == 2);
+  }
+}
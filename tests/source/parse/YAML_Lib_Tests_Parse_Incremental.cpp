@@ -0,0 +1,106 @@
+#include "YAML_Lib_Tests.hpp"
+#include "Incremental_Parser.hpp"
+
+// ============================================================================
+// Incremental_Parser: chunked feeding, early emission and error recovery.
+// ============================================================================
+
+// Sink that stringifies each document onto a std::string.
+static void appendDocument(Node &&document, void *context) {
+  BufferDestination destination;
+  Default_Stringify(std::make_unique<Default_Translator>())
+      .stringify(document, destination, 0);
+  *static_cast<std::string *>(context) += destination.toString();
+}
+
+static std::string stringifyFull(const std::string_view text) {
+  const YAML yaml;
+  yaml.parse(BufferSource{text});
+  BufferDestination destination;
+  yaml.stringify(destination);
+  return destination.toString();
+}
+
+static std::string stringifyFed(const std::string_view text,
+                                const std::size_t chunkSize) {
+  std::string yaml;
+  Incremental_Parser parser{appendDocument, &yaml};
+  for (std::size_t offset = 0; offset < text.size(); offset += chunkSize) {
+    parser.feed(std::span{text.data() + offset,
+                          std::min(chunkSize, text.size() - offset)});
+  }
+  parser.finish();
+  return yaml;
+}
+
+TEST_CASE("Check Incremental_Parser gives the same results as Default_Parser.",
+          "[YAML][Parse][Incremental]") {
+  for (const std::string_view text :
+       {"name: Alice\nage: 30\n", "---\n- 1\n...\n---\n- 2\n...\n",
+        "# leading comment\n--- a\n--- b\n--- c",
+        "%YAML 1.2\n---\nnote: |\n  line one\n  line two\n...\n%YAML 1.2\n--- "
+        "x\n",
+        "a: \"multi\n  line\"\n---\nb: [1, 2,\n  3]\n",
+        "--- &anchor a\n--- b\n", "...\n", ""}) {
+    const std::string expected{stringifyFull(text)};
+    for (const std::size_t chunkSize : {1, 2, 5, 64}) {
+      REQUIRE(stringifyFed(text, chunkSize) == expected);
+    }
+  }
+}
+
+TEST_CASE("Check Incremental_Parser emits documents as soon as they close.",
+          "[YAML][Parse][Incremental]") {
+  std::string yaml;
+  Incremental_Parser parser{appendDocument, &yaml};
+  const std::string_view first{"--- first\n--"};
+  parser.feed(first);
+  REQUIRE(parser.documentCount() == 0);
+  const std::string_view second{"- sec"};
+  parser.feed(second);
+  REQUIRE(parser.documentCount() == 0);
+  const std::string_view third{"ond\n"};
+  parser.feed(third);
+  REQUIRE(parser.documentCount() == 1);
+  REQUIRE(yaml == "---\nfirst\n...\n");
+  REQUIRE(parser.bufferedSize() == 11);
+  const std::string_view fourth{"...\n"};
+  parser.feed(fourth);
+  REQUIRE(parser.documentCount() == 2);
+  REQUIRE(parser.bufferedSize() == 0);
+  parser.finish();
+  REQUIRE(parser.documentCount() == 2);
+}
+
+TEST_CASE("Check Incremental_Parser errors.",
+          "[YAML][Parse][Incremental][Error]") {
+  SECTION("A sink is required.", "[YAML][Parse][Incremental][Error]") {
+    REQUIRE_THROWS_AS(Incremental_Parser(nullptr, nullptr), IParser::Error);
+  }
+  SECTION("Errors report whole stream line numbers and the next document "
+          "still parses.",
+          "[YAML][Parse][Incremental][Error]") {
+    std::string yaml;
+    Incremental_Parser parser{appendDocument, &yaml};
+    const std::string_view bad{"--- a\n---\nb: [1\n---\n"};
+    REQUIRE_THROWS_WITH(parser.feed(bad),
+                        Catch::Matchers::ContainsSubstring("Line: 4"));
+    const std::string_view good{"c: 3\n"};
+    parser.feed(good);
+    parser.finish();
+    REQUIRE(parser.documentCount() == 2);
+    REQUIRE(yaml == "---\na\n...\n---\nc: 3\n...\n");
+  }
+  SECTION("Documents after a failing one in the same chunk are emitted before "
+          "the error is thrown.",
+          "[YAML][Parse][Incremental][Error]") {
+    std::string yaml;
+    Incremental_Parser parser{appendDocument, &yaml};
+    const std::string_view chunk{"--- a\n---\nb: [1\n---\nc: 3\n...\n"};
+    REQUIRE_THROWS_WITH(parser.feed(chunk),
+                        Catch::Matchers::ContainsSubstring("Line: 4"));
+    REQUIRE(parser.documentCount() == 2);
+    REQUIRE(parser.bufferedSize() == 0);
+    REQUIRE(yaml == "---\na\n...\n---\nc: 3\n...\n");
+  }
+}
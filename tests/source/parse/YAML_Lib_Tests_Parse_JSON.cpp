@@ -0,0 +1,104 @@
+#include "YAML_Lib_Tests.hpp"
+#include "JSON_Parser.hpp"
+#include "JSON_Stringify.hpp"
+
+// ============================================================================
+// JSON_Parser: dedicated JSON front end building the same Node trees as
+// Default_Parser.
+// ============================================================================
+
+static std::string stringifyWith(const std::string_view text, IParser *parser,
+                                 IStringify *stringify = nullptr) {
+  const YAML yaml(stringify, parser);
+  yaml.parse(BufferSource{text});
+  BufferDestination destination;
+  yaml.stringify(destination);
+  return destination.toString();
+}
+
+TEST_CASE("Check JSON_Parser builds the same tree as Default_Parser.",
+          "[YAML][Parse][JSON]") {
+  const std::string json{
+      R"({"name": "Alice", "age": 30, "height": 1.75, "big": 12345678901,)"
+      R"( "admin": true, "manager": false, "spouse": null,)"
+      R"( "tags": ["a", "b", []], "address": {"city": "Paris", "zip": "75001"},)"
+      R"( "empty": {}, "escaped": "tab\tquote\"slash\/"})"};
+  SECTION("YAML output is identical.", "[YAML][Parse][JSON]") {
+    REQUIRE(stringifyWith(json, makeParser<JSON_Parser>()) ==
+            stringifyWith(json, nullptr));
+  }
+  SECTION("JSON output is identical.", "[YAML][Parse][JSON]") {
+    REQUIRE(stringifyWith(json, makeParser<JSON_Parser>(),
+                          makeStringify<JSON_Stringify>()) ==
+            stringifyWith(json, nullptr, makeStringify<JSON_Stringify>()));
+  }
+  SECTION("Node types and quoting match.", "[YAML][Parse][JSON]") {
+    const YAML yaml(nullptr, makeParser<JSON_Parser>());
+    yaml.parse(BufferSource{json});
+    REQUIRE(yaml.getNumberOfDocuments() == 1);
+    REQUIRE(isA<Dictionary>(yaml.document(0)));
+    REQUIRE(NRef<Dictionary>(yaml.document(0)).value()[0].getKeyQuote() ==
+            kDoubleQuote);
+    REQUIRE(NRef<String>(yaml.document(0)["name"]).getQuote() == kDoubleQuote);
+    REQUIRE(NRef<Number>(yaml.document(0)["age"]).is<int>());
+    REQUIRE(NRef<Number>(yaml.document(0)["big"]).is<long>());
+    REQUIRE(NRef<Boolean>(yaml.document(0)["admin"]).value());
+    REQUIRE(isA<Null>(yaml.document(0)["spouse"]));
+    REQUIRE(NRef<String>(yaml.document(0)["address"]["zip"]).value() == "75001");
+    REQUIRE(NRef<String>(yaml.document(0)["escaped"]).value() ==
+            "tab\tquote\"slash/");
+  }
+}
+
+TEST_CASE("Check JSON_Parser strings, numbers and documents.",
+          "[YAML][Parse][JSON]") {
+  const YAML yaml(nullptr, makeParser<JSON_Parser>());
+  SECTION("Unicode escapes (including surrogate pairs) become UTF-8.",
+          "[YAML][Parse][JSON]") {
+    yaml.parse(BufferSource{R"(["\u00e9", "\u20AC", "\ud83d\ude00"])"});
+    REQUIRE(NRef<String>(yaml.document(0)[0]).value() == "\xC3\xA9");
+    REQUIRE(NRef<String>(yaml.document(0)[1]).value() == "\xE2\x82\xAC");
+    REQUIRE(NRef<String>(yaml.document(0)[2]).value() == "\xF0\x9F\x98\x80");
+  }
+  SECTION("Numbers use the smallest fitting type.", "[YAML][Parse][JSON]") {
+    yaml.parse(BufferSource{"[0, -7, 2147483648, 0.5, -1.5e3]"});
+    REQUIRE(NRef<Number>(yaml.document(0)[0]).value<int>() == 0);
+    REQUIRE(NRef<Number>(yaml.document(0)[1]).value<int>() == -7);
+    REQUIRE(NRef<Number>(yaml.document(0)[2]).is<long>());
+    REQUIRE(NRef<Number>(yaml.document(0)[3]).value<double>() == 0.5);
+    REQUIRE(NRef<Number>(yaml.document(0)[4]).value<double>() == -1500.0);
+  }
+  SECTION("Each top-level value is a document (NDJSON).", "[YAML][Parse][JSON]") {
+    yaml.parse(BufferSource{"{\"id\": 1}\n{\"id\": 2}\n\"three\"\n"});
+    REQUIRE(yaml.getNumberOfDocuments() == 3);
+    REQUIRE(NRef<Number>(yaml.document(1)["id"]).value<int>() == 2);
+    REQUIRE(NRef<String>(yaml.document(2)).value() == "three");
+  }
+  SECTION("Sources without raw access are buffered.", "[YAML][Parse][JSON]") {
+    std::istringstream stream{R"({"key": [1, 2]})"};
+    yaml.parse(StreamSource{stream});
+    REQUIRE(NRef<Number>(yaml.document(0)["key"][1]).value<int>() == 2);
+  }
+}
+
+TEST_CASE("Check JSON_Parser syntax errors.", "[YAML][Parse][JSON][Error]") {
+  const YAML yaml(nullptr, makeParser<JSON_Parser>());
+  REQUIRE_THROWS_WITH(yaml.parse(BufferSource{"{\"a\": 1,}"}),
+                      "YAML Syntax Error [Line: 1 Column: 9]: Expected a string key in JSON object.");
+  REQUIRE_THROWS_WITH(yaml.parse(BufferSource{"[1,\n 2 3]"}),
+                      "YAML Syntax Error [Line: 2 Column: 4]: Expected ',' or ']' in JSON array.");
+  REQUIRE_THROWS_WITH(yaml.parse(BufferSource{"{\"a\": 1, \"a\": 2}"}),
+                      "YAML Syntax Error [Line: 1 Column: 13]: Dictionary already contains key 'a'.");
+  REQUIRE_THROWS_WITH(yaml.parse(BufferSource{"[01]"}),
+                      "YAML Syntax Error [Line: 1 Column: 3]: Expected ',' or ']' in JSON array.");
+  REQUIRE_THROWS_WITH(yaml.parse(BufferSource{"[tru]"}),
+                      "YAML Syntax Error [Line: 1 Column: 5]: Invalid JSON value.");
+  REQUIRE_THROWS_WITH(yaml.parse(BufferSource{"\"open"}),
+                      "YAML Syntax Error [Line: 1 Column: 6]: Unterminated JSON string.");
+  REQUIRE_THROWS_WITH(yaml.parse(BufferSource{"\"\\ud800\""}),
+                      "YAML Syntax Error [Line: 1 Column: 8]: Unpaired surrogate in JSON string.");
+  const YAML shallow(nullptr, makeParser<JSON_Parser>(Options{.max_parse_depth = 2}));
+  REQUIRE_NOTHROW(shallow.parse(BufferSource{"[[1]]"}));
+  REQUIRE_THROWS_WITH(shallow.parse(BufferSource{"[[[1]]]"}),
+                      "IParser Error: YAML parse nesting depth limit exceeded.");
+}
@@ -0,0 +1,120 @@
+#include "YAML_Lib_Tests.hpp"
+#include "MessagePack_Parser.hpp"
+#include "MessagePack_Stringify.hpp"
+#include "JSON_Parser.hpp"
+#include "JSON_Stringify.hpp"
+
+// ============================================================================
+// MessagePack_Parser: decodes MessagePack into the Node trees JSON_Parser
+// builds for the equivalent JSON.
+// ============================================================================
+
+static std::string bytes(const std::initializer_list<int> values) {
+  std::string encoded;
+  for (const auto value : values) {
+    encoded += static_cast<char>(value);
+  }
+  return encoded;
+}
+
+static std::string toMessagePack(const std::string_view json) {
+  const YAML yaml(makeStringify<MessagePack_Stringify>(),
+                  makeParser<JSON_Parser>());
+  yaml.parse(BufferSource{json});
+  BufferDestination destination;
+  yaml.stringify(destination);
+  return destination.toString();
+}
+
+static std::string messagePackToJSON(const std::string_view messagePack) {
+  const YAML yaml(makeStringify<JSON_Stringify>(),
+                  makeParser<MessagePack_Parser>());
+  yaml.parse(BufferSource{messagePack});
+  BufferDestination destination;
+  yaml.stringify(destination);
+  return destination.toString();
+}
+
+static std::string jsonToJSON(const std::string_view json) {
+  const YAML yaml(makeStringify<JSON_Stringify>(), makeParser<JSON_Parser>());
+  yaml.parse(BufferSource{json});
+  BufferDestination destination;
+  yaml.stringify(destination);
+  return destination.toString();
+}
+
+TEST_CASE("Check MessagePack_Parser round trips MessagePack_Stringify output.",
+          "[YAML][Parse][MessagePack]") {
+  const std::string json{
+      R"({"name": "Alice", "age": 30, "small": -3, "neg": -200, "big": 12345678901,)"
+      R"( "ratio": 0.5, "admin": true, "manager": false, "spouse": null,)"
+      R"( "tags": ["a", "b", []], "address": {"city": "Paris"}, "empty": {}})"};
+  REQUIRE(messagePackToJSON(toMessagePack(json)) == jsonToJSON(json));
+  const YAML yaml(nullptr, makeParser<MessagePack_Parser>());
+  yaml.parse(BufferSource{toMessagePack(json)});
+  REQUIRE(NRef<Number>(yaml.document(0)["age"]).is<int>());
+  REQUIRE(NRef<Number>(yaml.document(0)["big"]).is<long>());
+  REQUIRE(NRef<Number>(yaml.document(0)["neg"]).value<int>() == -200);
+  REQUIRE(NRef<String>(yaml.document(0)["name"]).getQuote() == kDoubleQuote);
+}
+
+TEST_CASE("Check MessagePack_Parser decoding of specific encodings.",
+          "[YAML][Parse][MessagePack]") {
+  const YAML yaml(nullptr, makeParser<MessagePack_Parser>());
+  SECTION("Consecutive objects are separate documents.",
+          "[YAML][Parse][MessagePack]") {
+    yaml.parse(BufferSource{bytes({0x01, 0xa1, 'x', 0xc0})});
+    REQUIRE(yaml.getNumberOfDocuments() == 3);
+    REQUIRE(NRef<String>(yaml.document(1)).value() == "x");
+    REQUIRE(isA<Null>(yaml.document(2)));
+  }
+  SECTION("Integer map keys become strings.", "[YAML][Parse][MessagePack]") {
+    yaml.parse(BufferSource{bytes({0x82, 0x07, 0xc3, 0xd0, 0x80, 0xc2})});
+    REQUIRE(NRef<Boolean>(yaml.document(0)["7"]).value());
+    REQUIRE_FALSE(NRef<Boolean>(yaml.document(0)["-128"]).value());
+  }
+  SECTION("Binary becomes a !!binary base64 string.",
+          "[YAML][Parse][MessagePack]") {
+    yaml.parse(BufferSource{bytes({0xc4, 0x04, 'Y', 'A', 'M', 'L'})});
+    REQUIRE(NRef<String>(yaml.document(0)).value() == "WUFNTA==");
+    REQUIRE(yaml.document(0).getTag() == "tag:yaml.org,2002:binary");
+  }
+  SECTION("Timestamp extensions become timestamps.",
+          "[YAML][Parse][MessagePack]") {
+    yaml.parse(BufferSource{
+        bytes({0xd6, 0xff, 0x3d, 0xfa, 0x74, 0x80}) +
+        bytes({0xd7, 0xff, 0x17, 0xd7, 0x84, 0x00, 0x3c, 0x1a, 0xbc, 0x9f}) +
+        bytes({0xc7, 12, 0xff, 0, 0, 0, 0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+               0xae, 0x80})});
+    REQUIRE(NRef<Timestamp>(yaml.document(0)).value() == "2002-12-14T00:00:00Z");
+    REQUIRE(NRef<Timestamp>(yaml.document(1)).value() ==
+            "2001-12-15T02:59:43.1Z");
+    REQUIRE(NRef<Timestamp>(yaml.document(2)).value() == "1969-12-31T00:00:00Z");
+  }
+  SECTION("Unsigned 64-bit values beyond long long.",
+          "[YAML][Parse][MessagePack]") {
+    yaml.parse(BufferSource{
+        bytes({0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff})});
+    REQUIRE(NRef<Number>(yaml.document(0)).value<double>() ==
+            Approx(18446744073709551615.0));
+  }
+}
+
+TEST_CASE("Check MessagePack_Parser errors.", "[YAML][Parse][MessagePack][Error]") {
+  const YAML yaml(nullptr, makeParser<MessagePack_Parser>());
+  REQUIRE_THROWS_WITH(yaml.parse(BufferSource{bytes({0x92, 0x01})}),
+                      "IParser Error: MessagePack data is truncated.");
+  REQUIRE_THROWS_WITH(yaml.parse(BufferSource{bytes({0xdd, 0x7f, 0xff, 0xff, 0xff})}),
+                      "IParser Error: MessagePack data is truncated.");
+  REQUIRE_THROWS_WITH(yaml.parse(BufferSource{bytes({0xc1})}),
+                      "IParser Error: MessagePack data contains an invalid type byte.");
+  REQUIRE_THROWS_WITH(yaml.parse(BufferSource{bytes({0xd4, 0x01, 0x00})}),
+                      "IParser Error: MessagePack extension type is not supported.");
+  REQUIRE_THROWS_WITH(yaml.parse(BufferSource{bytes({0x81, 0x90, 0x01})}),
+                      "IParser Error: MessagePack map key must be a string or integer.");
+  REQUIRE_THROWS_WITH(yaml.parse(BufferSource{bytes({0x82, 0xa1, 'a', 0x01, 0xa1, 'a', 0x02})}),
+                      "IParser Error: Dictionary already contains key 'a'.");
+  std::istringstream stream{bytes({0x01})};
+  REQUIRE_THROWS_WITH(yaml.parse(StreamSource{stream}),
+                      "IParser Error: MessagePack source must support raw byte access.");
+}
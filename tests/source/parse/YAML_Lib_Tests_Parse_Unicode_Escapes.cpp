@@ -148,4 +148,67 @@ TEST_CASE("Check YAML parsing of Unicode/escape sequences.",
     BufferSource source{"---\n\"\\U0041\"\n"};
     REQUIRE_THROWS(yaml.parse(source));
   }
+
+  SECTION("YAML parse double quoted string with a surrogate pair.",
+          "[YAML][Parse][Escape][Surrogate]") {
+    BufferSource source{"---\n\"\\uD83D\\uDE00!\"\n"};
+    REQUIRE_NOTHROW(yaml.parse(source));
+    REQUIRE(NRef<String>(yaml.document(0)).value() == "\xF0\x9F\x98\x80!");
+  }
+
+  SECTION("YAML parse unpaired surrogates throws.",
+          "[YAML][Parse][Escape][Surrogate]") {
+    for (const auto *text : {"---\n\"\\uD83Dx\"\n", "---\n\"\\uDE00\"\n",
+                             "---\n\"x\\uDE00\\uD83D\"\n"}) {
+      BufferSource source{text};
+      REQUIRE_THROWS_WITH(
+          yaml.parse(source),
+          Catch::Matchers::ContainsSubstring("Unpaired surrogate found."));
+    }
+  }
+
+  SECTION("YAML parse escapes with non hex digits throws.",
+          "[YAML][Parse][Escape][Hex]") {
+    for (const auto *text : {"---\n\"\\u+041\"\n", "---\n\"\\x-1\"\n",
+                             "---\n\"\\u0x41\"\n", "---\n\"\\u12\"\n"}) {
+      BufferSource source{text};
+      REQUIRE_THROWS_WITH(
+          yaml.parse(source),
+          Catch::Matchers::ContainsSubstring("Syntax error detected."));
+    }
+  }
+
+  SECTION("YAML parse double quoted string keeps UTF-8 text unchanged.",
+          "[YAML][Parse][Escape][UTF8]") {
+    BufferSource source{"---\n\"caf\xC3\xA9 \xE2\x82\xAC\\t\xF0\x9F\x98\x80\"\n"};
+    REQUIRE_NOTHROW(yaml.parse(source));
+    REQUIRE(NRef<String>(yaml.document(0)).value() ==
+            "caf\xC3\xA9 \xE2\x82\xAC\t\xF0\x9F\x98\x80");
+  }
+}
+
+TEST_CASE("Check Default_Translator tryFrom reports failure without throwing.",
+          "[YAML][Parse][Escape][TryFrom]") {
+  const Default_Translator translator;
+  std::string translated;
+  SECTION("Valid escapes translate as from() does.",
+          "[YAML][Parse][Escape][TryFrom]") {
+    REQUIRE(translator.tryFrom("a\\tb\\u00e9\\U0001F600", translated));
+    REQUIRE(translated == translator.from("a\\tb\\u00e9\\U0001F600"));
+  }
+  SECTION("Malformed escapes return false.", "[YAML][Parse][Escape][TryFrom]") {
+    for (const auto *text :
+         {"\\q", "\\u12", "\\uD83D", "\\x00", "trailing\\", "\\U00110000"}) {
+      REQUIRE_FALSE(translator.tryFrom(text, translated));
+      REQUIRE_THROWS(translator.from(text));
+    }
+  }
+  SECTION("Keys with malformed escapes are rejected as keys.",
+          "[YAML][Parse][Escape][TryFrom]") {
+    const YAML yaml;
+    REQUIRE_THROWS(yaml.parse(BufferSource{"\"\\q\": 1\n"}));
+    REQUIRE_THROWS(yaml.parse(BufferSource{"{\"a\\\": 1}\n"}));
+    REQUIRE_NOTHROW(yaml.parse(BufferSource{"? \"a\n  b\"\n: 1\n"}));
+    REQUIRE(NRef<Dictionary>(yaml.document(0)).contains("a b"));
+  }
 }
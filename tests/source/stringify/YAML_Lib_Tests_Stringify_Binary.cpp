@@ -0,0 +1,144 @@
+#include "YAML_Lib_Tests.hpp"
+#include "Binary_Stringify.hpp"
+#include "Binary_Parser.hpp"
+
+// ============================================================================
+// Binary snapshot tests: YAML -> binary -> Node tree must reproduce exactly
+// the same YAML text as the original parse.
+// ============================================================================
+
+static std::string toSnapshot(const std::string_view yamlText) {
+  const YAML yaml(makeStringify<Binary_Stringify>());
+  yaml.parse(BufferSource{yamlText});
+  BufferDestination destination;
+  yaml.stringify(destination);
+  return destination.toString();
+}
+
+static std::string fromSnapshot(const std::string &snapshot) {
+  const YAML yaml(nullptr, makeParser<Binary_Parser>());
+  yaml.parse(BufferSource{snapshot});
+  BufferDestination destination;
+  yaml.stringify(destination);
+  return destination.toString();
+}
+
+static std::string reformat(const std::string_view yamlText) {
+  const YAML yaml;
+  yaml.parse(BufferSource{yamlText});
+  BufferDestination destination;
+  yaml.stringify(destination);
+  return destination.toString();
+}
+
+TEST_CASE("Check binary snapshot round trip of simple types.",
+          "[YAML][Stringify][Binary]") {
+  SECTION("Binary round trip of a plain string.", "[YAML][Stringify][Binary]") {
+    REQUIRE(fromSnapshot(toSnapshot("abcdefghijklmnopqrstuvwxyz")) ==
+            reformat("abcdefghijklmnopqrstuvwxyz"));
+  }
+  SECTION("Binary round trip of quoted strings keeps quote style.",
+          "[YAML][Stringify][Binary]") {
+    const std::string yamlText{"- \"double \\t quoted\"\n- 'single ''quoted'''\n"};
+    REQUIRE(fromSnapshot(toSnapshot(yamlText)) == reformat(yamlText));
+  }
+  SECTION("Binary round trip of boolean spellings.", "[YAML][Stringify][Binary]") {
+    const std::string yamlText{"- True\n- off\n- Yes\n- false\n"};
+    REQUIRE(fromSnapshot(toSnapshot(yamlText)) == reformat(yamlText));
+  }
+  SECTION("Binary round trip keeps number types.", "[YAML][Stringify][Binary]") {
+    const YAML yaml(nullptr, makeParser<Binary_Parser>());
+    yaml.parse(BufferSource{toSnapshot("- 42\n- 3000000000\n- 3.5\n- -0.25\n")});
+    REQUIRE(NRef<Number>(yaml.document(0)[0]).is<int>());
+    REQUIRE(NRef<Number>(yaml.document(0)[0]).value<int>() == 42);
+    REQUIRE(NRef<Number>(yaml.document(0)[1]).is<long>());
+    REQUIRE(NRef<Number>(yaml.document(0)[1]).value<long>() == 3000000000L);
+    REQUIRE(NRef<Number>(yaml.document(0)[2]).is<float>());
+    REQUIRE(NRef<Number>(yaml.document(0)[3]).is<float>());
+    REQUIRE(NRef<Number>(yaml.document(0)[3]).value<float>() == -0.25f);
+  }
+  SECTION("Binary round trip of null, timestamp and comment.",
+          "[YAML][Stringify][Binary]") {
+    const std::string yamlText{"# leading comment\nwhen: 2024-01-15\nnothing: ~\n"};
+    REQUIRE(fromSnapshot(toSnapshot(yamlText)) == reformat(yamlText));
+  }
+  SECTION("Binary round trip keeps tags and key quotes.",
+          "[YAML][Stringify][Binary]") {
+    const std::string yamlText{
+        "\"quoted key\": !!str 123\n'single': !custom value\nplain: |\n  line 1\n  line 2\n"};
+    REQUIRE(fromSnapshot(toSnapshot(yamlText)) == reformat(yamlText));
+  }
+}
+
+TEST_CASE("Check binary snapshot round trip of multiple documents.",
+          "[YAML][Stringify][Binary]") {
+  const std::string yamlText{"---\na: 1\n...\n---\n- x\n- y\n...\n---\n...\n"};
+  const YAML yaml(nullptr, makeParser<Binary_Parser>());
+  yaml.parse(BufferSource{toSnapshot(yamlText)});
+  REQUIRE(yaml.getNumberOfDocuments() == 3);
+  REQUIRE(fromSnapshot(toSnapshot(yamlText)) == reformat(yamlText));
+}
+
+TEST_CASE("Check binary snapshot round trip of test files.",
+          "[YAML][Stringify][Binary]") {
+  TEST_FILE_LIST(testFile);
+  const YAML yaml;
+  yaml.parse(FileSource{prefixTestDataPath(testFile)});
+  BufferDestination expected;
+  yaml.stringify(expected);
+  REQUIRE(fromSnapshot(toSnapshot(expected.toString())) ==
+          reformat(expected.toString()));
+}
+
+TEST_CASE("Check binary snapshot rejects invalid input.",
+          "[YAML][Stringify][Binary]") {
+  const YAML yaml(nullptr, makeParser<Binary_Parser>());
+  SECTION("Text is not a snapshot.", "[YAML][Stringify][Binary]") {
+    REQUIRE_THROWS_WITH(yaml.parse(BufferSource{"key: value is not binary"}),
+                        "YAML Error: Binary snapshot has an invalid signature.");
+  }
+  SECTION("Truncated snapshot.", "[YAML][Stringify][Binary]") {
+    const std::string snapshot{toSnapshot("a: [1, 2, 3]\n")};
+    REQUIRE_THROWS_WITH(
+        yaml.parse(BufferSource{snapshot.substr(0, snapshot.size() - 8)}),
+        "YAML Error: Binary snapshot is truncated.");
+  }
+  SECTION("Container count larger than the frame.", "[YAML][Stringify][Binary]") {
+    std::string snapshot{toSnapshot("[1, 2, 3]\n")};
+    uint32_t rootOffset{};
+    std::memcpy(&rootOffset, snapshot.data() + 12, sizeof(rootOffset));
+    constexpr uint32_t count{0xFFFFFFFF};
+    std::memcpy(snapshot.data() + rootOffset + 8, &count, sizeof(count));
+    REQUIRE_THROWS_WITH(yaml.parse(BufferSource{snapshot}),
+                        "YAML Error: Binary snapshot table out of range.");
+  }
+  SECTION("Corrupt node records.", "[YAML][Stringify][Binary]") {
+    const std::string snapshot{toSnapshot("true\n")};
+    // The root Document record's second word locates its child offset table.
+    uint32_t rootOffset{};
+    std::memcpy(&rootOffset, snapshot.data() + 12, sizeof(rootOffset));
+    uint32_t childTable{};
+    std::memcpy(&childTable, snapshot.data() + rootOffset + 12, sizeof(childTable));
+    uint32_t childOffset{};
+    std::memcpy(&childOffset, snapshot.data() + childTable, sizeof(childOffset));
+    std::string corrupt{snapshot};
+    corrupt[childOffset] = '\x7F';
+    REQUIRE_THROWS_WITH(yaml.parse(BufferSource{corrupt}),
+                        "YAML Error: Binary snapshot contains an unknown node type.");
+    corrupt = snapshot;
+    corrupt[childOffset + 1] = '\x7F';
+    REQUIRE_THROWS_WITH(yaml.parse(BufferSource{corrupt}),
+                        "YAML Error: Binary snapshot contains an invalid boolean.");
+    corrupt = snapshot;
+    std::memcpy(corrupt.data() + childTable, &rootOffset, sizeof(rootOffset));
+    REQUIRE_THROWS_WITH(yaml.parse(BufferSource{corrupt}),
+                        "YAML Error: Binary snapshot contains an invalid node offset.");
+  }
+  SECTION("Stream sources do not expose raw bytes.",
+          "[YAML][Stringify][Binary]") {
+    std::istringstream stream{toSnapshot("a: 1\n")};
+    REQUIRE_THROWS_WITH(yaml.parse(StreamSource{stream}),
+                        "IParser Error: Binary snapshot source must support "
+                        "raw byte access.");
+  }
+}
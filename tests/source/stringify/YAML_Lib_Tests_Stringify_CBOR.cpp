@@ -0,0 +1,90 @@
+#include "YAML_Lib_Tests.hpp"
+#include "CBOR_Stringify.hpp"
+
+static std::string toCBOR(const std::string_view yamlText)
+{
+    const YAML yaml(makeStringify<CBOR_Stringify>());
+    BufferDestination yamlDestination;
+    yaml.parse(BufferSource{ yamlText });
+    yaml.stringify(yamlDestination);
+    return yamlDestination.toString();
+}
+
+static std::string bytes(const std::initializer_list<int> values)
+{
+    std::string encoded;
+    for (const auto value : values) {
+        encoded += static_cast<char>(value);
+    }
+    return encoded;
+}
+
+TEST_CASE("Check YAML stringification to CBOR of simple types.", "[YAML][Stringify][Simple][CBOR]")
+{
+    SECTION("Stringify a string (abc) to CBOR.", "[YAML][Stringify][String][CBOR]")
+    {
+        REQUIRE(toCBOR(R"("abc")") == bytes({ 0x63, 'a', 'b', 'c' }));
+    }
+    SECTION("Stringify a 40 character string to CBOR.", "[YAML][Stringify][String][CBOR]")
+    {
+        REQUIRE(toCBOR(std::string(40, 'x')) == bytes({ 0x78, 40 }) + std::string(40, 'x'));
+    }
+    SECTION("Stringify booleans to CBOR.", "[YAML][Stringify][Boolean][CBOR]")
+    {
+        REQUIRE(toCBOR("true") == bytes({ 0xf5 }));
+        REQUIRE(toCBOR("false") == bytes({ 0xf4 }));
+    }
+    SECTION("Stringify a null to CBOR.", "[YAML][Stringify][Simple][CBOR]")
+    {
+        REQUIRE(toCBOR("null") == bytes({ 0xf6 }));
+    }
+    SECTION("Stringify integers using the shortest head.", "[YAML][Stringify][Integer][CBOR]")
+    {
+        REQUIRE(toCBOR("10") == bytes({ 0x0a }));
+        REQUIRE(toCBOR("-1") == bytes({ 0x20 }));
+        REQUIRE(toCBOR("500") == bytes({ 0x19, 0x01, 0xf4 }));
+        REQUIRE(toCBOR("98345") == bytes({ 0x1a, 0x00, 0x01, 0x80, 0x29 }));
+        REQUIRE(toCBOR("-98345") == bytes({ 0x3a, 0x00, 0x01, 0x80, 0x28 }));
+        REQUIRE(toCBOR("4294967296") == bytes({ 0x1b, 0, 0, 0, 1, 0, 0, 0, 0 }));
+    }
+    SECTION("Stringify a floating point (0.5) natively.", "[YAML][Stringify][Float][CBOR]")
+    {
+        REQUIRE(toCBOR("0.5") == bytes({ 0xfa, 0x3f, 0x00, 0x00, 0x00 }));
+    }
+}
+
+TEST_CASE("Check YAML stringification to CBOR of collections.", "[YAML][Stringify][Collection][CBOR]")
+{
+    SECTION("Stringify a dictionary to CBOR.", "[YAML][Stringify][Dictionary][CBOR]")
+    {
+        REQUIRE(toCBOR("a: 1") == bytes({ 0xa1, 0x61, 'a', 0x01 }));
+    }
+    SECTION("Stringify an array to CBOR.", "[YAML][Stringify][Array][CBOR]")
+    {
+        REQUIRE(toCBOR("[1, false, ~]") == bytes({ 0x83, 0x01, 0xf4, 0xf6 }));
+    }
+    SECTION("Stringify a 24 element array to CBOR.", "[YAML][Stringify][Array][CBOR]")
+    {
+        std::string yamlText{ "[0" };
+        for (int index = 1; index < 24; ++index) {
+            yamlText += ", " + std::to_string(index);
+        }
+        const auto encoded = toCBOR(yamlText + "]");
+        REQUIRE(encoded.substr(0, 2) == bytes({ 0x98, 24 }));
+    }
+}
+
+TEST_CASE("Check YAML stringification to CBOR of timestamps.", "[YAML][Stringify][Timestamp][CBOR]")
+{
+    SECTION("Stringify a date-time to tag 0 with RFC 3339 text.", "[YAML][Stringify][Timestamp][CBOR]")
+    {
+        REQUIRE(toCBOR("2001-12-14 21:59:43.10 -5") ==
+                bytes({ 0xc0, 0x78, 28 }) + "2001-12-14T21:59:43.10-05:00");
+        REQUIRE(toCBOR("2001-07-08 17:08:28") == bytes({ 0xc0, 0x74 }) + "2001-07-08T17:08:28Z");
+    }
+    SECTION("Stringify a date to tag 1 with epoch seconds.", "[YAML][Stringify][Timestamp][CBOR]")
+    {
+        // 2002-12-14 == 1039824000 s
+        REQUIRE(toCBOR("2002-12-14") == bytes({ 0xc1, 0x1a, 0x3d, 0xfa, 0x74, 0x80 }));
+    }
+}
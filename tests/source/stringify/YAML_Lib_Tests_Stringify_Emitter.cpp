@@ -0,0 +1,92 @@
+#include "YAML_Emitter.hpp"
+#include "YAML_Lib_Tests.hpp"
+
+// ============================================================================
+// Emitter: builder output must match stringify() of the equivalent tree.
+// ============================================================================
+
+static Node createTree() {
+  Node document(Node::make<Document>());
+  NRef<Document>(document).add(Node{
+      {"name", std::string("Alice \"Al\" Smith")},
+      {"age", 30},
+      {"score", 2.5},
+      {"active", true},
+      {"manager", nullptr},
+      {"tags", Node{std::string("a"), std::string("b c"), 3}},
+      {"single", Node{std::string("only")}},
+      {"none", Node::make<Dictionary>()},
+      {"home address", Node{{"street", std::string("1 Main St")},
+                            {"city", std::string("Springfield")}}},
+      {"matrix", Node{Node{1, 2}, Node{Node{{"x", 3}}, Node::make<Array>()}}}});
+  return document;
+}
+
+static void emitTree(Emitter &emitter) {
+  emitter.beginMap();
+  emitter.value("name", "Alice \"Al\" Smith");
+  emitter.value("age", 30);
+  emitter.value("score", 2.5);
+  emitter.value("active", true);
+  emitter.value("manager", nullptr);
+  emitter.key("tags").beginSeq().scalar("a").scalar(std::string("b c")).scalar(3).end();
+  emitter.key("single").beginSeq().scalar("only").end();
+  emitter.key("none").beginMap().end();
+  emitter.key("home address").beginMap();
+  emitter.value("street", "1 Main St").value("city", "Springfield");
+  emitter.end();
+  emitter.key("matrix").beginSeq();
+  emitter.beginSeq().scalar(1).scalar(2).end();
+  emitter.beginSeq().beginMap().value("x", 3).end().beginSeq().end().end();
+  emitter.end();
+  emitter.end();
+}
+
+TEST_CASE("Check Emitter output matches stringify of the same tree.",
+          "[YAML][Stringify][Emitter]") {
+  const Node document(createTree());
+  SECTION("YAML.", "[YAML][Stringify][Emitter]") {
+    BufferDestination expected;
+    Default_Stringify(std::make_unique<Default_Translator>())
+        .stringify(document, expected, 0);
+    BufferDestination actual;
+    Emitter emitter{actual};
+    emitTree(emitter);
+    REQUIRE(actual.toString() == expected.toString());
+  }
+  SECTION("JSON.", "[YAML][Stringify][Emitter][JSON]") {
+    BufferDestination expected;
+    JSON_Stringify().stringify(document, expected, 0);
+    BufferDestination actual;
+    Emitter emitter{actual, Emitter::Format::json};
+    emitTree(emitter);
+    REQUIRE(actual.toString() == expected.toString());
+  }
+  SECTION("XML.", "[YAML][Stringify][Emitter][XML]") {
+    BufferDestination expected;
+    XML_Stringify().stringify(document, expected, 0);
+    BufferDestination actual;
+    Emitter emitter{actual, Emitter::Format::xml};
+    emitTree(emitter);
+    REQUIRE(actual.toString() == expected.toString());
+  }
+  SECTION("Each top-level value is a document.", "[YAML][Stringify][Emitter]") {
+    BufferDestination actual;
+    Emitter emitter{actual};
+    emitter.scalar("one").beginSeq().scalar(2).end();
+    REQUIRE(actual.toString() == "---\n\"one\"\n...\n---\n- 2\n...\n");
+  }
+}
+
+TEST_CASE("Check Emitter rejects out of order calls.",
+          "[YAML][Stringify][Emitter][Exception]") {
+  BufferDestination destination;
+  Emitter emitter{destination};
+  REQUIRE_THROWS_AS(emitter.end(), Emitter::Error);
+  REQUIRE_THROWS_AS(emitter.key("a"), Emitter::Error);
+  emitter.beginMap();
+  REQUIRE_THROWS_AS(emitter.scalar(1), Emitter::Error);
+  emitter.key("a");
+  REQUIRE_THROWS_AS(emitter.key("b"), Emitter::Error);
+  REQUIRE_THROWS_AS(emitter.end(), Emitter::Error);
+}
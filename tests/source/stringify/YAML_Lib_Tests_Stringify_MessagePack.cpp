@@ -0,0 +1,111 @@
+#include "YAML_Lib_Tests.hpp"
+#include "MessagePack_Stringify.hpp"
+
+static std::string toMessagePack(const std::string_view yamlText)
+{
+    const YAML yaml(makeStringify<MessagePack_Stringify>());
+    BufferDestination yamlDestination;
+    yaml.parse(BufferSource{ yamlText });
+    yaml.stringify(yamlDestination);
+    return yamlDestination.toString();
+}
+
+static std::string bytes(const std::initializer_list<int> values)
+{
+    std::string encoded;
+    for (const auto value : values) {
+        encoded += static_cast<char>(value);
+    }
+    return encoded;
+}
+
+TEST_CASE("Check YAML stringification to MessagePack of simple types.", "[YAML][Stringify][Simple][MessagePack]")
+{
+    SECTION("Stringify a string (abc) to MessagePack.", "[YAML][Stringify][String][MessagePack]")
+    {
+        REQUIRE(toMessagePack(R"("abc")") == bytes({ 0xa3, 'a', 'b', 'c' }));
+    }
+    SECTION("Stringify a 40 character string to MessagePack (str 8).", "[YAML][Stringify][String][MessagePack]")
+    {
+        REQUIRE(toMessagePack(std::string(40, 'x')) == bytes({ 0xd9, 40 }) + std::string(40, 'x'));
+    }
+    SECTION("Stringify booleans to MessagePack.", "[YAML][Stringify][Boolean][MessagePack]")
+    {
+        REQUIRE(toMessagePack("true") == bytes({ 0xc3 }));
+        REQUIRE(toMessagePack("false") == bytes({ 0xc2 }));
+    }
+    SECTION("Stringify a null to MessagePack.", "[YAML][Stringify][Simple][MessagePack]")
+    {
+        REQUIRE(toMessagePack("null") == bytes({ 0xc0 }));
+    }
+    SECTION("Stringify integers using the smallest encoding.", "[YAML][Stringify][Integer][MessagePack]")
+    {
+        REQUIRE(toMessagePack("5") == bytes({ 0x05 }));
+        REQUIRE(toMessagePack("-5") == bytes({ 0xfb }));
+        REQUIRE(toMessagePack("200") == bytes({ 0xcc, 0xc8 }));
+        REQUIRE(toMessagePack("98345") == bytes({ 0xce, 0x00, 0x01, 0x80, 0x29 }));
+        REQUIRE(toMessagePack("-98345") == bytes({ 0xd2, 0xff, 0xfe, 0x7f, 0xd7 }));
+        REQUIRE(toMessagePack("4294967296") == bytes({ 0xcf, 0, 0, 0, 1, 0, 0, 0, 0 }));
+    }
+    SECTION("Stringify a floating point (0.5) natively.", "[YAML][Stringify][Float][MessagePack]")
+    {
+        REQUIRE(toMessagePack("0.5") == bytes({ 0xca, 0x3f, 0x00, 0x00, 0x00 }));
+    }
+    SECTION("Stringify a double (1e300) natively.", "[YAML][Stringify][Float][MessagePack]")
+    {
+        const auto encoded = toMessagePack("1e300");
+        REQUIRE(encoded.size() == 9);
+        REQUIRE(encoded[0] == static_cast<char>(0xcb));
+        uint64_t bits = 0;
+        for (std::size_t index = 1; index < encoded.size(); ++index) {
+            bits = bits << 8 | static_cast<unsigned char>(encoded[index]);
+        }
+        REQUIRE(std::bit_cast<double>(bits) == 1e300);
+    }
+}
+
+TEST_CASE("Check YAML stringification to MessagePack of collections.", "[YAML][Stringify][Collection][MessagePack]")
+{
+    SECTION("Stringify a dictionary to MessagePack.", "[YAML][Stringify][Dictionary][MessagePack]")
+    {
+        REQUIRE(toMessagePack("a: 1") == bytes({ 0x81, 0xa1, 'a', 0x01 }));
+    }
+    SECTION("Stringify an array to MessagePack.", "[YAML][Stringify][Array][MessagePack]")
+    {
+        REQUIRE(toMessagePack("[1, true, ~]") == bytes({ 0x93, 0x01, 0xc3, 0xc0 }));
+    }
+    SECTION("Stringify a nested structure to MessagePack.", "[YAML][Stringify][Dictionary][MessagePack]")
+    {
+        REQUIRE(toMessagePack("list:\n  - x\n  - y\nempty: {}\n") ==
+                bytes({ 0x82, 0xa4, 'l', 'i', 's', 't', 0x92, 0xa1, 'x', 0xa1, 'y',
+                        0xa5, 'e', 'm', 'p', 't', 'y', 0x80 }));
+    }
+    SECTION("Stringify a 16 element array to MessagePack (array 16).", "[YAML][Stringify][Array][MessagePack]")
+    {
+        const auto encoded = toMessagePack("[0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15]");
+        REQUIRE(encoded.substr(0, 3) == bytes({ 0xdc, 0x00, 0x10 }));
+        REQUIRE(encoded.size() == 19);
+    }
+}
+
+TEST_CASE("Check YAML stringification to MessagePack of timestamps.", "[YAML][Stringify][Timestamp][MessagePack]")
+{
+    SECTION("Stringify a UTC date-time to a timestamp 64 extension.", "[YAML][Stringify][Timestamp][MessagePack]")
+    {
+        // 2001-12-15T02:59:43.10Z == 1008385183 s + 100000000 ns
+        REQUIRE(toMessagePack("2001-12-14t21:59:43.10-05:00") ==
+                bytes({ 0xd7, 0xff, 0x17, 0xd7, 0x84, 0x00, 0x3c, 0x1a, 0xbc, 0x9f }));
+    }
+    SECTION("Stringify a date to a timestamp 64 extension at UTC midnight.", "[YAML][Stringify][Timestamp][MessagePack]")
+    {
+        // 2002-12-14 == 1039824000 s
+        REQUIRE(toMessagePack("2002-12-14") ==
+                bytes({ 0xd7, 0xff, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xfa, 0x74, 0x80 }));
+    }
+    SECTION("Stringify a pre-epoch date to a timestamp 96 extension.", "[YAML][Stringify][Timestamp][MessagePack]")
+    {
+        // 1969-12-31 == -86400 s
+        REQUIRE(toMessagePack("1969-12-31") ==
+                bytes({ 0xc7, 12, 0xff, 0, 0, 0, 0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xae, 0x80 }));
+    }
+}